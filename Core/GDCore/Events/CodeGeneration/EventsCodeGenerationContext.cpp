@@ -56,8 +56,29 @@ void EventsCodeGenerationContext::InheritsAsAsyncCallbackFrom(
 void EventsCodeGenerationContext::Reuse(
     EventsCodeGenerationContext& parent_) {
   InheritsFrom(parent_);
-  if (parent_.CanReuse())
+  if (parent_.CanReuse()) {
     contextDepth = parent_.GetContextDepth();  // Keep same context depth
+
+    // The lists that the parent could use without copying them can also be
+    // used by this context, as it's not followed by anything else.
+    reusableParentObjectsLists = parent_.reusableParentObjectsLists;
+  }
+}
+
+void EventsCodeGenerationContext::InheritsAndReusesUnusedObjectsLists(
+    EventsCodeGenerationContext& parent_,
+    const std::set<gd::String>& objectsListsUsedAfterwards) {
+  InheritsFrom(parent_);
+  if (!parent_.CanReuse() || parent_.IsInsideAsync()) return;
+
+  // Only the lists declared at the depth of the parent can be reused: lists
+  // declared by contexts with a lower depth could be needed after the parent.
+  for (const auto& objectDepth : parent_.depthOfLastUse) {
+    if (objectDepth.second == parent_.GetContextDepth() &&
+        objectsListsUsedAfterwards.find(objectDepth.first) ==
+            objectsListsUsedAfterwards.end())
+      reusableParentObjectsLists.insert(objectDepth.first);
+  }
 }
 
 void EventsCodeGenerationContext::NotifyAsyncParentsAboutDeclaredObject(const gd::String& objectName) {
@@ -68,6 +89,25 @@ void EventsCodeGenerationContext::NotifyAsyncParentsAboutDeclaredObject(const gd
     asyncContext->allObjectsListToBeDeclaredAcrossChildren.insert(objectName);
 }
 
+void EventsCodeGenerationContext::NotifyParentsAboutNeededObject(
+    const gd::String& objectName) {
+  // Stop at the first parent declaring the list: it's the one providing it.
+  for (gd::EventsCodeGenerationContext* context = this; context != nullptr;
+       context = context->parent) {
+    context->objectsListsNeededFromParents.insert(objectName);
+    if (context->parent && context->parent->IsToBeDeclared(objectName)) break;
+  }
+}
+
+unsigned int EventsCodeGenerationContext::GetDepthOfObjectsListToBeDeclared(
+    const gd::String& objectName) const {
+  if (reusableParentObjectsLists.find(objectName) !=
+      reusableParentObjectsLists.end())
+    return parent->GetLastDepthObjectListWasNeeded(objectName);
+
+  return GetContextDepth();
+}
+
 void EventsCodeGenerationContext::ObjectsListNeeded(
     const gd::String& objectName) {
   if (!IsToBeDeclared(objectName)) {
@@ -76,9 +116,12 @@ void EventsCodeGenerationContext::ObjectsListNeeded(
     if (IsInsideAsync()) {
       NotifyAsyncParentsAboutDeclaredObject(objectName);
     }
+    if (ObjectAlreadyDeclaredByParents(objectName)) {
+      NotifyParentsAboutNeededObject(objectName);
+    }
   }
 
-  depthOfLastUse[objectName] = GetContextDepth();
+  depthOfLastUse[objectName] = GetDepthOfObjectsListToBeDeclared(objectName);
 }
 
 void EventsCodeGenerationContext::ObjectsListNeededOrEmptyIfJustDeclared(
@@ -89,9 +132,12 @@ void EventsCodeGenerationContext::ObjectsListNeededOrEmptyIfJustDeclared(
     if (IsInsideAsync()) {
       NotifyAsyncParentsAboutDeclaredObject(objectName);
     }
+    if (ObjectAlreadyDeclaredByParents(objectName)) {
+      NotifyParentsAboutNeededObject(objectName);
+    }
   }
 
-  depthOfLastUse[objectName] = GetContextDepth();
+  depthOfLastUse[objectName] = GetDepthOfObjectsListToBeDeclared(objectName);
 }
 
 void EventsCodeGenerationContext::EmptyObjectsListNeeded(
@@ -100,7 +146,7 @@ void EventsCodeGenerationContext::EmptyObjectsListNeeded(
     emptyObjectsListsToBeDeclared.insert(objectName);
   }
 
-  depthOfLastUse[objectName] = GetContextDepth();
+  depthOfLastUse[objectName] = GetDepthOfObjectsListToBeDeclared(objectName);
 }
 
 std::set<gd::String> EventsCodeGenerationContext::GetAllObjectsToBeDeclared()
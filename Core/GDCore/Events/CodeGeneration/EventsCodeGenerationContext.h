@@ -58,6 +58,22 @@ class GD_CORE_API EventsCodeGenerationContext {
    */
   void Reuse(EventsCodeGenerationContext& parent);
 
+  /**
+   * \brief As InheritsFrom, mark the context as being the child of another
+   * one, but enabling the child context to use the same objects lists as its
+   * parent for the lists that are not needed after it.
+   *
+   * Used for example for optimizing events followed by events not using all
+   * the objects lists of their parent: these lists are not copied.
+   *
+   * \param parent The parent context.
+   * \param objectsListsUsedAfterwards The objects lists needed from the parent
+   * after this context (for example by the next events of a list).
+   */
+  void InheritsAndReusesUnusedObjectsLists(
+      EventsCodeGenerationContext& parent,
+      const std::set<gd::String>& objectsListsUsedAfterwards);
+
   /**
    * \brief Forbid any optimization that would reuse and modify the object list
    * from this context in children context.
@@ -183,6 +199,14 @@ class GD_CORE_API EventsCodeGenerationContext {
     return alreadyDeclaredObjectsLists;
   };
 
+  /**
+   * Return the objects lists declared by the parent contexts that were needed
+   * by this context or its children.
+   */
+  const std::set<gd::String>& GetObjectsListsNeededFromParents() const {
+    return objectsListsNeededFromParents;
+  };
+
   /**
    * \brief Get the depth of the context that was in effect when \a objectName
    * was needed.
@@ -270,6 +294,9 @@ class GD_CORE_API EventsCodeGenerationContext {
 
  private:
   void NotifyAsyncParentsAboutDeclaredObject(const gd::String& objectName);
+  void NotifyParentsAboutNeededObject(const gd::String& objectName);
+  unsigned int GetDepthOfObjectsListToBeDeclared(
+      const gd::String& objectName) const;
 
   std::set<gd::String>
       alreadyDeclaredObjectsLists;  ///< Objects lists already needed in a
@@ -296,6 +323,14 @@ class GD_CORE_API EventsCodeGenerationContext {
                                                  ///< all children, so that the
                                                  ///< necessary objects can be
                                                  ///< backed up.
+  std::set<gd::String>
+      objectsListsNeededFromParents;  ///< Objects lists declared by parent
+                                      ///< contexts and needed by this context
+                                      ///< or its children.
+  std::set<gd::String>
+      reusableParentObjectsLists;  ///< Objects lists of the parent that are
+                                   ///< not needed after this context, and can
+                                   ///< be used without being copied.
 
   std::map<gd::String, unsigned int>
       depthOfLastUse;  ///< The context depth when an object was last used.
@@ -314,7 +349,7 @@ class GD_CORE_API EventsCodeGenerationContext {
           ///< - Otherwise, it's a child of an asynchronous callback.
   unsigned int* maxDepthLevel;  ///< A pointer to a unsigned int updated with
                                 ///< the maximum depth reached.
-  const EventsCodeGenerationContext* parent =
+  EventsCodeGenerationContext* parent =
       nullptr;  ///< The parent of the current context. Can be NULL.
   EventsCodeGenerationContext* nearestAsyncParent =
       nullptr;  ///< The nearest parent context that is an async callback
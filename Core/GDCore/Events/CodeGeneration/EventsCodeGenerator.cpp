@@ -1,7 +1,9 @@
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 
 #include <algorithm>
+#include <set>
 #include <utility>
+#include <vector>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
@@ -15,6 +17,7 @@
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Project.h"
 
@@ -262,7 +265,8 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
   gd::String conditionCode;
 
   const gd::InstructionMetadata& instrInfos =
-      MetadataProvider::GetConditionMetadata(platform, condition.GetType());
+      MetadataProvider::GetConditionMetadata(platform,
+                                             condition.GetInternedType());
   if (MetadataProvider::IsBadInstructionMetadata(instrInfos)) {
     return "/* Unknown instruction - skipped. */";
   }
@@ -454,7 +458,7 @@ gd::String EventsCodeGenerator::GenerateActionCode(
   gd::String actionCode;
 
   const gd::InstructionMetadata& instrInfos =
-      MetadataProvider::GetActionMetadata(platform, action.GetType());
+      MetadataProvider::GetActionMetadata(platform, action.GetInternedType());
   if (MetadataProvider::IsBadInstructionMetadata(instrInfos)) {
     return "/* Unknown instruction - skipped. */";
   }
@@ -875,14 +879,20 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
  */
 gd::String EventsCodeGenerator::GenerateEventsListCode(
     gd::EventsList& events, EventsCodeGenerationContext& parentContext) {
-  gd::String output;
-  for (std::size_t eId = 0; eId < events.size(); ++eId) {
+  //*Optimization*: events are generated from the last to the first one, so
+  // that the objects lists of the parent needed by the next events are known
+  // when an event is generated. The other lists of the parent are discarded
+  // after the event, so the event can use them instead of copying them.
+  std::vector<gd::String> eventsOutputs(events.size());
+  std::set<gd::String> objectsListsNeededByNextEvents;
+  for (std::size_t eId = events.size(); eId-- > 0;) {
     // Each event has its own context : Objects picked in an event are totally
     // different than the one picked in another.
     gd::EventsCodeGenerationContext newContext;
-    newContext.InheritsFrom(
-        parentContext);  // Events in the same "level" share
-                         // the same context as their parent.
+    newContext.InheritsAndReusesUnusedObjectsLists(
+        parentContext,
+        objectsListsNeededByNextEvents);  // Events in the same "level" share
+                                          // the same context as their parent.
 
     //*Optimization*: when the event is the last of a list, we can use the
     // same lists of objects as the parent (as they will be discarded just
@@ -902,10 +912,16 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
     gd::String scopeEnd = GenerateScopeEnd(context);
     gd::String declarationsCode = GenerateObjectsDeclarationCode(context);
 
-    output += "\n" + scopeBegin + "\n" + declarationsCode + "\n" +
-              eventCoreCode + "\n" + scopeEnd + "\n";
+    eventsOutputs[eId] = "\n" + scopeBegin + "\n" + declarationsCode + "\n" +
+                         eventCoreCode + "\n" + scopeEnd + "\n";
+    objectsListsNeededByNextEvents.insert(
+        context.GetObjectsListsNeededFromParents().begin(),
+        context.GetObjectsListsNeededFromParents().end());
   }
 
+  gd::String output;
+  for (const gd::String& eventOutput : eventsOutputs) output += eventOutput;
+
   return output;
 }
 
@@ -1227,6 +1243,22 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
   }
 }
 
+const gd::VariablesContainer* EventsCodeGenerator::GetDeclaredVariables(
+    const VariableScope& scope, const gd::String& objectName) const {
+  if (!HasProjectAndLayout()) return nullptr;
+
+  if (scope == LAYOUT_VARIABLE) return &GetLayout().GetVariables();
+  if (scope == PROJECT_VARIABLE) return &GetProject().GetVariables();
+
+  // We check first layout's objects' list, then the global objects list.
+  if (GetLayout().HasObjectNamed(objectName))
+    return &GetLayout().GetObject(objectName).GetVariables();
+  if (GetProject().HasObjectNamed(objectName))
+    return &GetProject().GetObject(objectName).GetVariables();
+
+  return nullptr;
+}
+
 size_t EventsCodeGenerator::GenerateSingleUsageUniqueIdForEventsList() {
   return eventsListNextUniqueId++;
 }
@@ -1282,6 +1314,7 @@ EventsCodeGenerator::EventsCodeGenerator(const gd::Project& project_,
       scene(&layout),
       errorOccurred(false),
       compilationForRuntime(false),
+      parsedExpressionsCache(&project_.GetParsedExpressionsCache()),
       maxCustomConditionsDepth(0),
       maxConditionsListsSize(0),
       eventsListNextUniqueId(0){};
@@ -1298,6 +1331,7 @@ EventsCodeGenerator::EventsCodeGenerator(
       scene(nullptr),
       errorOccurred(false),
       compilationForRuntime(false),
+      parsedExpressionsCache(nullptr),
       maxCustomConditionsDepth(0),
       maxConditionsListsSize(0),
       eventsListNextUniqueId(0){};
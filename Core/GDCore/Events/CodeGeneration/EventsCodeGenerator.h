@@ -16,6 +16,7 @@
 namespace gd {
 class EventsList;
 class Expression;
+class ParsedExpressionsCache;
 class Project;
 class Layout;
 class ObjectsContainer;
@@ -28,6 +29,8 @@ class EventsCodeGenerationContext;
 class ExpressionCodeGenerationInformation;
 class InstructionMetadata;
 class Platform;
+class Variable;
+class VariablesContainer;
 }  // namespace gd
 
 namespace gd {
@@ -311,6 +314,22 @@ class GD_CORE_API EventsCodeGenerator {
     compilationForRuntime = compilationForRuntime_;
   }
 
+  /**
+   * \brief Return the cache used to parse expressions, or nullptr if
+   * expressions are parsed without a cache.
+   */
+  gd::ParsedExpressionsCache* GetParsedExpressionsCache() const {
+    return parsedExpressionsCache;
+  }
+
+  /**
+   * \brief Set the cache used to parse expressions (by default, the one of
+   * the project, if any).
+   */
+  void SetParsedExpressionsCache(gd::ParsedExpressionsCache* cache) {
+    parsedExpressionsCache = cache;
+  }
+
   /**
    * \brief Report that an error occurred during code generation ( Event code
    * won't be generated )
@@ -470,6 +489,14 @@ class GD_CORE_API EventsCodeGenerator {
 
   enum VariableScope { LAYOUT_VARIABLE = 0, PROJECT_VARIABLE, OBJECT_VARIABLE };
 
+  /**
+   * \brief Get the variables declared in the editor for the given scope, or
+   * nullptr if they are not known (for example for a group of objects or when
+   * code is generated for a function).
+   */
+  const gd::VariablesContainer* GetDeclaredVariables(
+      const VariableScope& scope, const gd::String& objectName) const;
+
   /**
    * Generate a single unique number for the specified instruction.
    *
@@ -566,6 +593,15 @@ class GD_CORE_API EventsCodeGenerator {
     return ".getChild(" + ConvertToStringExplicit(childName) + ")";
   };
 
+  /**
+   * \brief Generate the code to get the child of a variable, when the child
+   * is declared in \a parentVariable (a structure).
+   */
+  virtual gd::String GenerateDeclaredVariableAccessor(
+      const gd::String& childName, const gd::Variable& parentVariable) {
+    return GenerateVariableAccessor(childName);
+  };
+
   /**
    * \brief Generate the code to get the child of a variable,
    * using generated the expression.
@@ -788,6 +824,8 @@ class GD_CORE_API EventsCodeGenerator {
   bool errorOccurred;          ///< Must be set to true if an error occurred.
   bool compilationForRuntime;  ///< Is set to true if the code generation is
                                ///< made for runtime only.
+  gd::ParsedExpressionsCache*
+      parsedExpressionsCache;  ///< The cache used to parse expressions, if any.
 
   std::set<gd::String>
       includeFiles;  ///< List of headers files used by instructions. A (shared)
@@ -5,16 +5,22 @@
  */
 #include "ExpressionCodeGenerator.h"
 
+#include <cmath>
+#include <iomanip>
+#include <locale>
 #include <memory>
+#include <sstream>
 #include <vector>
 
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/CodeGeneration/ExpressionConstantFolder.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Events/Parsers/ExpressionParser2Node.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Events/Parsers/ParsedExpressionsCache.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
@@ -25,6 +31,8 @@
 #include "GDCore/IDE/Events/ExpressionValidator.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/IDE/Events/ExpressionTypeFinder.h"
 #include "GDCore/IDE/Events/ExpressionVariableOwnerFinder.h"
 
@@ -38,7 +46,8 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
     const gd::String& rootObjectName) {
   ExpressionCodeGenerator generator(rootType, rootObjectName, codeGenerator, context);
 
-  auto node = expression.GetRootNode();
+  auto cache = codeGenerator.GetParsedExpressionsCache();
+  auto node = cache ? expression.GetRootNode(*cache) : expression.GetRootNode();
   if (!node) {
     std::cout << "Error: error while parsing: \"" << expression.GetPlainString()
               << "\" (" << rootType << ")" << std::endl;
@@ -59,11 +68,65 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
     return generator.GenerateDefaultValue(rootType);
   }
 
+  gd::ExpressionConstantFolder constantFolder(
+      codeGenerator.GetPlatform(),
+      codeGenerator.GetGlobalObjectsAndGroups(),
+      codeGenerator.GetObjectsAndGroups());
+  node->Visit(constantFolder);
+  generator.SetConstantFolder(&constantFolder);
+
   node->Visit(generator);
   return generator.GetOutput();
 }
 
+bool ExpressionCodeGenerator::GenerateFoldedNodeCode(const ExpressionNode& node) {
+  if (!constantFolder) return false;
+
+  auto value = constantFolder->GetConstantValue(node);
+  if (value) {
+    output += GenerateConstantCode(*value);
+    return true;
+  }
+
+  auto simplifiedNode = constantFolder->GetSimplifiedNode(node);
+  if (simplifiedNode) {
+    output += "(";
+    simplifiedNode->Visit(*this);
+    output += ")";
+    return true;
+  }
+
+  return false;
+}
+
+gd::String ExpressionCodeGenerator::GenerateConstantCode(
+    const ExpressionConstantValue& value) {
+  if (value.IsString())
+    return codeGenerator.ConvertToStringExplicit(value.GetString());
+
+  // Use the shortest literal giving back the same number.
+  double number = value.GetNumber();
+  std::string literal;
+  for (int precision = 1; precision <= 17; ++precision) {
+    std::ostringstream stream;
+    stream.imbue(std::locale::classic());
+    stream << std::setprecision(precision) << number;
+    literal = stream.str();
+
+    std::istringstream readStream(literal);
+    readStream.imbue(std::locale::classic());
+    double readNumber = 0;
+    readStream >> readNumber;
+    if (readNumber == number) break;
+  }
+
+  return std::signbit(number) ? "(" + gd::String::FromUTF8(literal) + ")"
+                              : gd::String::FromUTF8(literal);
+}
+
 void ExpressionCodeGenerator::OnVisitOperatorNode(OperatorNode& node) {
+  if (GenerateFoldedNodeCode(node)) return;
+
   node.leftHandSide->Visit(*this);
   output += " ";
   output.push_back(node.op);
@@ -73,6 +136,8 @@ void ExpressionCodeGenerator::OnVisitOperatorNode(OperatorNode& node) {
 
 void ExpressionCodeGenerator::OnVisitUnaryOperatorNode(
     UnaryOperatorNode& node) {
+  if (GenerateFoldedNodeCode(node)) return;
+
   output.push_back(node.op);
   output += "(";  // Add extra parenthesis to ensure that things like --2 are
                   // properly outputted as -(-2) (GDevelop don't have -- or ++
@@ -83,6 +148,8 @@ void ExpressionCodeGenerator::OnVisitUnaryOperatorNode(
 
 void ExpressionCodeGenerator::OnVisitSubExpressionNode(
     SubExpressionNode& node) {
+  if (GenerateFoldedNodeCode(node)) return;
+
   output += "(";
   node.expression->Visit(*this);
   output += ")";
@@ -117,24 +184,69 @@ void ExpressionCodeGenerator::OnVisitVariableNode(VariableNode& node) {
                                         node);
   output += codeGenerator.GenerateGetVariable(
       node.name, scope, context, objectName);
+  SetDeclaredVariable(codeGenerator.GetDeclaredVariables(scope, objectName),
+                      node.name);
   if (node.child) node.child->Visit(*this);
 }
 
 void ExpressionCodeGenerator::OnVisitVariableAccessorNode(
     VariableAccessorNode& node) {
-  output += codeGenerator.GenerateVariableAccessor(node.name);
+  output += GenerateChildVariableAccessor(node.name);
   if (node.child) node.child->Visit(*this);
 }
 
 void ExpressionCodeGenerator::OnVisitVariableBracketAccessorNode(
     VariableBracketAccessorNode& node) {
+  // A child accessed with a constant name is handled like with a dot.
+  auto key = constantFolder ? constantFolder->GetConstantValue(*node.expression)
+                            : nullptr;
+  if (key && key->IsString() && declaredVariable &&
+      declaredVariable->HasChild(key->GetString())) {
+    output += GenerateChildVariableAccessor(key->GetString());
+    if (node.child) node.child->Visit(*this);
+    return;
+  }
+
   ExpressionCodeGenerator generator("string", "", codeGenerator, context);
+  generator.SetConstantFolder(constantFolder);
   node.expression->Visit(generator);
   output +=
       codeGenerator.GenerateVariableBracketAccessor(generator.GetOutput());
+
+  // Keep track of the declared element when a constant index is used.
+  const gd::Variable* element = nullptr;
+  if (key && !key->IsString() && declaredVariable &&
+      declaredVariable->GetType() == gd::Variable::Array) {
+    double index = key->GetNumber();
+    const auto& elements = declaredVariable->GetAllChildrenArray();
+    if (index >= 0 && index < elements.size() && index == std::floor(index))
+      element = elements[static_cast<std::size_t>(index)].get();
+  }
+  declaredVariable = element;
+
   if (node.child) node.child->Visit(*this);
 }
 
+void ExpressionCodeGenerator::SetDeclaredVariable(
+    const gd::VariablesContainer* variables, const gd::String& variableName) {
+  declaredVariable = variables && variables->Has(variableName)
+                         ? &variables->Get(variableName)
+                         : nullptr;
+}
+
+gd::String ExpressionCodeGenerator::GenerateChildVariableAccessor(
+    const gd::String& childName) {
+  if (!declaredVariable || !declaredVariable->HasChild(childName)) {
+    declaredVariable = nullptr;
+    return codeGenerator.GenerateVariableAccessor(childName);
+  }
+
+  gd::String code =
+      codeGenerator.GenerateDeclaredVariableAccessor(childName, *declaredVariable);
+  declaredVariable = &declaredVariable->GetChild(childName);
+  return code;
+}
+
 void ExpressionCodeGenerator::OnVisitIdentifierNode(IdentifierNode& node) {
   auto type = gd::ExpressionTypeFinder::GetType(codeGenerator.GetPlatform(),
                                             codeGenerator.GetGlobalObjectsAndGroups(),
@@ -160,7 +272,10 @@ void ExpressionCodeGenerator::OnVisitIdentifierNode(IdentifierNode& node) {
       output += codeGenerator.GenerateGetVariable(
           node.identifierName, scope, context, objectName);
       if (!node.childIdentifierName.empty()) {
-        output += codeGenerator.GenerateVariableAccessor(node.childIdentifierName);
+        SetDeclaredVariable(
+            codeGenerator.GetDeclaredVariables(scope, objectName),
+            node.identifierName);
+        output += GenerateChildVariableAccessor(node.childIdentifierName);
       }
   } else if (node.childIdentifierName.empty()) {
     output += "/* Error during generation, unrecognized identifier type: " +
@@ -176,6 +291,8 @@ void ExpressionCodeGenerator::OnVisitIdentifierNode(IdentifierNode& node) {
 }
 
 void ExpressionCodeGenerator::OnVisitFunctionCallNode(FunctionCallNode& node) {
+  if (GenerateFoldedNodeCode(node)) return;
+
   auto type = gd::ExpressionTypeFinder::GetType(codeGenerator.GetPlatform(),
                                             codeGenerator.GetGlobalObjectsAndGroups(),
                                             codeGenerator.GetObjectsAndGroups(),
@@ -363,14 +480,18 @@ gd::String ExpressionCodeGenerator::GenerateParametersCodes(
                                               rootObjectName,
                                               *parameters[nonCodeOnlyParameterIndex].get());
         ExpressionCodeGenerator generator(parameterMetadata.GetType(), objectName, codeGenerator, context);
+        generator.SetConstantFolder(constantFolder);
         parameters[nonCodeOnlyParameterIndex]->Visit(generator);
         parametersCode += generator.GetOutput();
       } else if (parameterMetadata.IsOptional()) {
         ExpressionCodeGenerator generator(parameterMetadata.GetType(), "", codeGenerator, context);
         // Optional parameters default value were not parsed at the time of the
         // expression parsing. Parse them now.
-        ExpressionParser2 parser;
-        auto node = parser.ParseExpression(parameterMetadata.GetDefaultValue());
+        auto cache = codeGenerator.GetParsedExpressionsCache();
+        std::shared_ptr<gd::ExpressionNode> node =
+            cache ? cache->GetRootNode(parameterMetadata.GetDefaultValue())
+                  : ExpressionParser2().ParseExpression(
+                        parameterMetadata.GetDefaultValue());
 
         node->Visit(generator);
         parametersCode += generator.GetOutput();
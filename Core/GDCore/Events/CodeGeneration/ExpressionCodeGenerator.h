@@ -18,6 +18,10 @@ class ObjectsContainer;
 class Platform;
 class ParameterMetadata;
 class ExpressionMetadata;
+class ExpressionConstantFolder;
+class ExpressionConstantValue;
+class Variable;
+class VariablesContainer;
 class EventsCodeGenerationContext;
 class EventsCodeGenerator;
 }  // namespace gd
@@ -38,7 +42,7 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
                           const gd::String &rootObjectName_,
                           EventsCodeGenerator& codeGenerator_,
                           EventsCodeGenerationContext& context_)
-      : rootType(rootType_), rootObjectName(rootObjectName_), codeGenerator(codeGenerator_), context(context_){};
+      : rootType(rootType_), rootObjectName(rootObjectName_), codeGenerator(codeGenerator_), context(context_), constantFolder(nullptr), declaredVariable(nullptr){};
   virtual ~ExpressionCodeGenerator(){};
 
   /**
@@ -53,6 +57,9 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
    * \param object The object the expression refers too (only for "objectvar"
    * type).
    *
+   * Constant parts of the expression (see gd::ExpressionConstantFolder) are
+   * computed and replaced by their values.
+   *
    * \see see gd::ExpressionParser2
    */
   static gd::String GenerateExpressionCode(EventsCodeGenerator& codeGenerator,
@@ -63,6 +70,14 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
 
   const gd::String& GetOutput() { return output; };
 
+  /**
+   * \brief Use the constants found by the folder instead of generating code
+   * for the nodes that were folded. The folder must have visited the nodes.
+   */
+  void SetConstantFolder(const ExpressionConstantFolder* constantFolder_) {
+    constantFolder = constantFolder_;
+  };
+
  protected:
   void OnVisitSubExpressionNode(SubExpressionNode& node) override;
   void OnVisitOperatorNode(OperatorNode& node) override;
@@ -98,6 +113,11 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
       const ExpressionMetadata& expressionMetadata,
       size_t initialParameterIndex);
   gd::String GenerateDefaultValue(const gd::String& type);
+  bool GenerateFoldedNodeCode(const ExpressionNode& node);
+  gd::String GenerateConstantCode(const ExpressionConstantValue& value);
+  void SetDeclaredVariable(const gd::VariablesContainer* variables,
+                           const gd::String& variableName);
+  gd::String GenerateChildVariableAccessor(const gd::String& childName);
   static std::vector<gd::Expression> PrintParameters(
       const std::vector<std::unique_ptr<ExpressionNode>>& parameters);
 
@@ -106,6 +126,10 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
   EventsCodeGenerationContext& context;
   const gd::String rootType;
   const gd::String rootObjectName;
+  const ExpressionConstantFolder* constantFolder;
+  const gd::Variable* declaredVariable;  ///< The variable declared in the
+                                         ///< editor for the variable being
+                                         ///< generated, if any.
 };
 
 }  // namespace gd
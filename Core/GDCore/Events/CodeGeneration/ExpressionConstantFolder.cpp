@@ -0,0 +1,213 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/ExpressionConstantFolder.h"
+
+#include <cmath>
+#include <locale>
+#include <sstream>
+#include <vector>
+
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+
+namespace gd {
+
+void ExpressionConstantFolder::OnVisitSubExpressionNode(
+    SubExpressionNode& node) {
+  node.expression->Visit(*this);
+
+  auto value = GetConstantValue(*node.expression);
+  if (value) constantValues[&node] = *value;
+}
+
+void ExpressionConstantFolder::OnVisitOperatorNode(OperatorNode& node) {
+  if (node.op == '+' || node.op == '-') {
+    FoldAdditions(node);
+    return;
+  }
+
+  node.leftHandSide->Visit(*this);
+  node.rightHandSide->Visit(*this);
+
+  auto leftValue = GetConstantValue(*node.leftHandSide);
+  auto rightValue = GetConstantValue(*node.rightHandSide);
+  if (leftValue && rightValue) {
+    if (!leftValue->IsString() && !rightValue->IsString()) {
+      if (node.op == '*')
+        SetConstantNumber(node,
+                          leftValue->GetNumber() * rightValue->GetNumber());
+      else if (node.op == '/')
+        SetConstantNumber(node,
+                          leftValue->GetNumber() / rightValue->GetNumber());
+    }
+    return;
+  }
+
+  // Remove operations without effect on numbers.
+  if ((node.op == '*' || node.op == '/') && IsNumber(*node.rightHandSide, 1))
+    simplifiedNodes[&node] = node.leftHandSide.get();
+  else if (node.op == '*' && IsNumber(*node.leftHandSide, 1))
+    simplifiedNodes[&node] = node.rightHandSide.get();
+}
+
+void ExpressionConstantFolder::FoldAdditions(OperatorNode& node) {
+  // Additions and subtractions are parsed from right to left (a - b - c is
+  // stored as a - (b - c)) and generated without parentheses: the operands of
+  // the whole chain are computed from left to right, and the operator nodes
+  // inside the chain are never folded alone.
+  std::vector<const ExpressionNode*> operands;
+  std::vector<gd::String::value_type> operators;
+  ExpressionNode* current = &node;
+  while (true) {
+    auto operatorNode = dynamic_cast<OperatorNode*>(current);
+    if (!operatorNode || (operatorNode->op != '+' && operatorNode->op != '-'))
+      break;
+
+    operatorNode->leftHandSide->Visit(*this);
+    operands.push_back(operatorNode->leftHandSide.get());
+    operators.push_back(operatorNode->op);
+    current = operatorNode->rightHandSide.get();
+  }
+  current->Visit(*this);
+  operands.push_back(current);
+
+  auto firstValue = GetConstantValue(*operands[0]);
+  if (!firstValue) return;
+
+  if (firstValue->IsString()) {
+    gd::String result = firstValue->GetString();
+    for (std::size_t i = 0; i < operators.size(); ++i) {
+      auto value = GetConstantValue(*operands[i + 1]);
+      if (!value || !value->IsString() || operators[i] != '+') return;
+
+      result += value->GetString();
+    }
+    constantValues[&node] = gd::ExpressionConstantValue(result);
+  } else {
+    double result = firstValue->GetNumber();
+    for (std::size_t i = 0; i < operators.size(); ++i) {
+      auto value = GetConstantValue(*operands[i + 1]);
+      if (!value || value->IsString()) return;
+
+      if (operators[i] == '+')
+        result += value->GetNumber();
+      else
+        result -= value->GetNumber();
+    }
+    SetConstantNumber(node, result);
+  }
+}
+
+void ExpressionConstantFolder::OnVisitUnaryOperatorNode(
+    UnaryOperatorNode& node) {
+  node.factor->Visit(*this);
+
+  auto value = GetConstantValue(*node.factor);
+  if (value) {
+    if (!value->IsString()) {
+      if (node.op == '-')
+        SetConstantNumber(node, -value->GetNumber());
+      else if (node.op == '+')
+        SetConstantNumber(node, value->GetNumber());
+    }
+    return;
+  }
+
+  // -(-x) is x.
+  if (node.op == '-') {
+    ExpressionNode* factor = node.factor.get();
+    while (auto subExpression = dynamic_cast<SubExpressionNode*>(factor))
+      factor = subExpression->expression.get();
+
+    auto negatedFactor = dynamic_cast<UnaryOperatorNode*>(factor);
+    if (negatedFactor && negatedFactor->op == '-')
+      simplifiedNodes[&node] = negatedFactor->factor.get();
+  }
+}
+
+void ExpressionConstantFolder::OnVisitNumberNode(NumberNode& node) {
+  const gd::String& numberText = node.number;
+  std::istringstream stream(numberText.Raw());
+  stream.imbue(std::locale::classic());
+  double number = 0;
+  stream >> number;
+  if (!stream.fail() && stream.eof()) SetConstantNumber(node, number);
+}
+
+void ExpressionConstantFolder::OnVisitTextNode(TextNode& node) {
+  constantValues[&node] = gd::ExpressionConstantValue(node.text);
+}
+
+void ExpressionConstantFolder::OnVisitVariableNode(VariableNode& node) {
+  if (node.child) node.child->Visit(*this);
+}
+
+void ExpressionConstantFolder::OnVisitVariableAccessorNode(
+    VariableAccessorNode& node) {
+  if (node.child) node.child->Visit(*this);
+}
+
+void ExpressionConstantFolder::OnVisitVariableBracketAccessorNode(
+    VariableBracketAccessorNode& node) {
+  node.expression->Visit(*this);
+  if (node.child) node.child->Visit(*this);
+}
+
+void ExpressionConstantFolder::OnVisitFunctionCallNode(FunctionCallNode& node) {
+  for (auto& parameter : node.parameters) parameter->Visit(*this);
+
+  // Only free functions can be pure: object functions depend on the objects.
+  if (!node.objectName.empty()) return;
+
+  const gd::ExpressionMetadata& metadata =
+      MetadataProvider::GetFunctionCallMetadata(
+          platform, globalObjectsContainer, objectsContainer, node);
+  if (!metadata.IsPure() ||
+      metadata.parameters.size() != node.parameters.size())
+    return;
+
+  std::vector<gd::ExpressionConstantValue> parameters;
+  for (std::size_t i = 0; i < node.parameters.size(); ++i) {
+    const gd::ParameterMetadata& parameterMetadata = metadata.parameters[i];
+    auto value = GetConstantValue(*node.parameters[i]);
+    if (!value || parameterMetadata.IsCodeOnly()) return;
+
+    bool isExpectedType =
+        value->IsString()
+            ? gd::ParameterMetadata::IsExpression("string",
+                                                  parameterMetadata.GetType())
+            : gd::ParameterMetadata::IsExpression("number",
+                                                  parameterMetadata.GetType());
+    if (!isExpectedType) return;
+
+    parameters.push_back(*value);
+  }
+
+  gd::ExpressionConstantValue result;
+  if (!metadata.EvaluatePure(parameters, result)) return;
+
+  if (result.IsString())
+    constantValues[&node] = result;
+  else
+    SetConstantNumber(node, result.GetNumber());
+}
+
+bool ExpressionConstantFolder::IsNumber(const gd::ExpressionNode& node,
+                                        double number) const {
+  auto value = GetConstantValue(node);
+  return value && !value->IsString() && value->GetNumber() == number;
+}
+
+void ExpressionConstantFolder::SetConstantNumber(
+    const gd::ExpressionNode& node, double number) {
+  // Infinite numbers and NaN can't be written as literals.
+  if (std::isfinite(number))
+    constantValues[&node] = gd::ExpressionConstantValue(number);
+}
+
+}  // namespace gd
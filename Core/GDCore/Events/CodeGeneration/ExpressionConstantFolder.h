@@ -0,0 +1,93 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EXPRESSIONCONSTANTFOLDER_H
+#define GDCORE_EXPRESSIONCONSTANTFOLDER_H
+
+#include <unordered_map>
+
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/String.h"
+namespace gd {
+class ObjectsContainer;
+class Platform;
+struct ExpressionNode;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Find the parts of a parsed expression that can be computed before
+ * running the game: operations on literals and calls to pure functions (see
+ * gd::ExpressionMetadata::SetPure) with constant parameters.
+ *
+ * The nodes are not modified (parsed expressions are shared with the cache and
+ * the editor): the constant values and the simplified nodes (like `x` for
+ * `x * 1`) are stored by the folder, to be used by gd::ExpressionCodeGenerator.
+ *
+ * \see gd::ExpressionCodeGenerator
+ */
+class GD_CORE_API ExpressionConstantFolder
+    : public ExpressionParser2NodeWorker {
+ public:
+  ExpressionConstantFolder(const gd::Platform& platform_,
+                           const gd::ObjectsContainer& globalObjectsContainer_,
+                           const gd::ObjectsContainer& objectsContainer_)
+      : platform(platform_),
+        globalObjectsContainer(globalObjectsContainer_),
+        objectsContainer(objectsContainer_){};
+  virtual ~ExpressionConstantFolder(){};
+
+  /**
+   * \brief Return the value of the node, or nullptr if it's not a constant.
+   */
+  const gd::ExpressionConstantValue* GetConstantValue(
+      const gd::ExpressionNode& node) const {
+    auto it = constantValues.find(&node);
+    return it != constantValues.end() ? &it->second : nullptr;
+  };
+
+  /**
+   * \brief Return a node giving the same result as \a node, or nullptr if the
+   * node can't be simplified.
+   */
+  gd::ExpressionNode* GetSimplifiedNode(const gd::ExpressionNode& node) const {
+    auto it = simplifiedNodes.find(&node);
+    return it != simplifiedNodes.end() ? it->second : nullptr;
+  };
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override;
+  void OnVisitOperatorNode(OperatorNode& node) override;
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override;
+  void OnVisitNumberNode(NumberNode& node) override;
+  void OnVisitTextNode(TextNode& node) override;
+  void OnVisitVariableNode(VariableNode& node) override;
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override;
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override;
+  void OnVisitIdentifierNode(IdentifierNode& node) override{};
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override{};
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override;
+  void OnVisitEmptyNode(EmptyNode& node) override{};
+
+ private:
+  void FoldAdditions(OperatorNode& node);
+  bool IsNumber(const gd::ExpressionNode& node, double value) const;
+  void SetConstantNumber(const gd::ExpressionNode& node, double value);
+
+  const gd::Platform& platform;
+  const gd::ObjectsContainer& globalObjectsContainer;
+  const gd::ObjectsContainer& objectsContainer;
+  std::unordered_map<const gd::ExpressionNode*, gd::ExpressionConstantValue>
+      constantValues;
+  std::unordered_map<const gd::ExpressionNode*, gd::ExpressionNode*>
+      simplifiedNodes;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EXPRESSIONCONSTANTFOLDER_H
@@ -7,6 +7,7 @@
 #include "EventsList.h"
 
 #include "GDCore/Events/Event.h"
+#include "GDCore/IDE/Events/EventsReferencesIndex.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Tools/Log.h"
 #include "Serialization.h"
@@ -15,6 +16,10 @@ namespace gd {
 
 EventsList::EventsList() {}
 
+EventsList::~EventsList() {
+  gd::EventsReferencesIndex::NotifyEventsListDestroyed(*this);
+}
+
 void EventsList::InsertEvents(const EventsList& otherEvents,
                               size_t begin,
                               size_t end,
@@ -32,6 +37,7 @@ void EventsList::InsertEvents(const EventsList& otherEvents,
       events.push_back(
           CloneRememberingOriginalEvent(otherEvents.events[begin + insertPos]));
   }
+  gd::EventsReferencesIndex::NotifyEventsListChanged(*this);
 }
 
 gd::BaseEvent& EventsList::InsertEvent(const gd::BaseEvent& evt,
@@ -41,6 +47,7 @@ gd::BaseEvent& EventsList::InsertEvent(const gd::BaseEvent& evt,
     events.insert(events.begin() + position, event);
   else
     events.push_back(event);
+  gd::EventsReferencesIndex::NotifyEventsListChanged(*this);
 
   return *event;
 }
@@ -51,6 +58,7 @@ void EventsList::InsertEvent(std::shared_ptr<gd::BaseEvent> event,
     events.insert(events.begin() + position, event);
   else
     events.push_back(event);
+  gd::EventsReferencesIndex::NotifyEventsListChanged(*this);
 }
 
 gd::BaseEvent& EventsList::InsertNewEvent(gd::Project& project,
@@ -68,12 +76,14 @@ gd::BaseEvent& EventsList::InsertNewEvent(gd::Project& project,
 
 void EventsList::RemoveEvent(size_t index) {
   events.erase(events.begin() + index);
+  gd::EventsReferencesIndex::NotifyEventsListChanged(*this);
 }
 
 void EventsList::RemoveEvent(const gd::BaseEvent& event) {
   for (size_t i = 0; i < events.size(); ++i) {
     if (events[i].get() == &event) {
       events.erase(events.begin() + i);
+      gd::EventsReferencesIndex::NotifyEventsListChanged(*this);
       return;
     }
   }
@@ -88,6 +98,11 @@ void EventsList::UnserializeFrom(gd::Project& project,
   EventsListSerialization::UnserializeEventsFrom(project, *this, element);
 }
 
+void EventsList::Clear() {
+  events.clear();
+  gd::EventsReferencesIndex::NotifyEventsListChanged(*this);
+}
+
 bool EventsList::Contains(const gd::BaseEvent& eventToSearch,
                           bool recursive) const {
   for (std::size_t i = 0; i < GetEventsCount(); ++i) {
@@ -107,6 +122,7 @@ bool EventsList::MoveEventToAnotherEventsList(const gd::BaseEvent& eventToMove,
     if (events[i].get() == &eventToMove) {
       std::shared_ptr<BaseEvent> event = events[i];
       events.erase(events.begin() + i);
+      gd::EventsReferencesIndex::NotifyEventsListChanged(*this);
 
       newEventsList.InsertEvent(event, newPosition);
       return true;
@@ -119,7 +135,10 @@ bool EventsList::MoveEventToAnotherEventsList(const gd::BaseEvent& eventToMove,
 EventsList::EventsList(const EventsList& other) { Init(other); }
 
 EventsList& EventsList::operator=(const EventsList& other) {
-  if (this != &other) Init(other);
+  if (this != &other) {
+    Init(other);
+    gd::EventsReferencesIndex::NotifyEventsListChanged(*this);
+  }
 
   return *this;
 }
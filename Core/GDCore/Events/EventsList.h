@@ -8,6 +8,7 @@
 #define GDCORE_EVENTSLIST_H
 #include <memory>
 #include <vector>
+#include "GDCore/IDE/Events/EventsReferencesIndexFlag.h"
 #include "GDCore/String.h"
 namespace gd {
 class Project;
@@ -34,7 +35,7 @@ class GD_CORE_API EventsList {
  public:
   EventsList();
   EventsList(const EventsList&);
-  virtual ~EventsList(){};
+  virtual ~EventsList();
   EventsList& operator=(const EventsList& rhs);
 
   /**
@@ -130,7 +131,7 @@ class GD_CORE_API EventsList {
   /**
    * \brief Clear the list of events.
    */
-  void Clear() { return events.clear(); };
+  void Clear();
 
   /** \name Utilities
    * Utility methods
@@ -207,8 +208,17 @@ class GD_CORE_API EventsList {
   void UnserializeFrom(gd::Project& project, const SerializerElement& element);
   ///@}
 
+  /**
+   * \brief Return the flag telling if the list is indexed by a
+   * gd::EventsReferencesIndex.
+   */
+  const gd::EventsReferencesIndexFlag& GetEventsReferencesIndexFlag() const {
+    return eventsReferencesIndexFlag;
+  };
+
  private:
   std::vector<std::shared_ptr<BaseEvent> > events;
+  gd::EventsReferencesIndexFlag eventsReferencesIndexFlag;
 
   /**
    * Initialize from another list of events, copying events. Used by copy-ctor
@@ -7,33 +7,49 @@
 #include "GDCore/Events/Expression.h"
 
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ParsedExpressionsCache.h"
 #include "GDCore/String.h"
 
 namespace gd {
 
-Expression::Expression() : node(nullptr) {};
+Expression::Expression() : node(nullptr), isNodeShared(false) {};
 
 Expression::Expression(gd::String plainString_)
-    : node(nullptr), plainString(plainString_) {};
+    : plainString(plainString_), node(nullptr), isNodeShared(false) {};
 
 Expression::Expression(const char* plainString_)
-    : node(nullptr), plainString(plainString_) {};
+    : plainString(plainString_), node(nullptr), isNodeShared(false) {};
 
 Expression::Expression(const Expression& copy)
-    : node(nullptr), plainString{copy.plainString} {};
+    : plainString{copy.plainString},
+      node(copy.isNodeShared ? copy.node : nullptr),
+      isNodeShared(copy.isNodeShared) {};
 
 Expression& Expression::operator=(const Expression& expression) {
   plainString = expression.plainString;
-  node = nullptr;
+  node = expression.isNodeShared ? expression.node : nullptr;
+  isNodeShared = expression.isNodeShared;
   return *this;
 };
 
 Expression::~Expression(){};
 
 ExpressionNode* Expression::GetRootNode() const {
-  if (!node) {
+  if (!node || isNodeShared) {
+    // A shared node can't be modified: parse the expression again to have a
+    // node owned by this expression.
     gd::ExpressionParser2 parser = ExpressionParser2();
     node = std::move(parser.ParseExpression(plainString));
+    isNodeShared = false;
+  }
+  return node.get();
+}
+
+ExpressionNode* Expression::GetRootNode(
+    gd::ParsedExpressionsCache& cache) const {
+  if (!node) {
+    node = cache.GetRootNode(plainString);
+    isNodeShared = true;
   }
   return node.get();
 }
@@ -13,6 +13,7 @@
 namespace gd {
 class ExpressionParser2;
 class ObjectsContainer;
+class ParsedExpressionsCache;
 struct ExpressionNode;
 }  // namespace gd
 
@@ -62,9 +63,20 @@ class GD_CORE_API Expression {
   /**
    * @brief Get the expression node.
    * @return std::unique_ptr<gd::ExpressionNode>
+   *
+   * \note The node is owned by this expression and can be modified.
    */
   gd::ExpressionNode* GetRootNode() const;
 
+  /**
+   * @brief Get the expression node, shared with the other expressions having
+   * the same text thanks to the given cache.
+   *
+   * \warning The node must not be modified: use GetRootNode() without a cache
+   * to get a node that can be modified.
+   */
+  gd::ExpressionNode* GetRootNode(gd::ParsedExpressionsCache& cache) const;
+
   /**
    * \brief Mimics std::string::c_str
    */
@@ -74,7 +86,9 @@ class GD_CORE_API Expression {
 
  private:
   gd::String plainString;  ///< The expression string
-  mutable std::unique_ptr<gd::ExpressionNode> node;
+  mutable std::shared_ptr<gd::ExpressionNode> node;
+  mutable bool isNodeShared;  ///< True if node comes from a
+                              ///< gd::ParsedExpressionsCache.
 };
 
 }  // namespace gd
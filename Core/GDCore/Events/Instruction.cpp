@@ -12,6 +12,7 @@
 
 #include "GDCore/Events/Expression.h"
 #include "GDCore/Events/InstructionsList.h"
+#include "GDCore/IDE/Events/EventsReferencesIndex.h"
 #include "GDCore/String.h"
 
 namespace gd {
@@ -41,10 +42,16 @@ gd::Expression& Instruction::GetParameter(std::size_t index) {
   return parameters[index];
 }
 
+void Instruction::SetType(const gd::String& newType) {
+  type = gd::InternedString(newType);
+  gd::EventsReferencesIndex::NotifyInstructionChanged(*this);
+}
+
 void Instruction::SetParametersCount(std::size_t size) {
   while (size < parameters.size())
     parameters.erase(parameters.begin() + parameters.size() - 1);
   while (size > parameters.size()) parameters.push_back(gd::Expression(""));
+  gd::EventsReferencesIndex::NotifyInstructionChanged(*this);
 }
 
 void Instruction::SetParameter(std::size_t nb, const gd::Expression& val) {
@@ -53,10 +60,17 @@ void Instruction::SetParameter(std::size_t nb, const gd::Expression& val) {
     return;
   }
   parameters[nb] = val;
+  gd::EventsReferencesIndex::NotifyInstructionChanged(*this);
 }
 
 void Instruction::AddParameter(const gd::Expression& val) {
   parameters.push_back(val);
+  gd::EventsReferencesIndex::NotifyInstructionChanged(*this);
+}
+
+void Instruction::SetParameters(const std::vector<gd::Expression>& val) {
+  parameters = val;
+  gd::EventsReferencesIndex::NotifyInstructionChanged(*this);
 }
 
 std::shared_ptr<Instruction> GD_CORE_API
@@ -10,7 +10,9 @@
 
 #include "GDCore/Events/Expression.h"
 #include "GDCore/Events/InstructionsList.h"
+#include "GDCore/IDE/Events/EventsReferencesIndexFlag.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 
 namespace gd {
 
@@ -52,13 +54,19 @@ class GD_CORE_API Instruction {
    * \brief Return the type of the instruction.
    * \return The type of the instruction
    */
-  const gd::String& GetType() const { return type; }
+  const gd::String& GetType() const { return type.GetString(); }
+
+  /**
+   * \brief Return the type of the instruction, as an interned string so that
+   * it can be compared or used as a key in constant time.
+   */
+  const gd::InternedString& GetInternedType() const { return type; }
 
   /**
    * \brief Change the instruction type
    * \param val The new type of the instruction
    */
-  void SetType(const gd::String& newType) { type = newType; }
+  void SetType(const gd::String& newType);
 
   /**
    * \brief Return true if the condition is inverted
@@ -114,6 +122,8 @@ class GD_CORE_API Instruction {
    *
    * Return an empty expression if the parameter requested does not exists.
    * \return The current value of the parameter.
+   * \note Prefer SetParameter to modify the parameter, so that
+   * gd::EventsReferencesIndex is notified of the change.
    */
   gd::Expression& GetParameter(std::size_t index);
 
@@ -138,9 +148,7 @@ class GD_CORE_API Instruction {
   /** \brief Replace all the parameters by new ones.
    * \param val A vector containing the new parameters.
    */
-  inline void SetParameters(const std::vector<gd::Expression>& val) {
-    parameters = val;
-  }
+  void SetParameters(const std::vector<gd::Expression>& val);
 
   /**
    * \brief Return a reference to the vector containing sub instructions
@@ -164,11 +172,19 @@ class GD_CORE_API Instruction {
     return originalInstruction;
   };
 
+  /**
+   * \brief Return the flag telling if the instruction is indexed by a
+   * gd::EventsReferencesIndex.
+   */
+  const gd::EventsReferencesIndexFlag& GetEventsReferencesIndexFlag() const {
+    return eventsReferencesIndexFlag;
+  };
+
   friend std::shared_ptr<Instruction> CloneRememberingOriginalElement(
       std::shared_ptr<Instruction> instruction);
 
  private:
-  gd::String type;  ///< Instruction type
+  gd::InternedString type;  ///< Instruction type
   bool inverted;  ///< True if the instruction if inverted. Only applicable for
                   ///< instruction used as conditions by events
   bool awaitAsync =
@@ -184,6 +200,7 @@ class GD_CORE_API Instruction {
                             ///< ensure the stability of code generation (as
                             ///< some part of code generation uses the pointer
                             ///< to the instruction as a unique identifier).
+  gd::EventsReferencesIndexFlag eventsReferencesIndexFlag;
 
   static gd::Expression badExpression;
 };
@@ -7,6 +7,7 @@
 #include "InstructionsList.h"
 
 #include "GDCore/Events/Instruction.h"
+#include "GDCore/IDE/Events/EventsReferencesIndex.h"
 #include "GDCore/Project/Project.h"
 #include "Serialization.h"
 
@@ -30,10 +31,16 @@ void InstructionsList::InsertInstructions(const InstructionsList& list,
     else
       elements.push_back(copiedInstruction);
   }
+  OnElementsChanged();
 }
 
 void InstructionsList::RemoveAfter(const size_t position) {
   elements.resize(position);
+  OnElementsChanged();
+}
+
+void InstructionsList::OnElementsChanged() {
+  gd::EventsReferencesIndex::NotifyInstructionsListChanged(*this);
 }
 
 void InstructionsList::SerializeTo(SerializerElement& element) const {
@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_INSTRUCTIONSLIST_H
 #define GDCORE_INSTRUCTIONSLIST_H
+#include "GDCore/IDE/Events/EventsReferencesIndexFlag.h"
 #include "GDCore/Tools/SPtrList.h"
 #include <memory>
 #include <vector>
@@ -45,6 +46,20 @@ public:
   void UnserializeFrom(gd::Project &project,
                        const gd::SerializerElement &element);
   ///@}
+
+  /**
+   * \brief Return the flag telling if the list is indexed by a
+   * gd::EventsReferencesIndex.
+   */
+  const gd::EventsReferencesIndexFlag &GetEventsReferencesIndexFlag() const {
+    return eventsReferencesIndexFlag;
+  };
+
+protected:
+  void OnElementsChanged() override;
+
+private:
+  gd::EventsReferencesIndexFlag eventsReferencesIndexFlag;
 };
 
 } // namespace gd
@@ -25,9 +25,10 @@ using namespace std;
 namespace gd {
 
 gd::String ExpressionParser2::NAMESPACE_SEPARATOR = "::";
+std::u32string ExpressionParser2::NAMESPACE_SEPARATOR_UTF32 = U"::";
 
 ExpressionParser2::ExpressionParser2()
-    : expression(""),
+    : expression(U""),
       currentPosition(0) {}
 
 std::unique_ptr<TextNode> ExpressionParser2::ReadText() {
@@ -7,6 +7,7 @@
 #define GDCORE_EXPRESSIONPARSER2_H
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -57,7 +58,10 @@ class GD_CORE_API ExpressionParser2 {
    */
   std::unique_ptr<ExpressionNode> ParseExpression(
       const gd::String &expression_) {
-    expression = expression_;
+    // Decode the expression once: indexing a gd::String is O(n) (as UTF-8 is
+    // a variable length encoding), which would make parsing quadratic.
+    // Positions are still code point indices in the original expression.
+    expression = expression_.ToUTF32();
 
     currentPosition = 0;
     return Start();
@@ -539,7 +543,7 @@ class GD_CORE_API ExpressionParser2 {
       gd::String::value_type operatorChar) {
     if (operatorChar == '+' || operatorChar == '-' || operatorChar == '/' ||
         operatorChar == '*') {
-      return gd::make_unique<ExpressionParserDiagnostic>();
+      return nullptr;
     }
     return gd::make_unique<ExpressionParserError>(
         "invalid_operator",
@@ -552,7 +556,7 @@ class GD_CORE_API ExpressionParser2 {
       gd::String::value_type operatorChar,
       size_t position) {
     if (operatorChar == '+' || operatorChar == '-') {
-      return gd::make_unique<ExpressionParserDiagnostic>();
+      return nullptr;
     }
 
     return gd::make_unique<ExpressionParserError>(
@@ -592,7 +596,7 @@ class GD_CORE_API ExpressionParser2 {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
     if (IsNamespaceSeparator()) {
-      currentPosition += NAMESPACE_SEPARATOR.size();
+      currentPosition += NAMESPACE_SEPARATOR_UTF32.size();
     }
 
     return ExpressionParserLocation(startPosition, currentPosition);
@@ -698,9 +702,11 @@ class GD_CORE_API ExpressionParser2 {
   bool IsNamespaceSeparator() {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
-    return (currentPosition + NAMESPACE_SEPARATOR.size() <= expression.size() &&
-            expression.substr(currentPosition, NAMESPACE_SEPARATOR.size()) ==
-                NAMESPACE_SEPARATOR);
+    return (currentPosition + NAMESPACE_SEPARATOR_UTF32.size() <=
+                expression.size() &&
+            expression.compare(currentPosition,
+                               NAMESPACE_SEPARATOR_UTF32.size(),
+                               NAMESPACE_SEPARATOR_UTF32) == 0);
   }
 
   bool IsEndReached() { return currentPosition >= expression.size(); }
@@ -806,10 +812,12 @@ class GD_CORE_API ExpressionParser2 {
   }
   ///@}
 
-  gd::String expression;
+  std::u32string expression;  ///< The expression being parsed, decoded to
+                              ///< code points for O(1) access.
   std::size_t currentPosition;
 
   static gd::String NAMESPACE_SEPARATOR;
+  static std::u32string NAMESPACE_SEPARATOR_UTF32;
 };
 
 }  // namespace gd
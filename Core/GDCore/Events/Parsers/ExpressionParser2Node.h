@@ -11,6 +11,7 @@
 
 #include "ExpressionParser2NodeWorker.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/SmallObjectsPool.h"
 namespace gd {
 class Expression;
 class ObjectsContainer;
@@ -45,6 +46,14 @@ struct GD_CORE_API ExpressionParserLocation {
  */
 struct GD_CORE_API ExpressionParserDiagnostic {
   virtual ~ExpressionParserDiagnostic() = default;
+
+  static void *operator new(std::size_t size) {
+    return gd::SmallObjectsPool::Allocate(size);
+  }
+  static void operator delete(void *ptr, std::size_t size) {
+    gd::SmallObjectsPool::Deallocate(ptr, size);
+  }
+
   virtual bool IsError() { return false; }
   virtual const gd::String &GetMessage() { return noMessage; }
   virtual size_t GetStartPosition() { return 0; }
@@ -89,12 +98,22 @@ struct GD_CORE_API ExpressionParserError : public ExpressionParserDiagnostic {
 /**
  * \brief The base node, from which all nodes in the tree of
  * an expression inherits from.
+ *
+ * Nodes (and their diagnostics) are allocated with gd::SmallObjectsPool, as
+ * a lot of them are created and destroyed when expressions are parsed.
  */
 struct GD_CORE_API ExpressionNode {
   ExpressionNode() : parent(nullptr) {};
   virtual ~ExpressionNode(){};
   virtual void Visit(ExpressionParser2NodeWorker &worker){};
 
+  static void *operator new(std::size_t size) {
+    return gd::SmallObjectsPool::Allocate(size);
+  }
+  static void operator delete(void *ptr, std::size_t size) {
+    gd::SmallObjectsPool::Deallocate(ptr, size);
+  }
+
   std::unique_ptr<ExpressionParserDiagnostic> diagnostic;
   ExpressionParserLocation location;  ///< The location of the entire node. Some
                                       /// nodes might have other locations
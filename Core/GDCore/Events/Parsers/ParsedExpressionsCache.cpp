@@ -0,0 +1,92 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ParsedExpressionsCache.h"
+
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+
+namespace gd {
+
+ParsedExpressionsCache::ParsedExpressionsCache(std::size_t maximumSize_)
+    : maximumSize(maximumSize_), hitsCount(0), missesCount(0) {}
+
+ParsedExpressionsCache::ParsedExpressionsCache(
+    const ParsedExpressionsCache& other)
+    : maximumSize(other.maximumSize), hitsCount(0), missesCount(0) {}
+
+ParsedExpressionsCache& ParsedExpressionsCache::operator=(
+    const ParsedExpressionsCache& other) {
+  if (this != &other) {
+    Clear();
+    SetMaximumSize(other.maximumSize);
+    ResetCounters();
+  }
+
+  return *this;
+}
+
+std::shared_ptr<gd::ExpressionNode> ParsedExpressionsCache::GetRootNode(
+    const gd::String& expression) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entriesByExpression.find(expression);
+    if (it != entriesByExpression.end()) {
+      hitsCount++;
+      entries.splice(entries.begin(), entries, it->second);
+      return it->second->second;
+    }
+    missesCount++;
+  }
+
+  // Parse outside of the lock, so that other expressions can still be read
+  // from the cache in the meantime.
+  gd::ExpressionParser2 parser;
+  std::shared_ptr<gd::ExpressionNode> node = parser.ParseExpression(expression);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = entriesByExpression.find(expression);
+  if (it != entriesByExpression.end()) {
+    // The same expression was parsed in the meantime.
+    return it->second->second;
+  }
+
+  entries.emplace_front(expression, node);
+  entriesByExpression.emplace(expression, entries.begin());
+  RemoveLeastRecentlyUsedEntries();
+  return node;
+}
+
+void ParsedExpressionsCache::SetMaximumSize(std::size_t maximumSize_) {
+  std::lock_guard<std::mutex> lock(mutex);
+  maximumSize = maximumSize_;
+  RemoveLeastRecentlyUsedEntries();
+}
+
+std::size_t ParsedExpressionsCache::GetSize() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return entries.size();
+}
+
+void ParsedExpressionsCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.clear();
+  entriesByExpression.clear();
+}
+
+void ParsedExpressionsCache::ResetCounters() {
+  std::lock_guard<std::mutex> lock(mutex);
+  hitsCount = 0;
+  missesCount = 0;
+}
+
+void ParsedExpressionsCache::RemoveLeastRecentlyUsedEntries() {
+  while (entries.size() > maximumSize) {
+    entriesByExpression.erase(entries.back().first);
+    entries.pop_back();
+  }
+}
+
+}  // namespace gd
@@ -0,0 +1,116 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_PARSEDEXPRESSIONSCACHE_H
+#define GDCORE_PARSEDEXPRESSIONSCACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "GDCore/String.h"
+namespace gd {
+struct ExpressionNode;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A cache of the trees of nodes of parsed expressions, shared by all
+ * the expressions having the same text.
+ *
+ * Identical expressions are frequent in a project (`Player.X()`...), so
+ * workers that only read the nodes (code generation, validation, analysis of
+ * the events...) can parse each distinct expression only once by getting the
+ * nodes from this cache (see gd::Expression::GetRootNode).
+ *
+ * The cache is bounded: when it's full, the least recently used expressions
+ * are removed from it.
+ *
+ * \warning The nodes returned by the cache are shared and must not be
+ * modified.
+ *
+ * \see gd::Project::GetParsedExpressionsCache
+ * \see gd::Expression
+ */
+class GD_CORE_API ParsedExpressionsCache {
+ public:
+  ParsedExpressionsCache(std::size_t maximumSize = 20000);
+
+  /**
+   * \brief Copying a cache creates an empty cache with the same maximum size.
+   */
+  ParsedExpressionsCache(const ParsedExpressionsCache& other);
+  ParsedExpressionsCache& operator=(const ParsedExpressionsCache& other);
+
+  virtual ~ParsedExpressionsCache(){};
+
+  /**
+   * \brief Return the root node of the parsed \a expression, parsing it only
+   * if it's not in the cache.
+   *
+   * \warning The node must not be modified.
+   */
+  std::shared_ptr<gd::ExpressionNode> GetRootNode(const gd::String& expression);
+
+  /**
+   * \brief Change the maximum number of expressions in the cache.
+   */
+  void SetMaximumSize(std::size_t maximumSize_);
+
+  /**
+   * \brief Return the maximum number of expressions in the cache.
+   */
+  std::size_t GetMaximumSize() const { return maximumSize; }
+
+  /**
+   * \brief Return the number of expressions in the cache.
+   */
+  std::size_t GetSize() const;
+
+  /**
+   * \brief Remove all the expressions from the cache.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the number of expressions that were found in the cache.
+   */
+  std::size_t GetHitsCount() const { return hitsCount; }
+
+  /**
+   * \brief Return the number of expressions that had to be parsed.
+   */
+  std::size_t GetMissesCount() const { return missesCount; }
+
+  /**
+   * \brief Reset the hits and misses counters to 0.
+   */
+  void ResetCounters();
+
+ private:
+  typedef std::list<
+      std::pair<gd::String, std::shared_ptr<gd::ExpressionNode>>>
+      Entries;
+
+  void RemoveLeastRecentlyUsedEntries();
+
+  Entries entries;  ///< The cached nodes, the most recently used first.
+  std::unordered_map<gd::String, Entries::iterator>
+      entriesByExpression;  ///< The position of each expression in entries.
+  std::size_t maximumSize;
+  std::atomic<std::size_t> hitsCount;  ///< Atomic, as it can be read while
+                                       ///< the cache is used by other threads.
+  std::atomic<std::size_t> missesCount;
+  mutable std::mutex mutex;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_PARSEDEXPRESSIONSCACHE_H
@@ -121,9 +121,9 @@ void EventsListSerialization::UpdateInstructionsFromGD2x(
     const gd::InstructionMetadata& metadata =
         instructionsAreActions
             ? MetadataProvider::GetActionMetadata(project.GetCurrentPlatform(),
-                                                  instr.GetType())
+                                                  instr.GetInternedType())
             : MetadataProvider::GetConditionMetadata(
-                  project.GetCurrentPlatform(), instr.GetType());
+                  project.GetCurrentPlatform(), instr.GetInternedType());
 
     // Specific updates for some instructions
     if (instr.GetType() == "LinkedObjects::LinkObjects" ||
@@ -24,7 +24,8 @@ ExpressionMetadata::ExpressionMetadata(const gd::String& returnType_,
       smallIconFilename(smallicon_),
       extensionNamespace(extensionNamespace_),
       isPrivate(false),
-      relevantContext("Any") {
+      relevantContext("Any"),
+      isPure(false) {
 }
 
 ExpressionMetadata& ExpressionMetadata::SetHidden() {
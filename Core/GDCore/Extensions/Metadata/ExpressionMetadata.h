@@ -9,6 +9,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
@@ -18,6 +19,30 @@ class Layout;
 }
 
 namespace gd {
+/**
+ * \brief A number or a string, given to and returned by the evaluation of a
+ * pure expression.
+ *
+ * \see gd::ExpressionMetadata::SetPure
+ */
+class GD_CORE_API ExpressionConstantValue {
+ public:
+  ExpressionConstantValue() : isString(false), number(0){};
+  ExpressionConstantValue(double number_) : isString(false), number(number_){};
+  ExpressionConstantValue(const gd::String& string_)
+      : isString(true), number(0), string(string_){};
+  virtual ~ExpressionConstantValue(){};
+
+  bool IsString() const { return isString; }
+  double GetNumber() const { return number; }
+  const gd::String& GetString() const { return string; }
+
+ private:
+  bool isString;
+  double number;
+  gd::String string;
+};
+
 /**
  * \brief Information about how generate code for an expression
  */
@@ -63,7 +88,7 @@ class GD_CORE_API ExpressionMetadata : public gd::AbstractFunctionMetadata {
    * to fulfill std::map requirements.
    */
   ExpressionMetadata()
-      : returnType("unknown"), shown(false), isPrivate(false), relevantContext("Any"){};
+      : returnType("unknown"), shown(false), isPrivate(false), relevantContext("Any"), isPure(false){};
 
   virtual ~ExpressionMetadata(){};
 
@@ -341,6 +366,41 @@ class GD_CORE_API ExpressionMetadata : public gd::AbstractFunctionMetadata {
 
   bool HasCustomCodeGenerator() const { return codeExtraInformation.hasCustomCodeGenerator; }
 
+  /**
+   * \brief Set that the expression is pure: it has no side effect and its
+   * result only depends on its parameters, which are numbers or strings.
+   *
+   * When all the parameters are constants, the expression is evaluated while
+   * generating code (and replaced by its result).
+   *
+   * \param evaluator The function computing the result, like the function
+   * called at runtime does. It returns false if the result can't be computed.
+   */
+  ExpressionMetadata& SetPure(
+      std::function<bool(const std::vector<gd::ExpressionConstantValue>& parameters,
+                         gd::ExpressionConstantValue& result)>
+          evaluator) {
+    isPure = true;
+    pureEvaluator = evaluator;
+    return *this;
+  }
+
+  /**
+   * \brief Return true if the expression is pure.
+   * \see gd::ExpressionMetadata::SetPure
+   */
+  bool IsPure() const { return isPure; }
+
+  /**
+   * \brief Compute the result of a pure expression for the given parameters.
+   * \return false if the expression is not pure or the result can't be
+   * computed.
+   */
+  bool EvaluatePure(const std::vector<gd::ExpressionConstantValue>& parameters,
+                    gd::ExpressionConstantValue& result) const {
+    return isPure && pureEvaluator && pureEvaluator(parameters, result);
+  }
+
   /**
    * \brief Return the structure containing the information about code
    * generation for the expression.
@@ -366,6 +426,10 @@ class GD_CORE_API ExpressionMetadata : public gd::AbstractFunctionMetadata {
   bool isPrivate;
   gd::String requiredBaseObjectCapability;
   gd::String relevantContext;
+  bool isPure;
+  std::function<bool(const std::vector<gd::ExpressionConstantValue>& parameters,
+                     gd::ExpressionConstantValue& result)>
+      pureEvaluator;
 };
 
 }  // namespace gd
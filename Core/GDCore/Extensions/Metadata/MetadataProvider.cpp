@@ -28,16 +28,60 @@ gd::InstructionMetadata MetadataProvider::badInstructionMetadata;
 gd::ExpressionMetadata MetadataProvider::badExpressionMetadata;
 gd::PlatformExtension MetadataProvider::badExtension;
 
+namespace {
+/**
+ * Find the instruction or expression in the index of the platform, or
+ * return the given "bad" extension and metadata.
+ */
+template <class Index, class Key, class T>
+ExtensionAndMetadata<T> FindInIndex(const Index& index,
+                                    const Key& type,
+                                    const gd::PlatformExtension& badExtension,
+                                    const T& badMetadata) {
+  auto it = index.find(type);
+  if (it == index.end())
+    return ExtensionAndMetadata<T>(badExtension, badMetadata);
+
+  return ExtensionAndMetadata<T>(*it->second.first, *it->second.second);
+}
+
+/**
+ * Find the expression of the object or behavior in the index of the
+ * platform. If not found, search in the expressions of the base object (or
+ * base behavior).
+ */
+ExtensionAndMetadata<ExpressionMetadata> FindInIndex(
+    const std::unordered_map<gd::String,
+                             Platform::MetadataIndex<ExpressionMetadata>>&
+        indexByOwnerType,
+    const gd::String& ownerType,
+    const gd::String& exprType,
+    const gd::PlatformExtension& badExtension,
+    const ExpressionMetadata& badMetadata) {
+  auto it = indexByOwnerType.find(ownerType);
+  if (it != indexByOwnerType.end()) {
+    auto exprIt = it->second.find(exprType);
+    if (exprIt != it->second.end())
+      return ExtensionAndMetadata<ExpressionMetadata>(*exprIt->second.first,
+                                                      *exprIt->second.second);
+  }
+
+  // Then check base
+  auto baseIt = indexByOwnerType.find("");
+  if (baseIt != indexByOwnerType.end())
+    return FindInIndex(baseIt->second, exprType, badExtension, badMetadata);
+
+  return ExtensionAndMetadata<ExpressionMetadata>(badExtension, badMetadata);
+}
+}  // namespace
+
 ExtensionAndMetadata<BehaviorMetadata>
 MetadataProvider::GetExtensionAndBehaviorMetadata(const gd::Platform& platform,
                                                   gd::String behaviorType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    if (extension->HasBehavior(behaviorType))
-      return ExtensionAndMetadata<BehaviorMetadata>(
-          *extension, extension->GetBehaviorMetadata(behaviorType));
-  }
-
-  return ExtensionAndMetadata<BehaviorMetadata>(badExtension, badBehaviorMetadata);
+  return FindInIndex(platform.GetInstructionsAndExpressionsIndex().behaviors,
+                     behaviorType,
+                     badExtension,
+                     badBehaviorMetadata);
 }
 
 const BehaviorMetadata& MetadataProvider::GetBehaviorMetadata(
@@ -48,16 +92,10 @@ const BehaviorMetadata& MetadataProvider::GetBehaviorMetadata(
 ExtensionAndMetadata<ObjectMetadata>
 MetadataProvider::GetExtensionAndObjectMetadata(const gd::Platform& platform,
                                                 gd::String objectType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto objectsTypes = extension->GetExtensionObjectsTypes();
-    for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
-      if (objectsTypes[j] == objectType)
-        return ExtensionAndMetadata<ObjectMetadata>(
-            *extension, extension->GetObjectMetadata(objectType));
-    }
-  }
-
-  return ExtensionAndMetadata<ObjectMetadata>(badExtension, badObjectInfo);
+  return FindInIndex(platform.GetInstructionsAndExpressionsIndex().objects,
+                     objectType,
+                     badExtension,
+                     badObjectInfo);
 }
 
 const ObjectMetadata& MetadataProvider::GetObjectMetadata(
@@ -88,34 +126,10 @@ const EffectMetadata& MetadataProvider::GetEffectMetadata(
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndActionMetadata(const gd::Platform& platform,
                                                 gd::String actionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allActions = extension->GetAllActions();
-    if (allActions.find(actionType) != allActions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allActions.find(actionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjectsActions =
-          extension->GetAllActionsForObject(extObjectType);
-      if (allObjectsActions.find(actionType) != allObjectsActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjectsActions.find(actionType)->second);
-    }
-
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosActions =
-          extension->GetAllActionsForBehavior(autos[j]);
-      if (allAutosActions.find(actionType) != allAutosActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosActions.find(actionType)->second);
-    }
-  }
-
-  return ExtensionAndMetadata<InstructionMetadata>(badExtension,
-                                                   badInstructionMetadata);
+  return FindInIndex(platform.GetInstructionsAndExpressionsIndex().actions,
+                     actionType,
+                     badExtension,
+                     badInstructionMetadata);
 }
 
 const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
@@ -126,38 +140,75 @@ const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndConditionMetadata(const gd::Platform& platform,
                                                    gd::String conditionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allConditions = extension->GetAllConditions();
-    if (allConditions.find(conditionType) != allConditions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allConditions.find(conditionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjectsConditions =
-          extension->GetAllConditionsForObject(extObjectType);
-      if (allObjectsConditions.find(conditionType) != allObjectsConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjectsConditions.find(conditionType)->second);
-    }
+  return FindInIndex(platform.GetInstructionsAndExpressionsIndex().conditions,
+                     conditionType,
+                     badExtension,
+                     badInstructionMetadata);
+}
 
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosConditions =
-          extension->GetAllConditionsForBehavior(autos[j]);
-      if (allAutosConditions.find(conditionType) != allAutosConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosConditions.find(conditionType)->second);
-    }
-  }
+const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
+    const gd::Platform& platform, gd::String conditionType) {
+  return GetExtensionAndConditionMetadata(platform, conditionType)
+      .GetMetadata();
+}
+
+ExtensionAndMetadata<BehaviorMetadata>
+MetadataProvider::GetExtensionAndBehaviorMetadata(
+    const gd::Platform& platform, const gd::InternedString& behaviorType) {
+  return FindInIndex(
+      platform.GetInstructionsAndExpressionsIndex().behaviorsByInternedType,
+      behaviorType,
+      badExtension,
+      badBehaviorMetadata);
+}
+
+ExtensionAndMetadata<ObjectMetadata>
+MetadataProvider::GetExtensionAndObjectMetadata(
+    const gd::Platform& platform, const gd::InternedString& type) {
+  return FindInIndex(
+      platform.GetInstructionsAndExpressionsIndex().objectsByInternedType,
+      type,
+      badExtension,
+      badObjectInfo);
+}
+
+ExtensionAndMetadata<InstructionMetadata>
+MetadataProvider::GetExtensionAndActionMetadata(
+    const gd::Platform& platform, const gd::InternedString& actionType) {
+  return FindInIndex(
+      platform.GetInstructionsAndExpressionsIndex().actionsByInternedType,
+      actionType,
+      badExtension,
+      badInstructionMetadata);
+}
+
+ExtensionAndMetadata<InstructionMetadata>
+MetadataProvider::GetExtensionAndConditionMetadata(
+    const gd::Platform& platform, const gd::InternedString& conditionType) {
+  return FindInIndex(
+      platform.GetInstructionsAndExpressionsIndex().conditionsByInternedType,
+      conditionType,
+      badExtension,
+      badInstructionMetadata);
+}
+
+const BehaviorMetadata& MetadataProvider::GetBehaviorMetadata(
+    const gd::Platform& platform, const gd::InternedString& behaviorType) {
+  return GetExtensionAndBehaviorMetadata(platform, behaviorType).GetMetadata();
+}
+
+const ObjectMetadata& MetadataProvider::GetObjectMetadata(
+    const gd::Platform& platform, const gd::InternedString& type) {
+  return GetExtensionAndObjectMetadata(platform, type).GetMetadata();
+}
 
-  return ExtensionAndMetadata<InstructionMetadata>(badExtension,
-                                                   badInstructionMetadata);
+const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
+    const gd::Platform& platform, const gd::InternedString& actionType) {
+  return GetExtensionAndActionMetadata(platform, actionType).GetMetadata();
 }
 
 const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
-    const gd::Platform& platform, gd::String conditionType) {
+    const gd::Platform& platform, const gd::InternedString& conditionType) {
   return GetExtensionAndConditionMetadata(platform, conditionType)
       .GetMetadata();
 }
@@ -165,29 +216,12 @@ const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
-      const auto& allObjectExpressions =
-          extension->GetAllExpressionsForObject(objectType);
-      if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allObjectExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check base
-  for (auto& extension : extensions) {
-    const auto& allObjectExpressions =
-        extension->GetAllExpressionsForObject("");
-    if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allObjectExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return FindInIndex(
+      platform.GetInstructionsAndExpressionsIndex().objectsExpressions,
+      objectType,
+      exprType,
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetObjectExpressionMetadata(
@@ -199,28 +233,12 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorExpressionMetadata(
     const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    if (extension->HasBehavior(autoType)) {
-      const auto& allAutoExpressions =
-          extension->GetAllExpressionsForBehavior(autoType);
-      if (allAutoExpressions.find(exprType) != allAutoExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allAutoExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check base
-  for (auto& extension : extensions) {
-    const auto& allAutoExpressions =
-        extension->GetAllExpressionsForBehavior("");
-    if (allAutoExpressions.find(exprType) != allAutoExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allAutoExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return FindInIndex(
+      platform.GetInstructionsAndExpressionsIndex().behaviorsExpressions,
+      autoType,
+      exprType,
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetBehaviorExpressionMetadata(
@@ -232,16 +250,10 @@ const gd::ExpressionMetadata& MetadataProvider::GetBehaviorExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndExpressionMetadata(
     const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allExpr = extension->GetAllExpressions();
-    if (allExpr.find(exprType) != allExpr.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allExpr.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return FindInIndex(platform.GetInstructionsAndExpressionsIndex().expressions,
+                     exprType,
+                     badExtension,
+                     badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetExpressionMetadata(
@@ -252,30 +264,12 @@ const gd::ExpressionMetadata& MetadataProvider::GetExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectStrExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
-      const auto& allObjectStrExpressions =
-          extension->GetAllStrExpressionsForObject(objectType);
-      if (allObjectStrExpressions.find(exprType) !=
-          allObjectStrExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allObjectStrExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& allObjectStrExpressions =
-        extension->GetAllStrExpressionsForObject("");
-    if (allObjectStrExpressions.find(exprType) != allObjectStrExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allObjectStrExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return FindInIndex(
+      platform.GetInstructionsAndExpressionsIndex().objectsStrExpressions,
+      objectType,
+      exprType,
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetObjectStrExpressionMetadata(
@@ -288,30 +282,12 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectStrExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorStrExpressionMetadata(
     const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    if (extension->HasBehavior(autoType)) {
-      const auto& allBehaviorStrExpressions =
-          extension->GetAllStrExpressionsForBehavior(autoType);
-      if (allBehaviorStrExpressions.find(exprType) !=
-          allBehaviorStrExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allBehaviorStrExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& allBehaviorStrExpressions =
-        extension->GetAllStrExpressionsForBehavior("");
-    if (allBehaviorStrExpressions.find(exprType) !=
-        allBehaviorStrExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allBehaviorStrExpressions.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return FindInIndex(
+      platform.GetInstructionsAndExpressionsIndex().behaviorsStrExpressions,
+      autoType,
+      exprType,
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata&
@@ -326,16 +302,11 @@ MetadataProvider::GetBehaviorStrExpressionMetadata(const gd::Platform& platform,
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndStrExpressionMetadata(
     const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allExpr = extension->GetAllStrExpressions();
-    if (allExpr.find(exprType) != allExpr.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allExpr.find(exprType)->second);
-  }
-
-  return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
-                                                  badExpressionMetadata);
+  return FindInIndex(
+      platform.GetInstructionsAndExpressionsIndex().strExpressions,
+      exprType,
+      badExtension,
+      badExpressionMetadata);
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetStrExpressionMetadata(
@@ -7,6 +7,7 @@
 #define METADATAPROVIDER_H
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 namespace gd {
 class BehaviorMetadata;
 class ObjectMetadata;
@@ -180,6 +181,32 @@ class GD_CORE_API MetadataProvider {
   static const gd::InstructionMetadata& GetConditionMetadata(
       const gd::Platform& platform, gd::String conditionType);
 
+  /** \name Metadata from interned types
+   * Same as the functions taking a gd::String, but using the interned type
+   * (see gd::Instruction::GetInternedType or
+   * gd::Behavior::GetInternedTypeName) to avoid hashing and comparing strings.
+   */
+  ///@{
+  static ExtensionAndMetadata<BehaviorMetadata> GetExtensionAndBehaviorMetadata(
+      const gd::Platform& platform, const gd::InternedString& behaviorType);
+  static ExtensionAndMetadata<ObjectMetadata> GetExtensionAndObjectMetadata(
+      const gd::Platform& platform, const gd::InternedString& type);
+  static ExtensionAndMetadata<InstructionMetadata>
+  GetExtensionAndActionMetadata(const gd::Platform& platform,
+                                const gd::InternedString& actionType);
+  static ExtensionAndMetadata<InstructionMetadata>
+  GetExtensionAndConditionMetadata(const gd::Platform& platform,
+                                   const gd::InternedString& conditionType);
+  static const BehaviorMetadata& GetBehaviorMetadata(
+      const gd::Platform& platform, const gd::InternedString& behaviorType);
+  static const ObjectMetadata& GetObjectMetadata(
+      const gd::Platform& platform, const gd::InternedString& type);
+  static const gd::InstructionMetadata& GetActionMetadata(
+      const gd::Platform& platform, const gd::InternedString& actionType);
+  static const gd::InstructionMetadata& GetConditionMetadata(
+      const gd::Platform& platform, const gd::InternedString& conditionType);
+  ///@}
+
   /**
    * Get information about an expression from its type
    * Works for free expressions.
@@ -5,6 +5,10 @@
  */
 #include "Platform.h"
 
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectConfiguration.h"
@@ -51,9 +55,112 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
     instructionOrExpressionGroupMetadata[it.first] = it.second;
   }
 
+  AddToInstructionsAndExpressionsIndex(*extension);
+
   return true;
 }
 
+namespace {
+template <class T>
+void AddToIndex(Platform::MetadataIndex<T>& index,
+                const gd::PlatformExtension& extension,
+                const std::map<gd::String, T>& allMetadata) {
+  for (const auto& it : allMetadata) {
+    index.emplace(it.first, std::make_pair(&extension, &it.second));
+  }
+}
+
+template <class T>
+void AddToIndex(Platform::InternedMetadataIndex<T>& index,
+                const gd::PlatformExtension& extension,
+                const std::map<gd::String, T>& allMetadata) {
+  for (const auto& it : allMetadata) {
+    index.emplace(gd::InternedString(it.first),
+                  std::make_pair(&extension, &it.second));
+  }
+}
+
+template <class T>
+void AddToIndexes(Platform::MetadataIndex<T>& index,
+                  Platform::InternedMetadataIndex<T>& internedIndex,
+                  const gd::PlatformExtension& extension,
+                  const gd::String& type,
+                  const T& metadata) {
+  auto value = std::make_pair(&extension, &metadata);
+  index.emplace(type, value);
+  internedIndex.emplace(gd::InternedString(type), value);
+}
+}  // namespace
+
+void Platform::AddToInstructionsAndExpressionsIndex(
+    gd::PlatformExtension& extension) {
+  // Instructions and expressions are indexed in the same order as they would
+  // be found by iterating over the extensions (free ones first, then the ones
+  // of objects and then the ones of behaviors): only the first one is kept
+  // in case of duplicates.
+  auto& index = instructionsAndExpressionsIndex;
+  AddToIndex(index.actions, extension, extension.GetAllActions());
+  AddToIndex(
+      index.actionsByInternedType, extension, extension.GetAllActions());
+  AddToIndex(index.conditions, extension, extension.GetAllConditions());
+  AddToIndex(
+      index.conditionsByInternedType, extension, extension.GetAllConditions());
+  AddToIndex(index.expressions, extension, extension.GetAllExpressions());
+  AddToIndex(index.strExpressions, extension, extension.GetAllStrExpressions());
+
+  for (const gd::String& objectType : extension.GetExtensionObjectsTypes()) {
+    AddToIndexes(index.objects,
+                 index.objectsByInternedType,
+                 extension,
+                 objectType,
+                 extension.GetObjectMetadata(objectType));
+    AddToIndex(index.actions,
+               extension,
+               extension.GetAllActionsForObject(objectType));
+    AddToIndex(index.actionsByInternedType,
+               extension,
+               extension.GetAllActionsForObject(objectType));
+    AddToIndex(index.conditions,
+               extension,
+               extension.GetAllConditionsForObject(objectType));
+    AddToIndex(index.conditionsByInternedType,
+               extension,
+               extension.GetAllConditionsForObject(objectType));
+    AddToIndex(index.objectsExpressions[objectType],
+               extension,
+               extension.GetAllExpressionsForObject(objectType));
+    AddToIndex(index.objectsStrExpressions[objectType],
+               extension,
+               extension.GetAllStrExpressionsForObject(objectType));
+  }
+
+  for (const gd::String& behaviorType : extension.GetBehaviorsTypes()) {
+    AddToIndexes(index.behaviors,
+                 index.behaviorsByInternedType,
+                 extension,
+                 behaviorType,
+                 extension.GetBehaviorMetadata(behaviorType));
+    AddToIndex(index.actions,
+               extension,
+               extension.GetAllActionsForBehavior(behaviorType));
+    AddToIndex(index.actionsByInternedType,
+               extension,
+               extension.GetAllActionsForBehavior(behaviorType));
+    AddToIndex(index.conditions,
+               extension,
+               extension.GetAllConditionsForBehavior(behaviorType));
+    AddToIndex(index.conditionsByInternedType,
+               extension,
+               extension.GetAllConditionsForBehavior(behaviorType));
+    AddToIndex(index.behaviorsExpressions[behaviorType],
+               extension,
+               extension.GetAllExpressionsForBehavior(behaviorType));
+    AddToIndex(index.behaviorsStrExpressions[behaviorType],
+               extension,
+               extension.GetAllStrExpressionsForBehavior(behaviorType));
+  }
+}
+
 void Platform::RemoveExtension(const gd::String& name) {
   // Unload all creation/destruction functions for objects provided by the
   // extension
@@ -74,6 +181,13 @@ void Platform::RemoveExtension(const gd::String& name) {
                   return extension->GetName() == name;
                 }),
       extensionsLoaded.end());
+
+  // Rebuild the index, as instructions or expressions of the removed
+  // extension may have hidden the ones of other extensions.
+  instructionsAndExpressionsIndex = InstructionsAndExpressionsIndex();
+  for (auto& extension : extensionsLoaded) {
+    AddToInstructionsAndExpressionsIndex(*extension);
+  }
 }
 
 bool Platform::IsExtensionLoaded(const gd::String& name) const {
@@ -8,10 +8,13 @@
 #define GDCORE_PLATFORM_H
 #include <map>
 #include <memory>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "GDCore/Extensions/Metadata/InstructionOrExpressionGroupMetadata.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 namespace gd {
 class InstructionsMetadataHolder;
 class Project;
@@ -20,6 +23,8 @@ class ObjectConfiguration;
 class Behavior;
 class BehaviorMetadata;
 class ObjectMetadata;
+class InstructionMetadata;
+class ExpressionMetadata;
 class BaseEvent;
 class BehaviorsSharedData;
 class PlatformExtension;
@@ -138,6 +143,78 @@ class GD_CORE_API Platform {
   }
   ///@}
 
+  /** \name Instructions and expressions index
+   * Index of the instructions and expressions declared by the extensions,
+   * used by gd::MetadataProvider to find their metadata without iterating
+   * over all the extensions.
+   */
+  ///@{
+  /**
+   * \brief Associate the type of instructions or expressions to the extension
+   * declaring them and their metadata.
+   */
+  template <class T>
+  using MetadataIndex = std::unordered_map<
+      gd::String,
+      std::pair<const gd::PlatformExtension*, const T*>>;
+
+  /**
+   * \brief Same as MetadataIndex, but using interned types as keys, to find
+   * the metadata of instructions, objects or behaviors from their interned
+   * type (see gd::Instruction::GetInternedType) without hashing the string.
+   */
+  template <class T>
+  using InternedMetadataIndex = std::unordered_map<
+      gd::InternedString,
+      std::pair<const gd::PlatformExtension*, const T*>>;
+
+  /**
+   * \brief The index of all the instructions and expressions (and objects
+   * and behaviors) of the loaded extensions.
+   *
+   * When multiple extensions declare an instruction or expression with the
+   * same type, the one of the first loaded extension is indexed. Object and
+   * behavior expressions are indexed by object/behavior type first.
+   *
+   * Objects, behaviors and instructions are also indexed by their interned
+   * type.
+   */
+  struct InstructionsAndExpressionsIndex {
+    MetadataIndex<ObjectMetadata> objects;
+    MetadataIndex<BehaviorMetadata> behaviors;
+    MetadataIndex<InstructionMetadata> actions;
+    MetadataIndex<InstructionMetadata> conditions;
+    MetadataIndex<ExpressionMetadata> expressions;
+    MetadataIndex<ExpressionMetadata> strExpressions;
+    std::unordered_map<gd::String, MetadataIndex<ExpressionMetadata>>
+        objectsExpressions;
+    std::unordered_map<gd::String, MetadataIndex<ExpressionMetadata>>
+        objectsStrExpressions;
+    std::unordered_map<gd::String, MetadataIndex<ExpressionMetadata>>
+        behaviorsExpressions;
+    std::unordered_map<gd::String, MetadataIndex<ExpressionMetadata>>
+        behaviorsStrExpressions;
+
+    InternedMetadataIndex<ObjectMetadata> objectsByInternedType;
+    InternedMetadataIndex<BehaviorMetadata> behaviorsByInternedType;
+    InternedMetadataIndex<InstructionMetadata> actionsByInternedType;
+    InternedMetadataIndex<InstructionMetadata> conditionsByInternedType;
+  };
+
+  /**
+   * \brief Return the index of the instructions and expressions of the
+   * loaded extensions.
+   *
+   * \note The index is updated when an extension is added or removed. An
+   * extension must not be modified after being added to the platform (add it
+   * again to take the changes into account).
+   */
+  const InstructionsAndExpressionsIndex& GetInstructionsAndExpressionsIndex()
+      const {
+    return instructionsAndExpressionsIndex;
+  }
+  ///@}
+
   /** \name Factory method
    * Member functions used to create the platform objects.
    * TODO: This could be moved to gd::MetadataProvider.
@@ -166,8 +243,17 @@ class GD_CORE_API Platform {
   };
 
  private:
+  /**
+   * \brief Add the instructions and expressions of the extension to the
+   * index. Instructions and expressions already indexed are kept.
+   */
+  void AddToInstructionsAndExpressionsIndex(gd::PlatformExtension& extension);
+
   std::vector<std::shared_ptr<PlatformExtension>>
       extensionsLoaded;  ///< Extensions of the platform
+  InstructionsAndExpressionsIndex
+      instructionsAndExpressionsIndex;  ///< Index of the instructions and
+                                        ///< expressions of the extensions
   std::map<gd::String, CreateFunPtr>
       creationFunctionTable;  ///< Creation functions for objects
   std::map<gd::String, InstructionOrExpressionGroupMetadata>
@@ -6,6 +6,7 @@
 #include "EventBasedBehaviorBrowser.h"
 
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersComposite.h"
 #include "GDCore/IDE/Project/ArbitraryEventBasedBehaviorsWorker.h"
 #include "GDCore/IDE/Project/ArbitraryEventsFunctionsWorker.h"
 #include "GDCore/IDE/Project/ArbitraryObjectsWorker.h"
@@ -29,6 +30,16 @@ void EventBasedBehaviorBrowser::ExposeEvents(
       project, eventsBasedBehavior, worker);
 }
 
+void EventBasedBehaviorBrowser::ExposeEvents(
+    gd::Project &project, gd::ArbitraryEventsWorkersComposite &worker) const {
+  // All the events of the behavior have a context, so the workers not needing
+  // it are given the same events as without the composite.
+  gd::ProjectBrowserHelper::ExposeEventsBasedBehaviorEvents(
+      project,
+      eventsBasedBehavior,
+      static_cast<gd::ArbitraryEventsWorkerWithContext &>(worker));
+}
+
 void EventBasedBehaviorBrowser::ExposeObjects(
     gd::Project &project, gd::ArbitraryObjectsWorker &worker) const {}
 
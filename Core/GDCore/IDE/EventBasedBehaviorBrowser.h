@@ -16,6 +16,7 @@ class EventsBasedBehavior;
 class EventsBasedObject;
 class ArbitraryEventsWorker;
 class ArbitraryEventsWorkerWithContext;
+class ArbitraryEventsWorkersComposite;
 class ArbitraryEventsFunctionsWorker;
 class ArbitraryObjectsWorker;
 class ArbitraryEventBasedBehaviorsWorker;
@@ -51,6 +52,14 @@ public:
   ExposeEvents(gd::Project &project,
                gd::ArbitraryEventsWorkerWithContext &worker) const override;
 
+  /**
+   * \brief Call the specified workers on all events of the event-based
+   * behavior, in a single traversal.
+   */
+  void
+  ExposeEvents(gd::Project &project,
+               gd::ArbitraryEventsWorkersComposite &worker) const override;
+
   /**
    * \brief Call the specified worker on all functions of the event-based behavior
    *
@@ -41,6 +41,8 @@ class GD_CORE_API ArbitraryEventsWorker : private EventVisitor {
   void Launch(gd::EventsList& events) { VisitEventList(events); };
 
  private:
+  friend class ArbitraryEventsWorkersComposite;
+
   void VisitEventList(gd::EventsList& events);
   bool VisitEvent(gd::BaseEvent& event) override;
   bool VisitLinkEvent(gd::LinkEvent& linkEvent) override;
@@ -130,6 +132,8 @@ class GD_CORE_API ArbitraryEventsWorkerWithContext
   };
 
  private:
+  friend class ArbitraryEventsWorkersComposite;
+
   const gd::ObjectsContainer* currentGlobalObjectsContainer;
   const gd::ObjectsContainer* currentObjectsContainer;
 };
@@ -156,6 +160,8 @@ protected:
   void StopAnyEventIteration() override;
 
  private:
+  friend class ReadOnlyArbitraryEventsWorkersComposite;
+
   void VisitEventList(const gd::EventsList& events);
   void VisitEvent(const gd::BaseEvent& event) override;
   void VisitLinkEvent(const gd::LinkEvent& linkEvent) override;
@@ -238,6 +244,8 @@ class GD_CORE_API ReadOnlyArbitraryEventsWorkerWithContext
   };
 
  private:
+  friend class ReadOnlyArbitraryEventsWorkersComposite;
+
   const gd::ObjectsContainer* currentGlobalObjectsContainer;
   const gd::ObjectsContainer* currentObjectsContainer;
 };
@@ -0,0 +1,191 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersComposite.h"
+
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+
+namespace gd {
+
+ArbitraryEventsWorkersComposite::~ArbitraryEventsWorkersComposite() {}
+
+ArbitraryEventsWorkersComposite& ArbitraryEventsWorkersComposite::AddWorker(
+    gd::ArbitraryEventsWorker& worker) {
+  workers.push_back(&worker);
+  workersWithContext.push_back(nullptr);
+  return *this;
+}
+
+ArbitraryEventsWorkersComposite& ArbitraryEventsWorkersComposite::AddWorker(
+    gd::ArbitraryEventsWorkerWithContext& worker) {
+  workers.push_back(&worker);
+  workersWithContext.push_back(&worker);
+  return *this;
+}
+
+void ArbitraryEventsWorkersComposite::LaunchWithoutContext(
+    gd::EventsList& events) {
+  isLaunchedWithoutContext = true;
+  ArbitraryEventsWorker::Launch(events);
+  isLaunchedWithoutContext = false;
+}
+
+void ArbitraryEventsWorkersComposite::DoVisitEventList(
+    gd::EventsList& events) {
+  if (!isLaunchedWithoutContext) {
+    for (auto* worker : workersWithContext) {
+      if (!worker) continue;
+
+      worker->currentGlobalObjectsContainer = &GetGlobalObjectsContainer();
+      worker->currentObjectsContainer = &GetObjectsContainer();
+    }
+  }
+
+  for (std::size_t i = 0; i < workers.size(); ++i) {
+    if (IsSkipped(i)) continue;
+    workers[i]->DoVisitEventList(events);
+  }
+}
+
+bool ArbitraryEventsWorkersComposite::DoVisitEvent(gd::BaseEvent& event) {
+  deletedEvent = nullptr;
+  for (std::size_t i = 0; i < workers.size(); ++i) {
+    if (IsSkipped(i)) continue;
+    if (workers[i]->DoVisitEvent(event)) {
+      // Link events are then visited by DoVisitLinkEvent: remember which
+      // workers were called with it.
+      deletedEvent = &event;
+      deletedEventWorkersCount = i + 1;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool ArbitraryEventsWorkersComposite::DoVisitLinkEvent(
+    gd::LinkEvent& linkEvent) {
+  std::size_t workersCount =
+      deletedEvent == &linkEvent ? deletedEventWorkersCount : workers.size();
+  deletedEvent = nullptr;
+
+  for (std::size_t i = 0; i < workersCount; ++i) {
+    if (IsSkipped(i)) continue;
+    if (workers[i]->DoVisitLinkEvent(linkEvent)) return true;
+  }
+
+  return false;
+}
+
+void ArbitraryEventsWorkersComposite::DoVisitInstructionList(
+    gd::InstructionsList& instructions, bool areConditions) {
+  for (std::size_t i = 0; i < workers.size(); ++i) {
+    if (IsSkipped(i)) continue;
+    workers[i]->DoVisitInstructionList(instructions, areConditions);
+  }
+}
+
+bool ArbitraryEventsWorkersComposite::DoVisitInstruction(
+    gd::Instruction& instruction, bool isCondition) {
+  for (std::size_t i = 0; i < workers.size(); ++i) {
+    if (IsSkipped(i)) continue;
+    if (workers[i]->DoVisitInstruction(instruction, isCondition)) return true;
+  }
+
+  return false;
+}
+
+ReadOnlyArbitraryEventsWorkersComposite::
+    ~ReadOnlyArbitraryEventsWorkersComposite() {}
+
+ReadOnlyArbitraryEventsWorkersComposite&
+ReadOnlyArbitraryEventsWorkersComposite::AddWorker(
+    gd::ReadOnlyArbitraryEventsWorker& worker) {
+  workers.push_back(&worker);
+  workersWithContext.push_back(nullptr);
+  return *this;
+}
+
+ReadOnlyArbitraryEventsWorkersComposite&
+ReadOnlyArbitraryEventsWorkersComposite::AddWorker(
+    gd::ReadOnlyArbitraryEventsWorkerWithContext& worker) {
+  workers.push_back(&worker);
+  workersWithContext.push_back(&worker);
+  return *this;
+}
+
+void ReadOnlyArbitraryEventsWorkersComposite::LaunchWithoutContext(
+    const gd::EventsList& events) {
+  isLaunchedWithoutContext = true;
+  ReadOnlyArbitraryEventsWorker::Launch(events);
+  isLaunchedWithoutContext = false;
+}
+
+void ReadOnlyArbitraryEventsWorkersComposite::StopIfAllWorkersStopped() {
+  for (auto* worker : workers) {
+    if (!worker->shouldStopIteration) return;
+  }
+
+  StopAnyEventIteration();
+}
+
+void ReadOnlyArbitraryEventsWorkersComposite::DoVisitEventList(
+    const gd::EventsList& events) {
+  if (!isLaunchedWithoutContext) {
+    for (auto* worker : workersWithContext) {
+      if (!worker) continue;
+
+      worker->currentGlobalObjectsContainer = &GetGlobalObjectsContainer();
+      worker->currentObjectsContainer = &GetObjectsContainer();
+    }
+  }
+
+  for (std::size_t i = 0; i < workers.size(); ++i) {
+    if (IsSkipped(i)) continue;
+    workers[i]->DoVisitEventList(events);
+  }
+  StopIfAllWorkersStopped();
+}
+
+void ReadOnlyArbitraryEventsWorkersComposite::DoVisitEvent(
+    const gd::BaseEvent& event) {
+  for (std::size_t i = 0; i < workers.size(); ++i) {
+    if (IsSkipped(i)) continue;
+    workers[i]->DoVisitEvent(event);
+  }
+  StopIfAllWorkersStopped();
+}
+
+void ReadOnlyArbitraryEventsWorkersComposite::DoVisitLinkEvent(
+    const gd::LinkEvent& linkEvent) {
+  for (std::size_t i = 0; i < workers.size(); ++i) {
+    if (IsSkipped(i)) continue;
+    workers[i]->DoVisitLinkEvent(linkEvent);
+  }
+  StopIfAllWorkersStopped();
+}
+
+void ReadOnlyArbitraryEventsWorkersComposite::DoVisitInstructionList(
+    const gd::InstructionsList& instructions, bool areConditions) {
+  for (std::size_t i = 0; i < workers.size(); ++i) {
+    if (IsSkipped(i)) continue;
+    workers[i]->DoVisitInstructionList(instructions, areConditions);
+  }
+  StopIfAllWorkersStopped();
+}
+
+void ReadOnlyArbitraryEventsWorkersComposite::DoVisitInstruction(
+    const gd::Instruction& instruction, bool isCondition) {
+  for (std::size_t i = 0; i < workers.size(); ++i) {
+    if (IsSkipped(i)) continue;
+    workers[i]->DoVisitInstruction(instruction, isCondition);
+  }
+  StopIfAllWorkersStopped();
+}
+
+}  // namespace gd
@@ -0,0 +1,181 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_ARBITRARYEVENTSWORKERSCOMPOSITE_H
+#define GDCORE_ARBITRARYEVENTSWORKERSCOMPOSITE_H
+#include <vector>
+
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+namespace gd {
+class BaseEvent;
+class EventsList;
+class Instruction;
+class InstructionsList;
+class LinkEvent;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Run several events workers in a single traversal of the events.
+ *
+ * The workers are called on each event (and instruction) in the order they
+ * were added, so that running them together gives the same result as running
+ * them one after the other, as long as the work done on an event only depends
+ * on this event:
+ * - when a worker asks for an event or an instruction to be deleted, the
+ * workers added after it are not called with it, like if they had been
+ * launched after the deletion.
+ * - the workers added before it are called with the event, but not with its
+ * sub-events and instructions, as these are deleted anyway.
+ *
+ * Workers needing the context (gd::ArbitraryEventsWorkerWithContext) are given
+ * the objects containers the composite is launched with.
+ *
+ * Use it with gd::ProjectBrowserHelper::ExposeProjectEvents to do several
+ * refactorings with a single traversal of the whole project.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ArbitraryEventsWorkersComposite
+    : public ArbitraryEventsWorkerWithContext {
+ public:
+  ArbitraryEventsWorkersComposite()
+      : isLaunchedWithoutContext(false),
+        deletedEvent(nullptr),
+        deletedEventWorkersCount(0){};
+  virtual ~ArbitraryEventsWorkersComposite();
+
+  /**
+   * \brief Add a worker, called after the ones already added.
+   *
+   * The worker is not owned by the composite and must outlive it.
+   */
+  ArbitraryEventsWorkersComposite& AddWorker(gd::ArbitraryEventsWorker& worker);
+
+  /**
+   * \brief Add a worker needing the context, called after the ones already
+   * added.
+   *
+   * The worker is not owned by the composite and must outlive it.
+   */
+  ArbitraryEventsWorkersComposite& AddWorker(
+      gd::ArbitraryEventsWorkerWithContext& worker);
+
+  /**
+   * \brief Return the number of workers added to the composite.
+   */
+  std::size_t GetWorkersCount() const { return workers.size(); };
+
+  /**
+   * \brief Launch the workers not needing the context on the specified events
+   * list (used for events not associated to any objects container).
+   */
+  void LaunchWithoutContext(gd::EventsList& events);
+
+ private:
+  void DoVisitEventList(gd::EventsList& events) override;
+  bool DoVisitEvent(gd::BaseEvent& event) override;
+  bool DoVisitLinkEvent(gd::LinkEvent& linkEvent) override;
+  void DoVisitInstructionList(gd::InstructionsList& instructions,
+                              bool areConditions) override;
+  bool DoVisitInstruction(gd::Instruction& instruction,
+                          bool isCondition) override;
+
+  bool IsSkipped(std::size_t i) const {
+    return isLaunchedWithoutContext && workersWithContext[i] != nullptr;
+  };
+
+  std::vector<gd::ArbitraryEventsWorker*> workers;
+  std::vector<gd::ArbitraryEventsWorkerWithContext*>
+      workersWithContext;  ///< For each worker, the worker if it needs the
+                           ///< context, nullptr otherwise.
+  bool isLaunchedWithoutContext;
+
+  const gd::BaseEvent* deletedEvent;  ///< The last event deleted by a worker,
+                                      ///< for link events.
+  std::size_t deletedEventWorkersCount;  ///< The number of workers that were
+                                         ///< called with deletedEvent.
+};
+
+/**
+ * \brief Run several read-only events workers in a single traversal of the
+ * events.
+ *
+ * The workers are called on each event (and instruction) in the order they
+ * were added. A worker stopping the iteration is not called anymore, and the
+ * traversal is stopped when all the workers have stopped it.
+ *
+ * Workers needing the context (gd::ReadOnlyArbitraryEventsWorkerWithContext)
+ * are given the objects containers the composite is launched with.
+ *
+ * \see gd::ArbitraryEventsWorkersComposite
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ReadOnlyArbitraryEventsWorkersComposite
+    : public ReadOnlyArbitraryEventsWorkerWithContext {
+ public:
+  ReadOnlyArbitraryEventsWorkersComposite()
+      : isLaunchedWithoutContext(false){};
+  virtual ~ReadOnlyArbitraryEventsWorkersComposite();
+
+  /**
+   * \brief Add a worker, called after the ones already added.
+   *
+   * The worker is not owned by the composite and must outlive it.
+   */
+  ReadOnlyArbitraryEventsWorkersComposite& AddWorker(
+      gd::ReadOnlyArbitraryEventsWorker& worker);
+
+  /**
+   * \brief Add a worker needing the context, called after the ones already
+   * added.
+   *
+   * The worker is not owned by the composite and must outlive it.
+   */
+  ReadOnlyArbitraryEventsWorkersComposite& AddWorker(
+      gd::ReadOnlyArbitraryEventsWorkerWithContext& worker);
+
+  /**
+   * \brief Return the number of workers added to the composite.
+   */
+  std::size_t GetWorkersCount() const { return workers.size(); };
+
+  /**
+   * \brief Launch the workers not needing the context on the specified events
+   * list (used for events not associated to any objects container).
+   */
+  void LaunchWithoutContext(const gd::EventsList& events);
+
+ private:
+  void DoVisitEventList(const gd::EventsList& events) override;
+  void DoVisitEvent(const gd::BaseEvent& event) override;
+  void DoVisitLinkEvent(const gd::LinkEvent& linkEvent) override;
+  void DoVisitInstructionList(const gd::InstructionsList& instructions,
+                              bool areConditions) override;
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override;
+
+  bool IsSkipped(std::size_t i) const {
+    return workers[i]->shouldStopIteration ||
+           (isLaunchedWithoutContext && workersWithContext[i] != nullptr);
+  };
+
+  /**
+   * \brief Stop the iteration if all the workers have stopped it.
+   */
+  void StopIfAllWorkersStopped();
+
+  std::vector<gd::ReadOnlyArbitraryEventsWorker*> workers;
+  std::vector<gd::ReadOnlyArbitraryEventsWorkerWithContext*>
+      workersWithContext;  ///< For each worker, the worker if it needs the
+                           ///< context, nullptr otherwise.
+  bool isLaunchedWithoutContext;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_ARBITRARYEVENTSWORKERSCOMPOSITE_H
@@ -110,9 +110,9 @@ bool EventsContextAnalyzer::DoVisitInstruction(gd::Instruction& instruction,
                                                bool isCondition) {
   const gd::InstructionMetadata& instrInfo =
       isCondition ? MetadataProvider::GetConditionMetadata(
-                        platform, instruction.GetType())
-                  : MetadataProvider::GetActionMetadata(platform,
-                                                        instruction.GetType());
+                        platform, instruction.GetInternedType())
+                  : MetadataProvider::GetActionMetadata(
+                        platform, instruction.GetInternedType());
 
   gd::ParameterMetadataTools::IterateOverParameters(
       instruction.GetParameters(),
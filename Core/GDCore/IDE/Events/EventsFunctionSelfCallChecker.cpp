@@ -71,7 +71,8 @@ public:
     if (!isCondition) {
       gd::String lastObjectParameter = "";
       const gd::InstructionMetadata &instrInfos =
-          MetadataProvider::GetActionMetadata(platform, instruction.GetType());
+          MetadataProvider::GetActionMetadata(
+              platform, instruction.GetInternedType());
       for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
 
         if (ParameterMetadata::IsExpression(
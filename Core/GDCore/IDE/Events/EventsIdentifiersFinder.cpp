@@ -144,9 +144,9 @@ class GD_CORE_API IdentifierFinderEventWorker
       gd::String lastObjectParameter = "";
       const gd::InstructionMetadata& instrInfos =
           areConditions ? MetadataProvider::GetConditionMetadata(
-                              platform, instruction.GetType())
+                              platform, instruction.GetInternedType())
                         : MetadataProvider::GetActionMetadata(
-                              platform, instruction.GetType());
+                              platform, instruction.GetInternedType());
       for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
         // The parameter has the searched type...
       if (instrInfos.parameters[pNb].GetType() == "identifier"
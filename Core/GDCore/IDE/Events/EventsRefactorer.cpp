@@ -224,6 +224,55 @@ class GD_CORE_API ExpressionObjectFinder : public ExpressionParser2NodeWorker {
   const gd::String rootType;
 };
 
+bool EventsRefactorer::RenameObjectInInstruction(
+    const gd::Platform& platform,
+    const gd::ObjectsContainer& project,
+    const gd::ObjectsContainer& layout,
+    gd::Instruction& instruction,
+    bool isCondition,
+    const gd::String& oldName,
+    const gd::String& newName) {
+  bool somethingModified = false;
+
+  const gd::InstructionMetadata& instrInfos =
+      isCondition ? MetadataProvider::GetConditionMetadata(
+                        platform, instruction.GetInternedType())
+                  : MetadataProvider::GetActionMetadata(
+                        platform, instruction.GetInternedType());
+  for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
+    // Replace object's name in parameters
+    if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].GetType()) &&
+        instruction.GetParameter(pNb).GetPlainString() == oldName) {
+      instruction.SetParameter(pNb, gd::Expression(newName));
+      somethingModified = true;
+    }
+    // Replace object's name in expressions
+    else if (ParameterMetadata::IsExpression(
+                 "number", instrInfos.parameters[pNb].GetType())) {
+      auto node = instruction.GetParameter(pNb).GetRootNode();
+
+      if (ExpressionObjectRenamer::Rename(platform, project, layout, "number", *node, oldName, newName)) {
+        instruction.SetParameter(
+            pNb, ExpressionParser2NodePrinter::PrintNode(*node));
+        somethingModified = true;
+      }
+    }
+    // Replace object's name in text expressions
+    else if (ParameterMetadata::IsExpression(
+                 "string", instrInfos.parameters[pNb].GetType())) {
+      auto node = instruction.GetParameter(pNb).GetRootNode();
+
+      if (ExpressionObjectRenamer::Rename(platform, project, layout, "string", *node, oldName, newName)) {
+        instruction.SetParameter(
+            pNb, ExpressionParser2NodePrinter::PrintNode(*node));
+        somethingModified = true;
+      }
+    }
+  }
+
+  return somethingModified;
+}
+
 bool EventsRefactorer::RenameObjectInActions(const gd::Platform& platform,
                                              gd::ObjectsContainer& project,
                                              gd::ObjectsContainer& layout,
@@ -233,34 +282,10 @@ bool EventsRefactorer::RenameObjectInActions(const gd::Platform& platform,
   bool somethingModified = false;
 
   for (std::size_t aId = 0; aId < actions.size(); ++aId) {
-    const gd::InstructionMetadata& instrInfos =
-        MetadataProvider::GetActionMetadata(platform, actions[aId].GetType());
-    for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
-      // Replace object's name in parameters
-      if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].GetType()) &&
-          actions[aId].GetParameter(pNb).GetPlainString() == oldName)
-        actions[aId].SetParameter(pNb, gd::Expression(newName));
-      // Replace object's name in expressions
-      else if (ParameterMetadata::IsExpression(
-                   "number", instrInfos.parameters[pNb].GetType())) {
-        auto node = actions[aId].GetParameter(pNb).GetRootNode();
-
-        if (ExpressionObjectRenamer::Rename(platform, project, layout, "number", *node, oldName, newName)) {
-          actions[aId].SetParameter(
-              pNb, ExpressionParser2NodePrinter::PrintNode(*node));
-        }
-      }
-      // Replace object's name in text expressions
-      else if (ParameterMetadata::IsExpression(
-                   "string", instrInfos.parameters[pNb].GetType())) {
-        auto node = actions[aId].GetParameter(pNb).GetRootNode();
-
-        if (ExpressionObjectRenamer::Rename(platform, project, layout, "string", *node, oldName, newName)) {
-          actions[aId].SetParameter(
-              pNb, ExpressionParser2NodePrinter::PrintNode(*node));
-        }
-      }
-    }
+    somethingModified =
+        RenameObjectInInstruction(
+            platform, project, layout, actions[aId], false, oldName, newName) ||
+        somethingModified;
 
     if (!actions[aId].GetSubInstructions().empty())
       somethingModified =
@@ -286,35 +311,15 @@ bool EventsRefactorer::RenameObjectInConditions(
   bool somethingModified = false;
 
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
-    const gd::InstructionMetadata& instrInfos =
-        MetadataProvider::GetConditionMetadata(platform,
-                                               conditions[cId].GetType());
-    for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
-      // Replace object's name in parameters
-      if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].GetType()) &&
-          conditions[cId].GetParameter(pNb).GetPlainString() == oldName)
-        conditions[cId].SetParameter(pNb, gd::Expression(newName));
-      // Replace object's name in expressions
-      else if (ParameterMetadata::IsExpression(
-                   "number", instrInfos.parameters[pNb].GetType())) {
-        auto node = conditions[cId].GetParameter(pNb).GetRootNode();
-
-        if (ExpressionObjectRenamer::Rename(platform, project, layout, "number", *node, oldName, newName)) {
-          conditions[cId].SetParameter(
-              pNb, ExpressionParser2NodePrinter::PrintNode(*node));
-        }
-      }
-      // Replace object's name in text expressions
-      else if (ParameterMetadata::IsExpression(
-                   "string", instrInfos.parameters[pNb].GetType())) {
-        auto node = conditions[cId].GetParameter(pNb).GetRootNode();
-
-        if (ExpressionObjectRenamer::Rename(platform, project, layout, "string", *node, oldName, newName)) {
-          conditions[cId].SetParameter(
-              pNb, ExpressionParser2NodePrinter::PrintNode(*node));
-        }
-      }
-    }
+    somethingModified =
+        RenameObjectInInstruction(platform,
+                                  project,
+                                  layout,
+                                  conditions[cId],
+                                  true,
+                                  oldName,
+                                  newName) ||
+        somethingModified;
 
     if (!conditions[cId].GetSubInstructions().empty())
       somethingModified =
@@ -332,8 +337,8 @@ bool EventsRefactorer::RenameObjectInConditions(
 
 bool EventsRefactorer::RenameObjectInEventParameters(
     const gd::Platform& platform,
-    gd::ObjectsContainer& project,
-    gd::ObjectsContainer& layout,
+    const gd::ObjectsContainer& project,
+    const gd::ObjectsContainer& layout,
     gd::Expression& expression,
     gd::ParameterMetadata parameterMetadata,
     gd::String oldName,
@@ -365,6 +370,34 @@ bool EventsRefactorer::RenameObjectInEventParameters(
   return somethingModified;
 }
 
+bool EventsRefactorer::RenameObjectInEventExpressions(
+    const gd::Platform& platform,
+    const gd::ObjectsContainer& project,
+    const gd::ObjectsContainer& layout,
+    gd::BaseEvent& event,
+    const gd::String& oldName,
+    const gd::String& newName) {
+  bool somethingModified = false;
+
+  vector<pair<gd::Expression*, gd::ParameterMetadata>>
+      expressionsWithMetadata = event.GetAllExpressionsWithMetadata();
+  for (std::size_t j = 0; j < expressionsWithMetadata.size(); ++j) {
+    gd::Expression* expression = expressionsWithMetadata[j].first;
+    gd::ParameterMetadata parameterMetadata =
+        expressionsWithMetadata[j].second;
+    somethingModified = RenameObjectInEventParameters(platform,
+                                                      project,
+                                                      layout,
+                                                      *expression,
+                                                      parameterMetadata,
+                                                      oldName,
+                                                      newName) ||
+                        somethingModified;
+  }
+
+  return somethingModified;
+}
+
 void EventsRefactorer::RenameObjectInEvents(const gd::Platform& platform,
                                             gd::ObjectsContainer& project,
                                             gd::ObjectsContainer& layout,
@@ -386,20 +419,8 @@ void EventsRefactorer::RenameObjectInEvents(const gd::Platform& platform,
           platform, project, layout, *actionsVectors[j], oldName, newName);
     }
 
-    vector<pair<gd::Expression*, gd::ParameterMetadata>>
-        expressionsWithMetadata = events[i].GetAllExpressionsWithMetadata();
-    for (std::size_t j = 0; j < expressionsWithMetadata.size(); ++j) {
-      gd::Expression* expression = expressionsWithMetadata[j].first;
-      gd::ParameterMetadata parameterMetadata =
-          expressionsWithMetadata[j].second;
-      bool somethingModified = RenameObjectInEventParameters(platform,
-                                                             project,
-                                                             layout,
-                                                             *expression,
-                                                             parameterMetadata,
-                                                             oldName,
-                                                             newName);
-    }
+    RenameObjectInEventExpressions(
+        platform, project, layout, events[i], oldName, newName);
 
     if (events[i].CanHaveSubEvents())
       RenameObjectInEvents(platform,
@@ -411,6 +432,47 @@ void EventsRefactorer::RenameObjectInEvents(const gd::Platform& platform,
   }
 }
 
+bool EventsRefactorer::IsObjectUsedInInstruction(
+    const gd::Platform& platform,
+    const gd::ObjectsContainer& globalObjectsContainer,
+    const gd::ObjectsContainer& objectsContainer,
+    const gd::Instruction& instruction,
+    bool isCondition,
+    const gd::String& name) {
+  const gd::InstructionMetadata& instrInfos =
+      isCondition ? MetadataProvider::GetConditionMetadata(
+                        platform, instruction.GetInternedType())
+                  : MetadataProvider::GetActionMetadata(
+                        platform, instruction.GetInternedType());
+  for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
+    // Find object's name in parameters
+    if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].GetType()) &&
+        instruction.GetParameter(pNb).GetPlainString() == name) {
+      return true;
+    }
+    // Find object's name in expressions
+    else if (ParameterMetadata::IsExpression(
+                 "number", instrInfos.parameters[pNb].GetType())) {
+      auto node = instruction.GetParameter(pNb).GetRootNode();
+
+      if (ExpressionObjectFinder::CheckIfHasObject(platform, globalObjectsContainer, objectsContainer, "number", *node, name)) {
+        return true;
+      }
+    }
+    // Find object's name in text expressions
+    else if (ParameterMetadata::IsExpression(
+                 "string", instrInfos.parameters[pNb].GetType())) {
+      auto node = instruction.GetParameter(pNb).GetRootNode();
+
+      if (ExpressionObjectFinder::CheckIfHasObject(platform, globalObjectsContainer, objectsContainer, "string", *node, name)) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
 bool EventsRefactorer::RemoveObjectInActions(const gd::Platform& platform,
                                              gd::ObjectsContainer& globalObjectsContainer,
                                              gd::ObjectsContainer& objectsContainer,
@@ -419,40 +481,12 @@ bool EventsRefactorer::RemoveObjectInActions(const gd::Platform& platform,
   bool somethingModified = false;
 
   for (std::size_t aId = 0; aId < actions.size(); ++aId) {
-    bool deleteMe = false;
-
-    const gd::InstructionMetadata& instrInfos =
-        MetadataProvider::GetActionMetadata(platform, actions[aId].GetType());
-    for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
-      // Find object's name in parameters
-      if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].GetType()) &&
-          actions[aId].GetParameter(pNb).GetPlainString() == name) {
-        deleteMe = true;
-        break;
-      }
-      // Find object's name in expressions
-      else if (ParameterMetadata::IsExpression(
-                   "number", instrInfos.parameters[pNb].GetType())) {
-        auto node = actions[aId].GetParameter(pNb).GetRootNode();
-
-        if (ExpressionObjectFinder::CheckIfHasObject(platform, globalObjectsContainer, objectsContainer, "number", *node, name)) {
-          deleteMe = true;
-          break;
-        }
-      }
-      // Find object's name in text expressions
-      else if (ParameterMetadata::IsExpression(
-                   "string", instrInfos.parameters[pNb].GetType())) {
-        auto node = actions[aId].GetParameter(pNb).GetRootNode();
-
-        if (ExpressionObjectFinder::CheckIfHasObject(platform, globalObjectsContainer, objectsContainer, "string", *node, name)) {
-          deleteMe = true;
-          break;
-        }
-      }
-    }
-
-    if (deleteMe) {
+    if (IsObjectUsedInInstruction(platform,
+                                  globalObjectsContainer,
+                                  objectsContainer,
+                                  actions[aId],
+                                  false,
+                                  name)) {
       somethingModified = true;
       actions.Remove(aId);
       aId--;
@@ -478,41 +512,12 @@ bool EventsRefactorer::RemoveObjectInConditions(
   bool somethingModified = false;
 
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
-    bool deleteMe = false;
-
-    const gd::InstructionMetadata& instrInfos =
-        MetadataProvider::GetConditionMetadata(platform,
-                                               conditions[cId].GetType());
-    for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
-      // Find object's name in parameters
-      if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].GetType()) &&
-          conditions[cId].GetParameter(pNb).GetPlainString() == name) {
-        deleteMe = true;
-        break;
-      }
-      // Find object's name in expressions
-      else if (ParameterMetadata::IsExpression(
-                   "number", instrInfos.parameters[pNb].GetType())) {
-        auto node = conditions[cId].GetParameter(pNb).GetRootNode();
-
-        if (ExpressionObjectFinder::CheckIfHasObject(platform, globalObjectsContainer, objectsContainer, "number", *node, name)) {
-          deleteMe = true;
-          break;
-        }
-      }
-      // Find object's name in text expressions
-      else if (ParameterMetadata::IsExpression(
-                   "string", instrInfos.parameters[pNb].GetType())) {
-        auto node = conditions[cId].GetParameter(pNb).GetRootNode();
-
-        if (ExpressionObjectFinder::CheckIfHasObject(platform, globalObjectsContainer, objectsContainer, "string", *node, name)) {
-          deleteMe = true;
-          break;
-        }
-      }
-    }
-
-    if (deleteMe) {
+    if (IsObjectUsedInInstruction(platform,
+                                  globalObjectsContainer,
+                                  objectsContainer,
+                                  conditions[cId],
+                                  true,
+                                  name)) {
       somethingModified = true;
       conditions.Remove(cId);
       cId--;
@@ -894,9 +899,9 @@ bool EventsRefactorer::SearchStringInFormattedText(const gd::Platform& platform,
                                                    bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetInternedType())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetInternedType());
   gd::String completeSentence =
       gd::InstructionSentenceFormatter::Get()->GetFullText(instruction,
                                                            metadata);
@@ -126,6 +126,47 @@ class GD_CORE_API EventsRefactorer {
       bool inActions,
       bool inEventString);
 
+  /**
+   * Replace all occurrences of an object name by another name in an
+   * instruction, but not in its sub-instructions
+   * ( include : objects in parameters and in math/text expressions ).
+   *
+   * \return true if something was modified.
+   */
+  static bool RenameObjectInInstruction(
+      const gd::Platform& platform,
+      const gd::ObjectsContainer& project,
+      const gd::ObjectsContainer& layout,
+      gd::Instruction& instruction,
+      bool isCondition,
+      const gd::String& oldName,
+      const gd::String& newName);
+
+  /**
+   * Replace all occurrences of an object name by another name in the
+   * expressions of an event itself (not in its instructions or sub-events).
+   *
+   * \return true if something was modified.
+   */
+  static bool RenameObjectInEventExpressions(
+      const gd::Platform& platform,
+      const gd::ObjectsContainer& project,
+      const gd::ObjectsContainer& layout,
+      gd::BaseEvent& event,
+      const gd::String& oldName,
+      const gd::String& newName);
+
+  /**
+   * Return true if an instruction (not counting its sub-instructions) uses an
+   * object, in which case it must be removed with the object.
+   */
+  static bool IsObjectUsedInInstruction(const gd::Platform& platform,
+                                        const gd::ObjectsContainer& project,
+                                        const gd::ObjectsContainer& layout,
+                                        const gd::Instruction& instruction,
+                                        bool isCondition,
+                                        const gd::String& name);
+
   virtual ~EventsRefactorer(){};
 
  private:
@@ -163,8 +204,8 @@ class GD_CORE_API EventsRefactorer {
    */
   static bool RenameObjectInEventParameters(
       const gd::Platform& platform,
-      gd::ObjectsContainer& project,
-      gd::ObjectsContainer& layout,
+      const gd::ObjectsContainer& project,
+      const gd::ObjectsContainer& layout,
       gd::Expression& expression,
       gd::ParameterMetadata parameterMetadata,
       gd::String oldName,
@@ -0,0 +1,648 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsReferencesIndex.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/IDE/Events/EventsRefactorer.h"
+#include "GDCore/IDE/Events/ExpressionTypeFinder.h"
+#include "GDCore/Project/ObjectsContainer.h"
+
+namespace gd {
+
+namespace {
+
+typedef std::vector<std::pair<gd::EventsReferencesIndex::ReferenceType,
+                              gd::String>>
+    ReferencedNames;
+
+/**
+ * \brief The indexes alive, notified when events are modified.
+ */
+std::recursive_mutex& GetIndexesMutex() {
+  static std::recursive_mutex indexesMutex;
+  return indexesMutex;
+}
+
+std::vector<gd::EventsReferencesIndex*>& GetIndexes() {
+  static std::vector<gd::EventsReferencesIndex*> indexes;
+  return indexes;
+}
+
+std::atomic<std::size_t> indexesCount(0);
+
+/**
+ * \brief Go through the nodes and list the names of the objects, behaviors,
+ * variables and free functions used in the expression.
+ *
+ * \see gd::ExpressionParser2
+ */
+class ExpressionReferencesFinder : public ExpressionParser2NodeWorker {
+ public:
+  ExpressionReferencesFinder(const gd::Platform& platform_,
+                             const gd::ObjectsContainer& globalObjectsContainer_,
+                             const gd::ObjectsContainer& objectsContainer_,
+                             const gd::String& rootType_,
+                             ReferencedNames& names_)
+      : platform(platform_),
+        globalObjectsContainer(globalObjectsContainer_),
+        objectsContainer(objectsContainer_),
+        rootType(rootType_),
+        names(names_){};
+  virtual ~ExpressionReferencesFinder(){};
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override {}
+  void OnVisitTextNode(TextNode& node) override {}
+  void OnVisitVariableNode(VariableNode& node) override {
+    Add(gd::EventsReferencesIndex::Variable, node.name);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {
+    auto type = gd::ExpressionTypeFinder::GetType(
+        platform, globalObjectsContainer, objectsContainer, rootType, node);
+    Add(gd::ParameterMetadata::IsObject(type)
+            ? gd::EventsReferencesIndex::Object
+            : gd::EventsReferencesIndex::Variable,
+        node.identifierName);
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {
+    Add(gd::EventsReferencesIndex::Object, node.objectName);
+    if (!node.behaviorFunctionName.empty())
+      Add(gd::EventsReferencesIndex::Behavior,
+          node.objectFunctionOrBehaviorName);
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    if (node.objectName.empty()) {
+      Add(gd::EventsReferencesIndex::Function, node.functionName);
+    } else {
+      Add(gd::EventsReferencesIndex::Object, node.objectName);
+      Add(gd::EventsReferencesIndex::Behavior, node.behaviorName);
+    }
+    for (auto& parameter : node.parameters) {
+      parameter->Visit(*this);
+    }
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override {}
+
+ private:
+  void Add(gd::EventsReferencesIndex::ReferenceType type,
+           const gd::String& name) {
+    if (!name.empty()) names.push_back(std::make_pair(type, name));
+  }
+
+  const gd::Platform& platform;
+  const gd::ObjectsContainer& globalObjectsContainer;
+  const gd::ObjectsContainer& objectsContainer;
+  const gd::String rootType;
+  ReferencedNames& names;
+};
+
+/**
+ * \brief Add to \a names the names referenced in a parameter.
+ */
+void FindParameterReferences(
+    const gd::Platform& platform,
+    const gd::ObjectsContainer& globalObjectsContainer,
+    const gd::ObjectsContainer& objectsContainer,
+    const gd::String& parameterType,
+    const gd::Expression& expression,
+    ReferencedNames& names) {
+  if (gd::ParameterMetadata::IsObject(parameterType)) {
+    if (!expression.GetPlainString().empty())
+      names.push_back(std::make_pair(gd::EventsReferencesIndex::Object,
+                                     expression.GetPlainString()));
+    return;
+  }
+  if (gd::ParameterMetadata::IsBehavior(parameterType)) {
+    if (!expression.GetPlainString().empty())
+      names.push_back(std::make_pair(gd::EventsReferencesIndex::Behavior,
+                                     expression.GetPlainString()));
+    return;
+  }
+
+  gd::String rootType;
+  if (gd::ParameterMetadata::IsExpression("number", parameterType))
+    rootType = "number";
+  else if (gd::ParameterMetadata::IsExpression("string", parameterType))
+    rootType = "string";
+  else if (gd::ParameterMetadata::IsExpression("variable", parameterType))
+    rootType = "variable";
+  else
+    return;
+
+  auto node = expression.GetRootNode();
+  if (!node) return;
+
+  ExpressionReferencesFinder finder(
+      platform, globalObjectsContainer, objectsContainer, rootType, names);
+  node->Visit(finder);
+}
+
+bool IsSameElement(const std::weak_ptr<gd::Instruction>& a,
+                   const std::weak_ptr<gd::Instruction>& b) {
+  return !a.owner_before(b) && !b.owner_before(a);
+}
+
+}  // namespace
+
+EventsReferencesIndex::EventsReferencesIndex(const gd::Platform& platform_)
+    : platform(platform_), indexingsCount(0), instructionUpdatesCount(0) {
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  GetIndexes().push_back(this);
+  indexesCount++;
+}
+
+EventsReferencesIndex::~EventsReferencesIndex() {
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  auto& indexes = GetIndexes();
+  indexes.erase(std::remove(indexes.begin(), indexes.end(), this),
+                indexes.end());
+  indexesCount--;
+}
+
+void EventsReferencesIndex::IndexEvents(
+    gd::EventsList& events,
+    const gd::ObjectsContainer& globalObjectsContainer,
+    const gd::ObjectsContainer& objectsContainer) {
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  GetUpToDateIndexedEvents(events, globalObjectsContainer, objectsContainer);
+}
+
+bool EventsReferencesIndex::HasIndexedEvents(
+    const gd::EventsList& events) const {
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  return indexedEventsLists.find(&events) != indexedEventsLists.end();
+}
+
+void EventsReferencesIndex::RemoveEvents(const gd::EventsList& events) {
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  auto it = indexedEventsLists.find(&events);
+  if (it == indexedEventsLists.end()) return;
+
+  ClearIndexedEvents(*it->second);
+  indexedEventsLists.erase(it);
+}
+
+std::vector<gd::EventsReference> EventsReferencesIndex::GetReferences(
+    gd::EventsList& events,
+    const gd::ObjectsContainer& globalObjectsContainer,
+    const gd::ObjectsContainer& objectsContainer,
+    ReferenceType type,
+    const gd::String& name) {
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  IndexedEvents& indexedEvents = GetUpToDateIndexedEvents(
+      events, globalObjectsContainer, objectsContainer);
+
+  std::vector<gd::EventsReference> references;
+  auto it = indexedEvents.references[type].find(name);
+  if (it != indexedEvents.references[type].end()) references = it->second;
+
+  auto eventsReferences =
+      GetEventsExpressionsReferences(indexedEvents, type, name);
+  references.insert(
+      references.end(), eventsReferences.begin(), eventsReferences.end());
+  return references;
+}
+
+std::vector<gd::EventsReference> EventsReferencesIndex::GetReferences(
+    ReferenceType type, const gd::String& name) {
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  std::vector<gd::EventsReference> references;
+  for (auto& it : indexedEventsLists) {
+    IndexedEvents& indexedEvents = *it.second;
+    auto eventsReferences = GetReferences(*indexedEvents.events,
+                                          *indexedEvents.globalObjectsContainer,
+                                          *indexedEvents.objectsContainer,
+                                          type,
+                                          name);
+    references.insert(
+        references.end(), eventsReferences.begin(), eventsReferences.end());
+  }
+
+  return references;
+}
+
+std::vector<gd::EventsSearchResult> EventsReferencesIndex::FindUsages(
+    gd::EventsList& events,
+    const gd::ObjectsContainer& globalObjectsContainer,
+    const gd::ObjectsContainer& objectsContainer,
+    ReferenceType type,
+    const gd::String& name) {
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  auto references = GetReferences(
+      events, globalObjectsContainer, objectsContainer, type, name);
+
+  std::vector<gd::EventsSearchResult> results;
+  std::unordered_set<const gd::BaseEvent*> foundEvents;
+  for (auto& reference : references) {
+    auto event = reference.event.lock();
+    if (!event || !foundEvents.insert(event.get()).second) continue;
+
+    gd::EventsList& eventsList = *reference.eventsList;
+    for (std::size_t i = 0; i < eventsList.size(); ++i) {
+      if (&eventsList.GetEvent(i) == event.get()) {
+        results.push_back(gd::EventsSearchResult(event, &eventsList, i));
+        break;
+      }
+    }
+  }
+
+  return results;
+}
+
+void EventsReferencesIndex::RenameObjectInEvents(
+    gd::EventsList& events,
+    const gd::ObjectsContainer& globalObjectsContainer,
+    const gd::ObjectsContainer& objectsContainer,
+    const gd::String& oldName,
+    const gd::String& newName) {
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  auto references = GetReferences(
+      events, globalObjectsContainer, objectsContainer, Object, oldName);
+
+  // An instruction can reference the object in several parameters: rename it
+  // only once.
+  std::unordered_set<const void*> renamedElements;
+  for (auto& reference : references) {
+    if (reference.instructionsList) {
+      auto instruction = reference.instruction.lock();
+      if (!instruction || !renamedElements.insert(instruction.get()).second)
+        continue;
+
+      gd::EventsRefactorer::RenameObjectInInstruction(platform,
+                                                      globalObjectsContainer,
+                                                      objectsContainer,
+                                                      *instruction,
+                                                      reference.isCondition,
+                                                      oldName,
+                                                      newName);
+    } else {
+      auto event = reference.event.lock();
+      if (!event || !renamedElements.insert(event.get()).second) continue;
+
+      gd::EventsRefactorer::RenameObjectInEventExpressions(
+          platform,
+          globalObjectsContainer,
+          objectsContainer,
+          *event,
+          oldName,
+          newName);
+    }
+  }
+}
+
+void EventsReferencesIndex::RemoveObjectInEvents(
+    gd::EventsList& events,
+    const gd::ObjectsContainer& globalObjectsContainer,
+    const gd::ObjectsContainer& objectsContainer,
+    const gd::String& name) {
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  IndexedEvents& indexedEvents = GetUpToDateIndexedEvents(
+      events, globalObjectsContainer, objectsContainer);
+  auto it = indexedEvents.references[Object].find(name);
+  if (it == indexedEvents.references[Object].end()) return;
+
+  // Removing instructions outdates the references: work on a copy.
+  std::vector<gd::EventsReference> references = it->second;
+  std::unordered_set<const gd::Instruction*> checkedInstructions;
+  for (auto& reference : references) {
+    // Instructions are only owned by their list: if the instruction is still
+    // alive, so is the list (this is not the case anymore for
+    // sub-instructions of a removed instruction).
+    auto instruction = reference.instruction.lock();
+    if (!instruction || !checkedInstructions.insert(instruction.get()).second)
+      continue;
+
+    if (gd::EventsRefactorer::IsObjectUsedInInstruction(platform,
+                                                        globalObjectsContainer,
+                                                        objectsContainer,
+                                                        *instruction,
+                                                        reference.isCondition,
+                                                        name)) {
+      reference.instructionsList->Remove(*instruction);
+    }
+  }
+}
+
+void EventsReferencesIndex::NotifyInstructionChanged(
+    const gd::Instruction& instruction) {
+  if (indexesCount == 0 ||
+      !instruction.GetEventsReferencesIndexFlag().IsIndexed())
+    return;
+
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  for (auto* index : GetIndexes()) index->OnInstructionChanged(instruction);
+}
+
+void EventsReferencesIndex::NotifyInstructionsListChanged(
+    const gd::InstructionsList& instructions) {
+  if (indexesCount == 0 ||
+      !instructions.GetEventsReferencesIndexFlag().IsIndexed())
+    return;
+
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  for (auto* index : GetIndexes()) index->OnListChanged(&instructions);
+}
+
+void EventsReferencesIndex::NotifyEventsListChanged(
+    const gd::EventsList& events) {
+  if (indexesCount == 0 || !events.GetEventsReferencesIndexFlag().IsIndexed())
+    return;
+
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  for (auto* index : GetIndexes()) index->OnListChanged(&events);
+}
+
+void EventsReferencesIndex::NotifyEventsListDestroyed(
+    const gd::EventsList& events) {
+  if (indexesCount == 0 || !events.GetEventsReferencesIndexFlag().IsIndexed())
+    return;
+
+  std::lock_guard<std::recursive_mutex> lock(GetIndexesMutex());
+  for (auto* index : GetIndexes()) index->OnEventsListDestroyed(events);
+}
+
+EventsReferencesIndex::IndexedEvents&
+EventsReferencesIndex::GetUpToDateIndexedEvents(
+    gd::EventsList& events,
+    const gd::ObjectsContainer& globalObjectsContainer,
+    const gd::ObjectsContainer& objectsContainer) {
+  auto& indexedEvents = indexedEventsLists[&events];
+  if (!indexedEvents) {
+    indexedEvents.reset(new IndexedEvents());
+    indexedEvents->events = &events;
+    indexedEvents->globalObjectsContainer = nullptr;
+    indexedEvents->objectsContainer = nullptr;
+    indexedEvents->isOutdated = true;
+  }
+
+  // Identifiers are objects or variables depending on the objects containers
+  // (for example, external events can be used by several scenes).
+  if (indexedEvents->globalObjectsContainer != &globalObjectsContainer ||
+      indexedEvents->objectsContainer != &objectsContainer) {
+    indexedEvents->globalObjectsContainer = &globalObjectsContainer;
+    indexedEvents->objectsContainer = &objectsContainer;
+    indexedEvents->isOutdated = true;
+  }
+
+  if (indexedEvents->isOutdated) Reindex(*indexedEvents);
+  return *indexedEvents;
+}
+
+void EventsReferencesIndex::Reindex(IndexedEvents& indexedEvents) {
+  ClearIndexedEvents(indexedEvents);
+  IndexEventsList(indexedEvents, *indexedEvents.events);
+  indexedEvents.isOutdated = false;
+  indexingsCount++;
+}
+
+void EventsReferencesIndex::ClearIndexedEvents(IndexedEvents& indexedEvents) {
+  // Lists and instructions may have been destroyed since, but are only used
+  // as keys.
+  for (const void* list : indexedEvents.lists) {
+    auto it = listsIndexedEvents.find(list);
+    if (it != listsIndexedEvents.end() && it->second == &indexedEvents)
+      listsIndexedEvents.erase(it);
+  }
+  for (const gd::Instruction* instruction : indexedEvents.instructions) {
+    auto it = instructionsLocations.find(instruction);
+    if (it != instructionsLocations.end() &&
+        it->second.indexedEvents == &indexedEvents)
+      instructionsLocations.erase(it);
+  }
+
+  for (auto& references : indexedEvents.references) references.clear();
+  indexedEvents.eventsWithExpressions.clear();
+  indexedEvents.lists.clear();
+  indexedEvents.instructions.clear();
+}
+
+void EventsReferencesIndex::IndexEventsList(IndexedEvents& indexedEvents,
+                                            gd::EventsList& events) {
+  indexedEvents.lists.push_back(&events);
+  listsIndexedEvents[&events] = &indexedEvents;
+  events.GetEventsReferencesIndexFlag().SetIndexed();
+
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    std::shared_ptr<gd::BaseEvent> event = events.GetEventSmartPtr(i);
+
+    for (auto* conditions : event->GetAllConditionsVectors())
+      IndexInstructionsList(indexedEvents, events, event, *conditions, true);
+    for (auto* actions : event->GetAllActionsVectors())
+      IndexInstructionsList(indexedEvents, events, event, *actions, false);
+
+    if (!event->GetAllExpressionsWithMetadata().empty())
+      indexedEvents.eventsWithExpressions.push_back(
+          std::make_pair(&events, std::weak_ptr<gd::BaseEvent>(event)));
+
+    if (event->CanHaveSubEvents())
+      IndexEventsList(indexedEvents, event->GetSubEvents());
+  }
+}
+
+void EventsReferencesIndex::IndexInstructionsList(
+    IndexedEvents& indexedEvents,
+    gd::EventsList& eventsList,
+    const std::shared_ptr<gd::BaseEvent>& event,
+    gd::InstructionsList& instructions,
+    bool isCondition) {
+  indexedEvents.lists.push_back(&instructions);
+  listsIndexedEvents[&instructions] = &indexedEvents;
+  instructions.GetEventsReferencesIndexFlag().SetIndexed();
+
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    std::shared_ptr<gd::Instruction> instruction = instructions.GetSmartPtr(i);
+
+    InstructionLocation& location = instructionsLocations[instruction.get()];
+    location.indexedEvents = &indexedEvents;
+    location.eventsList = &eventsList;
+    location.event = event;
+    location.instructionsList = &instructions;
+    location.instruction = instruction;
+    location.isCondition = isCondition;
+    AddInstructionReferences(location);
+    indexedEvents.instructions.push_back(instruction.get());
+    instruction->GetEventsReferencesIndexFlag().SetIndexed();
+
+    IndexInstructionsList(indexedEvents,
+                          eventsList,
+                          event,
+                          instruction->GetSubInstructions(),
+                          isCondition);
+  }
+}
+
+void EventsReferencesIndex::AddInstructionReferences(
+    InstructionLocation& location) {
+  location.names.clear();
+  auto instruction = location.instruction.lock();
+  if (!instruction) return;
+
+  const IndexedEvents& indexedEvents = *location.indexedEvents;
+  gd::EventsReference reference;
+  reference.eventsList = location.eventsList;
+  reference.event = location.event;
+  reference.instructionsList = location.instructionsList;
+  reference.instruction = location.instruction;
+  reference.isCondition = location.isCondition;
+
+  reference.parameterIndex = gd::String::npos;
+  location.names.push_back(std::make_pair(Function, instruction->GetType()));
+  location.indexedEvents->references[Function][instruction->GetType()]
+      .push_back(reference);
+
+  const gd::InstructionMetadata& metadata =
+      location.isCondition
+          ? gd::MetadataProvider::GetConditionMetadata(platform,
+                                                       instruction->GetType())
+          : gd::MetadataProvider::GetActionMetadata(platform,
+                                                    instruction->GetType());
+  for (std::size_t pNb = 0; pNb < metadata.parameters.size() &&
+                            pNb < instruction->GetParametersCount();
+       ++pNb) {
+    ReferencedNames parameterNames;
+    FindParameterReferences(platform,
+                            *indexedEvents.globalObjectsContainer,
+                            *indexedEvents.objectsContainer,
+                            metadata.parameters[pNb].GetType(),
+                            instruction->GetParameter(pNb),
+                            parameterNames);
+
+    reference.parameterIndex = pNb;
+    for (auto& name : parameterNames) {
+      location.indexedEvents->references[name.first][name.second].push_back(
+          reference);
+      if (std::find(location.names.begin(), location.names.end(), name) ==
+          location.names.end())
+        location.names.push_back(name);
+    }
+  }
+}
+
+void EventsReferencesIndex::RemoveInstructionReferences(
+    const InstructionLocation& location) {
+  for (auto& name : location.names) {
+    auto& typeReferences = location.indexedEvents->references[name.first];
+    auto it = typeReferences.find(name.second);
+    if (it == typeReferences.end()) continue;
+
+    auto& references = it->second;
+    references.erase(std::remove_if(references.begin(),
+                                    references.end(),
+                                    [&](const gd::EventsReference& reference) {
+                                      return IsSameElement(
+                                          reference.instruction,
+                                          location.instruction);
+                                    }),
+                     references.end());
+    if (references.empty()) typeReferences.erase(it);
+  }
+}
+
+std::vector<gd::EventsReference>
+EventsReferencesIndex::GetEventsExpressionsReferences(
+    IndexedEvents& indexedEvents, ReferenceType type, const gd::String& name) {
+  std::vector<gd::EventsReference> references;
+  for (auto& eventWithExpressions : indexedEvents.eventsWithExpressions) {
+    auto event = eventWithExpressions.second.lock();
+    if (!event) continue;
+
+    auto expressionsWithMetadata = event->GetAllExpressionsWithMetadata();
+    for (std::size_t i = 0; i < expressionsWithMetadata.size(); ++i) {
+      ReferencedNames parameterNames;
+      FindParameterReferences(platform,
+                              *indexedEvents.globalObjectsContainer,
+                              *indexedEvents.objectsContainer,
+                              expressionsWithMetadata[i].second.GetType(),
+                              *expressionsWithMetadata[i].first,
+                              parameterNames);
+      if (std::find(parameterNames.begin(),
+                    parameterNames.end(),
+                    std::make_pair(type, name)) == parameterNames.end())
+        continue;
+
+      gd::EventsReference reference;
+      reference.eventsList = eventWithExpressions.first;
+      reference.event = event;
+      reference.parameterIndex = i;
+      references.push_back(reference);
+    }
+  }
+
+  return references;
+}
+
+void EventsReferencesIndex::OnInstructionChanged(
+    const gd::Instruction& instruction) {
+  auto it = instructionsLocations.find(&instruction);
+  if (it == instructionsLocations.end()) return;
+
+  InstructionLocation& location = it->second;
+  if (location.indexedEvents->isOutdated) return;
+
+  // The instruction indexed may have been destroyed and another one created
+  // at the same address.
+  if (location.instruction.lock().get() != &instruction) {
+    location.indexedEvents->isOutdated = true;
+    return;
+  }
+
+  RemoveInstructionReferences(location);
+  AddInstructionReferences(location);
+  instructionUpdatesCount++;
+}
+
+void EventsReferencesIndex::OnListChanged(const void* list) {
+  auto it = listsIndexedEvents.find(list);
+  if (it == listsIndexedEvents.end()) return;
+
+  it->second->isOutdated = true;
+}
+
+void EventsReferencesIndex::OnEventsListDestroyed(
+    const gd::EventsList& events) {
+  auto it = indexedEventsLists.find(&events);
+  if (it == indexedEventsLists.end()) {
+    OnListChanged(&events);
+    return;
+  }
+
+  ClearIndexedEvents(*it->second);
+  indexedEventsLists.erase(it);
+}
+
+}  // namespace gd
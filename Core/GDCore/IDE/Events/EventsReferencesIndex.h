@@ -0,0 +1,262 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EVENTSREFERENCESINDEX_H
+#define GDCORE_EVENTSREFERENCESINDEX_H
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class BaseEvent;
+class EventsList;
+class EventsSearchResult;
+class Instruction;
+class InstructionsList;
+class ObjectsContainer;
+class Platform;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A place in the events where a name is referenced.
+ *
+ * \see gd::EventsReferencesIndex
+ */
+class GD_CORE_API EventsReference {
+ public:
+  EventsReference()
+      : eventsList(nullptr),
+        instructionsList(nullptr),
+        isCondition(false),
+        parameterIndex(gd::String::npos){};
+  ~EventsReference(){};
+
+  gd::EventsList* eventsList;  ///< The list containing the event.
+  std::weak_ptr<gd::BaseEvent> event;
+  gd::InstructionsList*
+      instructionsList;  ///< The list containing the instruction, or nullptr
+                         ///< if the reference is in an expression of the
+                         ///< event itself.
+  std::weak_ptr<gd::Instruction> instruction;
+  bool isCondition;
+  std::size_t parameterIndex;  ///< The index of the parameter (of the
+                               ///< instruction or in the expressions of the
+                               ///< event), or gd::String::npos for the type of
+                               ///< the instruction.
+};
+
+/**
+ * \brief An index of the names referenced in events (objects, behaviors,
+ * variables and functions), so that their usages can be found, renamed or
+ * removed without browsing all the events.
+ *
+ * Events lists are indexed the first time they are used. The index is then
+ * updated when the events are modified through the API of gd::Instruction,
+ * gd::InstructionsList and gd::EventsList (see the Notify methods):
+ * - a modified instruction is indexed again alone,
+ * - when instructions or events are added, removed or moved, the whole events
+ * list containing them is indexed again, the next time it's used.
+ *
+ * Names are found without resolving them, like the refactorers do: variables
+ * are the names used as variables (scene, global or object variables), and
+ * functions are the types of instructions and the names of the free functions
+ * used in expressions.
+ *
+ * \warning Expressions modified directly (instead of with
+ * gd::Instruction::SetParameter) are not seen by the index. The expressions of
+ * events themselves (like the number of repetitions of a Repeat event) are
+ * not indexed but searched each time they are needed.
+ *
+ * Only the indexed events notify the indexes (see
+ * gd::EventsReferencesIndexFlag): other events, like the copies made by the
+ * code generation in parallel, are modified without any lock. The index must
+ * not be used while the events it indexed are modified.
+ *
+ * \note The index is used to rename and remove objects in layouts (see
+ * gd::WholeProjectRefactorer) and to find the usages of a name (FindUsages).
+ * Behaviors and events functions are still renamed and removed by browsing
+ * all the events of the project.
+ *
+ * \see gd::Project::GetEventsReferencesIndex
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API EventsReferencesIndex {
+ public:
+  enum ReferenceType { Object = 0, Behavior, Variable, Function };
+
+  EventsReferencesIndex(const gd::Platform& platform);
+  EventsReferencesIndex(const EventsReferencesIndex&) = delete;
+  EventsReferencesIndex& operator=(const EventsReferencesIndex&) = delete;
+  virtual ~EventsReferencesIndex();
+
+  /**
+   * \brief Index the events, if not already done, using the given objects
+   * containers to know if identifiers are objects.
+   *
+   * The events and the containers must outlive the index or be removed from
+   * it (this is done automatically when the events are destroyed).
+   */
+  void IndexEvents(gd::EventsList& events,
+                   const gd::ObjectsContainer& globalObjectsContainer,
+                   const gd::ObjectsContainer& objectsContainer);
+
+  /**
+   * \brief Return true if the events were indexed.
+   */
+  bool HasIndexedEvents(const gd::EventsList& events) const;
+
+  /**
+   * \brief Remove the events from the index.
+   */
+  void RemoveEvents(const gd::EventsList& events);
+
+  /**
+   * \brief Return the references to \a name in the events (indexing them if
+   * needed).
+   */
+  std::vector<gd::EventsReference> GetReferences(
+      gd::EventsList& events,
+      const gd::ObjectsContainer& globalObjectsContainer,
+      const gd::ObjectsContainer& objectsContainer,
+      ReferenceType type,
+      const gd::String& name);
+
+  /**
+   * \brief Return the references to \a name in all the indexed events.
+   */
+  std::vector<gd::EventsReference> GetReferences(ReferenceType type,
+                                                 const gd::String& name);
+
+  /**
+   * \brief Return the events referencing \a name in the events (indexing them
+   * if needed), each event being given once, like the results of
+   * gd::EventsRefactorer::SearchInEvents.
+   */
+  std::vector<gd::EventsSearchResult> FindUsages(
+      gd::EventsList& events,
+      const gd::ObjectsContainer& globalObjectsContainer,
+      const gd::ObjectsContainer& objectsContainer,
+      ReferenceType type,
+      const gd::String& name);
+
+  /**
+   * \brief Replace the name of an object by another in the events, like
+   * gd::EventsRefactorer::RenameObjectInEvents, but only visiting the
+   * instructions referencing the object.
+   */
+  void RenameObjectInEvents(gd::EventsList& events,
+                            const gd::ObjectsContainer& globalObjectsContainer,
+                            const gd::ObjectsContainer& objectsContainer,
+                            const gd::String& oldName,
+                            const gd::String& newName);
+
+  /**
+   * \brief Remove the instructions using an object in the events, like
+   * gd::EventsRefactorer::RemoveObjectInEvents, but only visiting the
+   * instructions referencing the object.
+   */
+  void RemoveObjectInEvents(gd::EventsList& events,
+                            const gd::ObjectsContainer& globalObjectsContainer,
+                            const gd::ObjectsContainer& objectsContainer,
+                            const gd::String& name);
+
+  /**
+   * \brief Return the number of times events lists were (re)indexed.
+   */
+  std::size_t GetIndexingsCount() const { return indexingsCount; };
+
+  /**
+   * \brief Return the number of times instructions were indexed again alone
+   * after being modified.
+   */
+  std::size_t GetInstructionUpdatesCount() const {
+    return instructionUpdatesCount;
+  };
+
+  /** \name Notifications
+   * Called by the events when they are modified, to update all the indexes.
+   */
+  ///@{
+  static void NotifyInstructionChanged(const gd::Instruction& instruction);
+  static void NotifyInstructionsListChanged(
+      const gd::InstructionsList& instructions);
+  static void NotifyEventsListChanged(const gd::EventsList& events);
+  static void NotifyEventsListDestroyed(const gd::EventsList& events);
+  ///@}
+
+ private:
+  struct IndexedEvents;
+
+  /**
+   * \brief Where an instruction is, and the names it references.
+   */
+  struct InstructionLocation {
+    IndexedEvents* indexedEvents;
+    gd::EventsList* eventsList;
+    std::weak_ptr<gd::BaseEvent> event;
+    gd::InstructionsList* instructionsList;
+    std::weak_ptr<gd::Instruction> instruction;
+    bool isCondition;
+    std::vector<std::pair<ReferenceType, gd::String>> names;
+  };
+
+  /**
+   * \brief The references found in an events list (and its sub events).
+   */
+  struct IndexedEvents {
+    gd::EventsList* events;
+    const gd::ObjectsContainer* globalObjectsContainer;
+    const gd::ObjectsContainer* objectsContainer;
+    bool isOutdated;
+
+    std::unordered_map<gd::String, std::vector<gd::EventsReference>>
+        references[4];  ///< The references for each ReferenceType.
+    std::vector<std::pair<gd::EventsList*, std::weak_ptr<gd::BaseEvent>>>
+        eventsWithExpressions;
+    std::vector<const void*> lists;  ///< The events and instructions lists.
+    std::vector<const gd::Instruction*> instructions;
+  };
+
+  IndexedEvents& GetUpToDateIndexedEvents(
+      gd::EventsList& events,
+      const gd::ObjectsContainer& globalObjectsContainer,
+      const gd::ObjectsContainer& objectsContainer);
+  void Reindex(IndexedEvents& indexedEvents);
+  void ClearIndexedEvents(IndexedEvents& indexedEvents);
+  void IndexEventsList(IndexedEvents& indexedEvents, gd::EventsList& events);
+  void IndexInstructionsList(IndexedEvents& indexedEvents,
+                             gd::EventsList& eventsList,
+                             const std::shared_ptr<gd::BaseEvent>& event,
+                             gd::InstructionsList& instructions,
+                             bool isCondition);
+  void AddInstructionReferences(InstructionLocation& location);
+  void RemoveInstructionReferences(const InstructionLocation& location);
+  std::vector<gd::EventsReference> GetEventsExpressionsReferences(
+      IndexedEvents& indexedEvents, ReferenceType type, const gd::String& name);
+
+  void OnInstructionChanged(const gd::Instruction& instruction);
+  void OnListChanged(const void* list);
+  void OnEventsListDestroyed(const gd::EventsList& events);
+
+  const gd::Platform& platform;
+  std::unordered_map<const gd::EventsList*, std::unique_ptr<IndexedEvents>>
+      indexedEventsLists;
+  std::unordered_map<const void*, IndexedEvents*>
+      listsIndexedEvents;  ///< The indexed events containing each events or
+                           ///< instructions list.
+  std::unordered_map<const gd::Instruction*, InstructionLocation>
+      instructionsLocations;
+  std::size_t indexingsCount;
+  std::size_t instructionUpdatesCount;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EVENTSREFERENCESINDEX_H
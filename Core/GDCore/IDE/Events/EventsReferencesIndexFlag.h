@@ -0,0 +1,46 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EVENTSREFERENCESINDEXFLAG_H
+#define GDCORE_EVENTSREFERENCESINDEXFLAG_H
+
+namespace gd {
+
+/**
+ * \brief Remember if an events list, an instructions list or an instruction
+ * was indexed by a gd::EventsReferencesIndex.
+ *
+ * Only the indexed elements notify the indexes when they are modified, so that
+ * other events (like the copies made for code generation) are modified
+ * without any synchronization.
+ *
+ * The flag is not copied: a copy of indexed events is not indexed.
+ *
+ * \see gd::EventsReferencesIndex
+ */
+class EventsReferencesIndexFlag {
+ public:
+  EventsReferencesIndexFlag() : isIndexed(false){};
+  EventsReferencesIndexFlag(const EventsReferencesIndexFlag&)
+      : isIndexed(false){};
+  EventsReferencesIndexFlag& operator=(const EventsReferencesIndexFlag&) {
+    return *this;
+  };
+
+  bool IsIndexed() const { return isIndexed; };
+
+  /**
+   * \brief Mark the element as indexed. It stays so, even after being
+   * removed from the indexes.
+   */
+  void SetIndexed() const { isIndexed = true; };
+
+ private:
+  mutable bool isIndexed;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EVENTSREFERENCESINDEXFLAG_H
@@ -11,6 +11,7 @@
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Parsers/ParsedExpressionsCache.h"
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
@@ -59,6 +60,20 @@ size_t GetMaximumParametersNumber(
 
 }  // namespace
 
+bool ExpressionValidator::HasNoErrors(
+    const gd::Platform &platform,
+    const gd::ObjectsContainer &globalObjectsContainer,
+    const gd::ObjectsContainer &objectsContainer,
+    const gd::String &rootType,
+    const gd::Expression &expression,
+    gd::ParsedExpressionsCache &cache) {
+  auto node = expression.GetRootNode(cache);
+  if (!node) return false;
+
+  return HasNoErrors(
+      platform, globalObjectsContainer, objectsContainer, rootType, *node);
+}
+
 ExpressionValidator::Type ExpressionValidator::ValidateFunction(const gd::FunctionCallNode& function) {
 
   ReportAnyError(function);
@@ -20,6 +20,7 @@ class ObjectsContainer;
 class Platform;
 class ParameterMetadata;
 class ExpressionMetadata;
+class ParsedExpressionsCache;
 }  // namespace gd
 
 namespace gd {
@@ -57,6 +58,19 @@ class GD_CORE_API ExpressionValidator : public ExpressionParser2NodeWorker {
     return validator.GetAllErrors().empty();
   }
 
+  /**
+   * \brief Helper function to check if a given expression does not contain
+   * any error including non-fatal ones.
+   *
+   * The expression is parsed only if it's not already in \a cache.
+   */
+  static bool HasNoErrors(const gd::Platform &platform,
+                          const gd::ObjectsContainer &globalObjectsContainer,
+                          const gd::ObjectsContainer &objectsContainer,
+                          const gd::String &rootType,
+                          const gd::Expression &expression,
+                          gd::ParsedExpressionsCache &cache);
+
   /**
    * \brief Get only the fatal errors
    *
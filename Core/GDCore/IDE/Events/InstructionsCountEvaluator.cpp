@@ -8,17 +8,30 @@ namespace gd {
 
 const int InstructionsCountEvaluator::ScanProject(gd::Project &project) {
   InstructionsCountEvaluator worker(project);
-  gd::ProjectBrowserHelper::ExposeProjectEventsWithoutExtensions(project,
-                                                                 worker);
+  gd::ProjectBrowserHelper::ExposeProjectEventsWithoutExtensionsInParallel(
+      project, worker);
   return worker.instructionCount;
 };
 
+// Parallel events worker
+
+std::unique_ptr<ParallelReadOnlyEventsWorker>
+InstructionsCountEvaluator::Clone() const {
+  return std::unique_ptr<ParallelReadOnlyEventsWorker>(
+      new InstructionsCountEvaluator(project));
+};
+
+void InstructionsCountEvaluator::Reduce(
+    const ParallelReadOnlyEventsWorker &clone) {
+  instructionCount +=
+      static_cast<const InstructionsCountEvaluator &>(clone).instructionCount;
+};
+
 // Instructions scanner
 
-bool InstructionsCountEvaluator::DoVisitInstruction(
-    gd::Instruction &instruction, bool isCondition) {
+void InstructionsCountEvaluator::DoVisitInstruction(
+    const gd::Instruction &instruction, bool isCondition) {
   instructionCount++;
-  return false;
 }
 
 } // namespace gd
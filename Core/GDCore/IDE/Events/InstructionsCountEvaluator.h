@@ -6,10 +6,11 @@
 
 #ifndef GDCORE_INSTRUCTIONS_COUNT_EVALUATOR_H
 #define GDCORE_INSTRUCTIONS_COUNT_EVALUATOR_H
+#include <memory>
 #include <set>
 
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
-#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/ParallelReadOnlyEventsWorker.h"
 #include "GDCore/IDE/Project/ArbitraryObjectsWorker.h"
 #include "GDCore/String.h"
 
@@ -27,7 +28,8 @@ namespace gd {
  * This is used by the examples repository to evaluate examples size.
  *
  */
-class GD_CORE_API InstructionsCountEvaluator : public ArbitraryEventsWorker {
+class GD_CORE_API InstructionsCountEvaluator
+    : public ParallelReadOnlyEventsWorker {
 public:
   /**
    * Return the number of instructions in the project excluding extensions.
@@ -40,8 +42,12 @@ private:
   gd::Project &project;
   int instructionCount;
 
+  // Parallel events worker
+  std::unique_ptr<ParallelReadOnlyEventsWorker> Clone() const override;
+  void Reduce(const ParallelReadOnlyEventsWorker &clone) override;
+
   // Instructions Visitor
-  bool DoVisitInstruction(gd::Instruction &instruction,
+  void DoVisitInstruction(const gd::Instruction &instruction,
                           bool isCondition) override;
 };
 
@@ -17,7 +17,7 @@ namespace gd {
 
 bool InstructionsParameterMover::DoVisitInstruction(
     gd::Instruction& instruction, bool isCondition) {
-  if (instruction.GetType() == instructionType) {
+  if (instruction.GetInternedType() == instructionType) {
     std::vector<gd::Expression> updatedParameters = instruction.GetParameters();
     if (oldIndex < updatedParameters.size()) {
       gd::Expression movedParameter = updatedParameters.at(oldIndex);
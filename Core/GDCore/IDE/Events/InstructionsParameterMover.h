@@ -10,6 +10,7 @@
 #include <vector>
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 namespace gd {
 class BaseEvent;
 class Project;
@@ -43,7 +44,7 @@ class GD_CORE_API InstructionsParameterMover : public ArbitraryEventsWorker {
                           bool isCondition) override;
 
   const gd::Project& project;
-  gd::String instructionType;
+  gd::InternedString instructionType;
   std::size_t oldIndex;
   std::size_t newIndex;
 };
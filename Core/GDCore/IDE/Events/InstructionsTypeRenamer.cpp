@@ -17,7 +17,7 @@ namespace gd {
 
 bool InstructionsTypeRenamer::DoVisitInstruction(gd::Instruction& instruction,
                                            bool isCondition) {
-  if (instruction.GetType() == oldType) {
+  if (instruction.GetInternedType() == oldType) {
     instruction.SetType(newType);
   }
   
@@ -10,6 +10,7 @@
 #include <vector>
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 namespace gd {
 class BaseEvent;
 class Project;
@@ -37,7 +38,7 @@ class GD_CORE_API InstructionsTypeRenamer : public ArbitraryEventsWorker {
                           bool isCondition) override;
 
   const gd::Project& project;
-  gd::String oldType;
+  gd::InternedString oldType;
   gd::String newType;
 };
 
@@ -0,0 +1,12 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ParallelReadOnlyEventsWorker.h"
+
+namespace gd {
+
+ParallelReadOnlyEventsWorker::~ParallelReadOnlyEventsWorker() {}
+
+}  // namespace gd
@@ -0,0 +1,51 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_PARALLELREADONLYEVENTSWORKER_H
+#define GDCORE_PARALLELREADONLYEVENTSWORKER_H
+#include <memory>
+
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+
+namespace gd {
+
+/**
+ * \brief A read-only events worker that can be run on several events lists at
+ * the same time.
+ *
+ * Each events list is given to a clone of the worker, possibly on another
+ * thread, then the results of the clones are merged into the worker using
+ * Reduce.
+ *
+ * \warning Workers must only read the events, the project and the metadata
+ * while visiting events: anything else must be stored in the worker itself.
+ *
+ * \see gd::ProjectBrowserHelper::ExposeProjectEventsInParallel
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ParallelReadOnlyEventsWorker
+    : public ReadOnlyArbitraryEventsWorkerWithContext {
+ public:
+  ParallelReadOnlyEventsWorker(){};
+  virtual ~ParallelReadOnlyEventsWorker();
+
+  /**
+   * \brief Return a new worker, with the same parameters as this one but an
+   * empty result.
+   */
+  virtual std::unique_ptr<ParallelReadOnlyEventsWorker> Clone() const = 0;
+
+  /**
+   * \brief Merge the result of a clone into the result of this worker.
+   *
+   * Clones are merged in the order of the events lists they were given.
+   */
+  virtual void Reduce(const ParallelReadOnlyEventsWorker& clone) = 0;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_PARALLELREADONLYEVENTSWORKER_H
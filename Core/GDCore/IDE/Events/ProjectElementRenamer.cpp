@@ -132,9 +132,9 @@ bool ProjectElementRenamer::DoVisitInstruction(gd::Instruction &instruction,
                                                bool isCondition) {
   const auto &metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetInternedType())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetInternedType());
 
   gd::String lastLayerName;
   gd::ParameterMetadataTools::IterateOverParametersWithIndex(
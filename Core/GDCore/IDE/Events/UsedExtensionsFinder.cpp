@@ -16,10 +16,31 @@ namespace gd {
 const UsedExtensionsResult UsedExtensionsFinder::ScanProject(gd::Project& project) {
   UsedExtensionsFinder worker(project);
   gd::ProjectBrowserHelper::ExposeProjectObjects(project, worker);
-  gd::ProjectBrowserHelper::ExposeProjectEvents(project, worker);
+  gd::ProjectBrowserHelper::ExposeProjectEventsInParallel(project, worker);
   return worker.result;
 };
 
+// Parallel events worker
+
+std::unique_ptr<ParallelReadOnlyEventsWorker> UsedExtensionsFinder::Clone()
+    const {
+  return std::unique_ptr<ParallelReadOnlyEventsWorker>(
+      new UsedExtensionsFinder(project));
+};
+
+void UsedExtensionsFinder::Reduce(const ParallelReadOnlyEventsWorker& clone) {
+  const auto& cloneResult =
+      static_cast<const UsedExtensionsFinder&>(clone).result;
+  result.GetUsedExtensions().insert(cloneResult.GetUsedExtensions().begin(),
+                                    cloneResult.GetUsedExtensions().end());
+  result.GetUsedIncludeFiles().insert(
+      cloneResult.GetUsedIncludeFiles().begin(),
+      cloneResult.GetUsedIncludeFiles().end());
+  result.GetUsedRequiredFiles().insert(
+      cloneResult.GetUsedRequiredFiles().begin(),
+      cloneResult.GetUsedRequiredFiles().end());
+};
+
 // Objects scanner
 
 void UsedExtensionsFinder::DoVisitObject(gd::Object &object) {
@@ -47,13 +68,15 @@ void UsedExtensionsFinder::DoVisitBehavior(gd::Behavior &behavior) {
 
 // Instructions scanner
 
-bool UsedExtensionsFinder::DoVisitInstruction(gd::Instruction& instruction,
-                                              bool isCondition) {
+void UsedExtensionsFinder::DoVisitInstruction(
+    const gd::Instruction& instruction, bool isCondition) {
   auto metadata =
       isCondition ? gd::MetadataProvider::GetExtensionAndConditionMetadata(
-                        project.GetCurrentPlatform(), instruction.GetType())
+                        project.GetCurrentPlatform(),
+                        instruction.GetInternedType())
                   : gd::MetadataProvider::GetExtensionAndActionMetadata(
-                        project.GetCurrentPlatform(), instruction.GetType());
+                        project.GetCurrentPlatform(),
+                        instruction.GetInternedType());
   result.GetUsedExtensions().insert(metadata.GetExtension().GetName());
   for (auto&& includeFile : metadata.GetMetadata().GetIncludeFiles()) {
     result.GetUsedIncludeFiles().insert(includeFile);
@@ -69,15 +92,15 @@ bool UsedExtensionsFinder::DoVisitInstruction(gd::Instruction& instruction,
 
     if (gd::ParameterMetadata::IsExpression("string", parameterType)) {
       rootType = "string";
-      parameterValue.GetRootNode()->Visit(*this);
+      parameterValue.GetRootNode(project.GetParsedExpressionsCache())
+          ->Visit(*this);
     } else if (gd::ParameterMetadata::IsExpression("number", parameterType)) {
       rootType = "number";
-      parameterValue.GetRootNode()->Visit(*this);
+      parameterValue.GetRootNode(project.GetParsedExpressionsCache())
+          ->Visit(*this);
     } else if (gd::ParameterMetadata::IsExpression("variable", parameterType))
       result.GetUsedExtensions().insert("BuiltinVariables");
   });
-
-  return false;
 }
 
 // Expressions scanner
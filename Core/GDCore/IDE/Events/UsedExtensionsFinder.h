@@ -6,10 +6,11 @@
 
 #ifndef GDCORE_USED_EXTENSIONS_FINDER_H
 #define GDCORE_USED_EXTENSIONS_FINDER_H
+#include <memory>
 #include <set>
 
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
-#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/ParallelReadOnlyEventsWorker.h"
 #include "GDCore/IDE/Project/ArbitraryObjectsWorker.h"
 #include "GDCore/String.h"
 
@@ -67,7 +68,7 @@ private:
 
 class GD_CORE_API UsedExtensionsFinder
     : public ArbitraryObjectsWorker,
-      public ArbitraryEventsWorkerWithContext,
+      public ParallelReadOnlyEventsWorker,
       public ExpressionParser2NodeWorker {
  public:
   static const UsedExtensionsResult ScanProject(gd::Project& project);
@@ -84,8 +85,12 @@ class GD_CORE_API UsedExtensionsFinder
   // Behavior Visitor
   void DoVisitBehavior(gd::Behavior& behavior) override;
 
+  // Parallel events worker
+  std::unique_ptr<ParallelReadOnlyEventsWorker> Clone() const override;
+  void Reduce(const ParallelReadOnlyEventsWorker& clone) override;
+
   // Instructions Visitor
-  bool DoVisitInstruction(gd::Instruction& instruction,
+  void DoVisitInstruction(const gd::Instruction& instruction,
                           bool isCondition) override;
 
   // Expression Visitor
@@ -4,10 +4,44 @@
  * reserved. This project is released under the MIT License.
  */
 #include "NewNameGenerator.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
 
 namespace gd {
 
+namespace {
+/**
+ * \brief Split a name ending with a number (not starting with 0) into the
+ * radix and this number. Return 0 if the name does not end with a number.
+ */
+unsigned int SplitNameAndNumberSuffix(const gd::String &name,
+                                      gd::String &radix) {
+  const std::string &bytes = name.Raw();
+  std::size_t suffixStart = bytes.size();
+  while (suffixStart > 0 && bytes[suffixStart - 1] >= '0' &&
+         bytes[suffixStart - 1] <= '9')
+    --suffixStart;
+  while (suffixStart < bytes.size() && bytes[suffixStart] == '0')
+    ++suffixStart;
+  // Too long numbers are kept in the radix.
+  if (suffixStart == bytes.size() || bytes.size() - suffixStart > 9) {
+    radix = name;
+    return 0;
+  }
+
+  radix = gd::String::FromUTF8(bytes.substr(0, suffixStart));
+  return static_cast<unsigned int>(std::stoul(bytes.substr(suffixStart)));
+}
+}  // namespace
+
 gd::String NewNameGenerator::Generate(
     const gd::String &name,
     const gd::String &prefix,
@@ -27,4 +61,104 @@ gd::String NewNameGenerator::Generate(
   return NewNameGenerator::Generate(name, "", exists);
 }
 
+std::vector<gd::String> NewNameGenerator::GenerateAll(
+    const std::vector<gd::String> &names,
+    const gd::String &prefix,
+    const std::vector<gd::String> &existingNames) {
+  std::unordered_set<gd::String> usedNames(existingNames.begin(),
+                                           existingNames.end());
+  // The suffixes lower than the next one to try are all used, as names are
+  // never removed from usedNames.
+  struct NextSuffix {
+    gd::String radix;
+    unsigned int number;
+  };
+  std::unordered_map<gd::String, NextSuffix> nextSuffixes;
+
+  std::vector<gd::String> newNames;
+  newNames.reserve(names.size());
+  for (const gd::String &name : names) {
+    gd::String newName = name;
+    if (usedNames.find(newName) != usedNames.end()) {
+      newName = prefix + name;
+      if (usedNames.find(newName) != usedNames.end()) {
+        auto nextSuffixIt = nextSuffixes.find(newName);
+        if (nextSuffixIt == nextSuffixes.end()) {
+          gd::String radix;
+          unsigned int numberSuffix = SplitNameAndNumberSuffix(newName, radix);
+          nextSuffixIt =
+              nextSuffixes
+                  .emplace(newName,
+                           NextSuffix{radix,
+                                      numberSuffix ? numberSuffix + 1 : 2})
+                  .first;
+        }
+
+        NextSuffix &nextSuffix = nextSuffixIt->second;
+        do {
+          newName = nextSuffix.radix + gd::String::From(nextSuffix.number);
+          ++nextSuffix.number;
+        } while (usedNames.find(newName) != usedNames.end());
+      }
+    }
+
+    usedNames.insert(newName);
+    newNames.push_back(newName);
+  }
+
+  return newNames;
+}
+
+namespace {
+void AddObjectsAndGroupsNames(const gd::ObjectsContainer &objectsContainer,
+                              std::vector<gd::String> &names) {
+  for (const auto &object : objectsContainer.GetObjects())
+    names.push_back(object->GetName());
+
+  const auto &groups = objectsContainer.GetObjectGroups();
+  for (std::size_t i = 0; i < groups.size(); ++i)
+    names.push_back(groups[i].GetName());
+}
+}  // namespace
+
+std::vector<gd::String> NewNameGenerator::GenerateAllObjectNames(
+    const std::vector<gd::String> &names,
+    const gd::String &prefix,
+    const gd::ObjectsContainer &globalObjectsContainer,
+    const gd::ObjectsContainer &objectsContainer) {
+  std::vector<gd::String> existingNames;
+  AddObjectsAndGroupsNames(globalObjectsContainer, existingNames);
+  AddObjectsAndGroupsNames(objectsContainer, existingNames);
+  return GenerateAll(names, prefix, existingNames);
+}
+
+std::vector<gd::String> NewNameGenerator::GenerateAllLayerNames(
+    const std::vector<gd::String> &names,
+    const gd::String &prefix,
+    const gd::Layout &layout) {
+  std::vector<gd::String> existingNames;
+  for (std::size_t i = 0; i < layout.GetLayersCount(); ++i)
+    existingNames.push_back(layout.GetLayer(i).GetName());
+
+  return GenerateAll(names, prefix, existingNames);
+}
+
+std::vector<gd::String> NewNameGenerator::GenerateAllVariableNames(
+    const std::vector<gd::String> &names,
+    const gd::String &prefix,
+    const gd::VariablesContainer &variablesContainer) {
+  std::vector<gd::String> existingNames;
+  for (std::size_t i = 0; i < variablesContainer.Count(); ++i)
+    existingNames.push_back(variablesContainer.GetNameAt(i));
+
+  return GenerateAll(names, prefix, existingNames);
+}
+
+std::vector<gd::String> NewNameGenerator::GenerateAllResourceNames(
+    const std::vector<gd::String> &names,
+    const gd::String &prefix,
+    const gd::ResourcesManager &resourcesManager) {
+  return GenerateAll(names, prefix, resourcesManager.GetAllResourceNames());
+}
+
 }  // namespace gd
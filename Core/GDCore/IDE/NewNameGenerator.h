@@ -6,8 +6,13 @@
 #ifndef GDCORE_NEWNAMEGENERATOR_H
 #define GDCORE_NEWNAMEGENERATOR_H
 #include <functional>
+#include <vector>
 namespace gd {
 class String;
+class ObjectsContainer;
+class Layout;
+class VariablesContainer;
+class ResourcesManager;
 }
 
 namespace gd {
@@ -31,6 +36,56 @@ class GD_CORE_API NewNameGenerator {
   static gd::String Generate(const gd::String &name,
                              std::function<bool(const gd::String &)> exists);
 
+  /**
+   * \brief Generate a unique name for each of the given names, like calling
+   * Generate for each name one after the other (each generated name being
+   * then used), but in a single pass.
+   *
+   * Like in the editor, a number ending the name is incremented instead of
+   * having a suffix added (a copy of "Enemy2" is named "Enemy3", not
+   * "Enemy22").
+   *
+   * The existing names are put in a set once and the next suffix to try is
+   * remembered for each name, so that generating names for n copies of an
+   * element doesn't try again the suffixes already used by the previous
+   * copies.
+   */
+  static std::vector<gd::String> GenerateAll(
+      const std::vector<gd::String> &names,
+      const gd::String &prefix,
+      const std::vector<gd::String> &existingNames);
+
+  /** \name Unique names for elements of containers
+   * Generate unique names for elements to be added (pasted or duplicated) to
+   * a container. See GenerateAll.
+   */
+  ///@{
+  /**
+   * \brief Generate unique names for objects, not used by objects or groups
+   * of both containers.
+   */
+  static std::vector<gd::String> GenerateAllObjectNames(
+      const std::vector<gd::String> &names,
+      const gd::String &prefix,
+      const gd::ObjectsContainer &globalObjectsContainer,
+      const gd::ObjectsContainer &objectsContainer);
+
+  static std::vector<gd::String> GenerateAllLayerNames(
+      const std::vector<gd::String> &names,
+      const gd::String &prefix,
+      const gd::Layout &layout);
+
+  static std::vector<gd::String> GenerateAllVariableNames(
+      const std::vector<gd::String> &names,
+      const gd::String &prefix,
+      const gd::VariablesContainer &variablesContainer);
+
+  static std::vector<gd::String> GenerateAllResourceNames(
+      const std::vector<gd::String> &names,
+      const gd::String &prefix,
+      const gd::ResourcesManager &resourcesManager);
+  ///@}
+
  private:
   NewNameGenerator();
   ~NewNameGenerator();
@@ -180,6 +180,50 @@ void ArbitraryResourceWorker::ExposeResource(gd::Resource& resource) {
 
 ArbitraryResourceWorker::~ArbitraryResourceWorker() {}
 
+/**
+ * Expose, with the specified resource worker, the resource used by a parameter
+ * of an instruction.
+ *
+ * \return false if the parameter is not a resource.
+ */
+static bool ExposeResourceParameter(gd::ArbitraryResourceWorker& worker,
+                                    const gd::String& parameterType,
+                                    gd::String& parameterValue) {
+  if (parameterType == "police" ||  // Should be renamed fontResource
+      parameterType == "fontResource") {
+    worker.ExposeFont(parameterValue);
+  } else if (parameterType == "soundfile" ||
+             parameterType == "musicfile") {  // Should be renamed audioResource
+    worker.ExposeAudio(parameterValue);
+  } else if (parameterType == "bitmapFontResource") {
+    worker.ExposeBitmapFont(parameterValue);
+  } else if (parameterType == "imageResource") {
+    worker.ExposeImage(parameterValue);
+  } else if (parameterType == "jsonResource") {
+    worker.ExposeJson(parameterValue);
+  } else if (parameterType == "tilemapResource") {
+    worker.ExposeTilemap(parameterValue);
+  } else if (parameterType == "tilesetResource") {
+    worker.ExposeTileset(parameterValue);
+  } else if (parameterType == "model3DResource") {
+    worker.ExposeModel3D(parameterValue);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+static const gd::InstructionMetadata& GetInstructionMetadata(
+    const gd::Project& project,
+    const gd::Instruction& instruction,
+    bool isCondition) {
+  const auto& platform = project.GetCurrentPlatform();
+  return isCondition ? gd::MetadataProvider::GetConditionMetadata(
+                           platform, instruction.GetInternedType())
+                     : gd::MetadataProvider::GetActionMetadata(
+                           platform, instruction.GetInternedType());
+}
+
 /**
  * Launch the specified resource worker on every resource referenced in the
  * events.
@@ -193,58 +237,19 @@ class ResourceWorkerInEventsWorker : public ArbitraryEventsWorker {
 
  private:
   bool DoVisitInstruction(gd::Instruction& instruction, bool isCondition) {
-    const auto& platform = project.GetCurrentPlatform();
-    const auto& metadata = isCondition
-                               ? gd::MetadataProvider::GetConditionMetadata(
-                                     platform, instruction.GetType())
-                               : gd::MetadataProvider::GetActionMetadata(
-                                     platform, instruction.GetType());
-
     gd::ParameterMetadataTools::IterateOverParametersWithIndex(
         instruction.GetParameters(),
-        metadata.GetParameters(),
+        GetInstructionMetadata(project, instruction, isCondition)
+            .GetParameters(),
         [this, &instruction](const gd::ParameterMetadata& parameterMetadata,
                              const gd::Expression& parameterExpression,
                              size_t parameterIndex,
                              const gd::String& lastObjectName) {
-          const String& parameterValue = parameterExpression.GetPlainString();
-          if (parameterMetadata.GetType() ==
-                  "police" ||  // Should be renamed fontResource
-              parameterMetadata.GetType() == "fontResource") {
-            gd::String updatedParameterValue = parameterValue;
-            worker.ExposeFont(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
-          } else if (parameterMetadata.GetType() == "soundfile" ||
-                     parameterMetadata.GetType() ==
-                         "musicfile") {  // Should be renamed audioResource
-            gd::String updatedParameterValue = parameterValue;
-            worker.ExposeAudio(updatedParameterValue);
+          gd::String updatedParameterValue =
+              parameterExpression.GetPlainString();
+          if (ExposeResourceParameter(
+                  worker, parameterMetadata.GetType(), updatedParameterValue))
             instruction.SetParameter(parameterIndex, updatedParameterValue);
-          } else if (parameterMetadata.GetType() == "bitmapFontResource") {
-            gd::String updatedParameterValue = parameterValue;
-            worker.ExposeBitmapFont(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
-          } else if (parameterMetadata.GetType() == "imageResource") {
-            gd::String updatedParameterValue = parameterValue;
-            worker.ExposeImage(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
-          } else if (parameterMetadata.GetType() == "jsonResource") {
-            gd::String updatedParameterValue = parameterValue;
-            worker.ExposeJson(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
-          } else if (parameterMetadata.GetType() == "tilemapResource") {
-            gd::String updatedParameterValue = parameterValue;
-            worker.ExposeTilemap(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
-          } else if (parameterMetadata.GetType() == "tilesetResource") {
-            gd::String updatedParameterValue = parameterValue;
-            worker.ExposeTileset(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
-          } else if (parameterMetadata.GetType() == "model3DResource") {
-            gd::String updatedParameterValue = parameterValue;
-            worker.ExposeModel3D(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
-          }
         });
 
     return false;
@@ -254,6 +259,50 @@ class ResourceWorkerInEventsWorker : public ArbitraryEventsWorker {
   gd::ArbitraryResourceWorker& worker;
 };
 
+/**
+ * Launch the specified resource worker on every resource referenced in the
+ * events, without changing the events, and check if the worker changed any of
+ * the resources.
+ */
+class ResourceWorkerInReadOnlyEventsWorker
+    : public ReadOnlyArbitraryEventsWorker {
+ public:
+  ResourceWorkerInReadOnlyEventsWorker(const gd::Project& project_,
+                                       gd::ArbitraryResourceWorker& worker_)
+      : project(project_), worker(worker_), hasChanges(false){};
+  virtual ~ResourceWorkerInReadOnlyEventsWorker(){};
+
+  bool HasChanges() const { return hasChanges; };
+
+ private:
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override {
+    gd::ParameterMetadataTools::IterateOverParametersWithIndex(
+        instruction.GetParameters(),
+        GetInstructionMetadata(project, instruction, isCondition)
+            .GetParameters(),
+        [this](const gd::ParameterMetadata& parameterMetadata,
+               const gd::Expression& parameterExpression,
+               size_t parameterIndex,
+               const gd::String& lastObjectName) {
+          if (hasChanges) return;
+
+          const gd::String& parameterValue =
+              parameterExpression.GetPlainString();
+          gd::String updatedParameterValue = parameterValue;
+          ExposeResourceParameter(
+              worker, parameterMetadata.GetType(), updatedParameterValue);
+          if (updatedParameterValue != parameterValue) hasChanges = true;
+        });
+
+    if (hasChanges) StopAnyEventIteration();
+  };
+
+  const gd::Project& project;
+  gd::ArbitraryResourceWorker& worker;
+  bool hasChanges;
+};
+
 void LaunchResourceWorkerOnEvents(const gd::Project& project,
                                   gd::EventsList& events,
                                   gd::ArbitraryResourceWorker& worker) {
@@ -261,5 +310,13 @@ void LaunchResourceWorkerOnEvents(const gd::Project& project,
   eventsWorker.Launch(events);
 }
 
+bool LaunchResourceWorkerOnReadOnlyEvents(const gd::Project& project,
+                                          const gd::EventsList& events,
+                                          gd::ArbitraryResourceWorker& worker) {
+  ResourceWorkerInReadOnlyEventsWorker eventsWorker(project, worker);
+  eventsWorker.Launch(events);
+  return eventsWorker.HasChanges();
+}
+
 }  // namespace gd
 #endif
@@ -144,6 +144,22 @@ LaunchResourceWorkerOnEvents(const gd::Project &project,
                              gd::EventsList &events,
                              gd::ArbitraryResourceWorker &worker);
 
+/**
+ * Tool function iterating over each event like
+ * gd::LaunchResourceWorkerOnEvents, but without modifying the events.
+ *
+ * \return true if the worker changed a resource used by the events, in which
+ * case gd::LaunchResourceWorkerOnEvents must be used to update the events
+ * (the worker is then called again for some of the resources).
+ *
+ * \see gd::ArbitraryResourceWorker
+ * \ingroup IDE
+ */
+bool GD_CORE_API
+LaunchResourceWorkerOnReadOnlyEvents(const gd::Project &project,
+                                     const gd::EventsList &events,
+                                     gd::ArbitraryResourceWorker &worker);
+
 }  // namespace gd
 
 #endif  // ARBITRARYRESOURCEWORKER_H
@@ -15,6 +15,7 @@ class EventsBasedBehavior;
 class EventsBasedObject;
 class ArbitraryEventsWorker;
 class ArbitraryEventsWorkerWithContext;
+class ArbitraryEventsWorkersComposite;
 class ArbitraryEventsFunctionsWorker;
 class ArbitraryObjectsWorker;
 class ArbitraryEventBasedBehaviorsWorker;
@@ -44,6 +45,17 @@ public:
   ExposeEvents(gd::Project &project,
                gd::ArbitraryEventsWorkerWithContext &worker) const = 0;
 
+  /**
+   * \brief Call the specified workers on all events of a project subset, in a
+   * single traversal.
+   *
+   * Each worker is called on the same events as if it was given alone to
+   * ExposeEvents.
+   */
+  virtual void
+  ExposeEvents(gd::Project &project,
+               gd::ArbitraryEventsWorkersComposite &worker) const = 0;
+
   /**
    * \brief Call the specified worker on all ObjectContainer of a project subset
    *
@@ -6,6 +6,8 @@
 #include "ProjectBrowserHelper.h"
 
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersComposite.h"
+#include "GDCore/IDE/Events/ParallelReadOnlyEventsWorker.h"
 #include "GDCore/IDE/EventsFunctionTools.h"
 #include "GDCore/IDE/Project/ArbitraryEventBasedBehaviorsWorker.h"
 #include "GDCore/IDE/Project/ArbitraryEventsFunctionsWorker.h"
@@ -18,9 +20,49 @@
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/ForEachInParallel.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
 
 namespace gd {
 
+namespace {
+
+using ParallelEventsTask =
+    std::function<void(gd::ParallelReadOnlyEventsWorker &worker)>;
+
+/**
+ * \brief Run each task with its own clone of the worker, then reduce the
+ * clones in the order of the tasks.
+ */
+void RunInParallel(const std::vector<ParallelEventsTask> &tasks,
+                   gd::ParallelReadOnlyEventsWorker &worker,
+                   std::size_t threadsCount) {
+  std::vector<std::unique_ptr<gd::ParallelReadOnlyEventsWorker>> clones;
+  clones.reserve(tasks.size());
+  for (std::size_t i = 0; i < tasks.size(); ++i)
+    clones.push_back(worker.Clone());
+
+  gd::ForEachInParallel(tasks.size(), threadsCount,
+                        [&](std::size_t i) { tasks[i](*clones[i]); });
+
+  for (auto &clone : clones) worker.Reduce(*clone);
+}
+
+void AddLayoutsEventsTasks(const gd::Project &project,
+                           std::vector<ParallelEventsTask> &tasks) {
+  for (std::size_t s = 0; s < project.GetLayoutsCount(); s++) {
+    const auto &layout = project.GetLayout(s);
+    tasks.push_back([&project, &layout](gd::ParallelReadOnlyEventsWorker &worker) {
+      worker.Launch(layout.GetEvents(), project, layout);
+    });
+  }
+}
+
+} // namespace
+
 void ProjectBrowserHelper::ExposeProjectEvents(
     gd::Project &project, gd::ArbitraryEventsWorker &worker) {
   // See also gd::Project::ExposeResources for a method that traverses the whole
@@ -67,6 +109,114 @@ void ProjectBrowserHelper::ExposeProjectEventsWithoutExtensions(
   }
 }
 
+void ProjectBrowserHelper::ExposeProjectEventsInParallel(
+    gd::Project &project, gd::ParallelReadOnlyEventsWorker &worker,
+    std::size_t threadsCount) {
+  // Same events as the ExposeProjectEvents with context. The objects
+  // containers of events functions are built by the tasks, as they are only
+  // needed while their events are visited.
+  std::vector<ParallelEventsTask> tasks;
+  AddLayoutsEventsTasks(project, tasks);
+  for (std::size_t s = 0; s < project.GetExternalEventsCount(); s++) {
+    const auto &externalEvents = project.GetExternalEvents(s);
+    const gd::String &associatedLayout = externalEvents.GetAssociatedLayout();
+    if (project.HasLayoutNamed(associatedLayout)) {
+      const auto &layout = project.GetLayout(associatedLayout);
+      tasks.push_back([&project, &externalEvents,
+                       &layout](gd::ParallelReadOnlyEventsWorker &worker) {
+        worker.Launch(externalEvents.GetEvents(), project, layout);
+      });
+    }
+  }
+
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       e++) {
+    const auto &eventsFunctionsExtension =
+        project.GetEventsFunctionsExtension(e);
+    for (auto &&eventsFunction : eventsFunctionsExtension.GetInternalVector()) {
+      const gd::EventsFunction *function = eventsFunction.get();
+      tasks.push_back([&project, &eventsFunctionsExtension,
+                       function](gd::ParallelReadOnlyEventsWorker &worker) {
+        gd::ObjectsContainer globalObjectsAndGroups;
+        gd::ObjectsContainer objectsAndGroups;
+        gd::EventsFunctionTools::FreeEventsFunctionToObjectsContainer(
+            project, eventsFunctionsExtension, *function,
+            globalObjectsAndGroups, objectsAndGroups);
+
+        worker.Launch(function->GetEvents(), globalObjectsAndGroups,
+                      objectsAndGroups);
+      });
+    }
+
+    for (auto &&eventsBasedBehavior :
+         eventsFunctionsExtension.GetEventsBasedBehaviors()
+             .GetInternalVector()) {
+      const gd::EventsBasedBehavior *behavior = eventsBasedBehavior.get();
+      for (auto &&eventsFunction :
+           behavior->GetEventsFunctions().GetInternalVector()) {
+        const gd::EventsFunction *function = eventsFunction.get();
+        tasks.push_back([&project, behavior,
+                         function](gd::ParallelReadOnlyEventsWorker &worker) {
+          gd::ObjectsContainer globalObjectsAndGroups;
+          gd::ObjectsContainer objectsAndGroups;
+          gd::EventsFunctionTools::BehaviorEventsFunctionToObjectsContainer(
+              project, *behavior, *function, globalObjectsAndGroups,
+              objectsAndGroups);
+
+          worker.Launch(function->GetEvents(), globalObjectsAndGroups,
+                        objectsAndGroups);
+        });
+      }
+    }
+
+    for (auto &&eventsBasedObject :
+         eventsFunctionsExtension.GetEventsBasedObjects().GetInternalVector()) {
+      const gd::EventsBasedObject *object = eventsBasedObject.get();
+      for (auto &&eventsFunction :
+           object->GetEventsFunctions().GetInternalVector()) {
+        const gd::EventsFunction *function = eventsFunction.get();
+        tasks.push_back([&project, object,
+                         function](gd::ParallelReadOnlyEventsWorker &worker) {
+          gd::ObjectsContainer globalObjectsAndGroups;
+          gd::ObjectsContainer objectsAndGroups;
+          gd::EventsFunctionTools::ObjectEventsFunctionToObjectsContainer(
+              project, *object, *function, globalObjectsAndGroups,
+              objectsAndGroups);
+
+          worker.Launch(function->GetEvents(), globalObjectsAndGroups,
+                        objectsAndGroups);
+        });
+      }
+    }
+  }
+
+  RunInParallel(tasks, worker, threadsCount);
+}
+
+void ProjectBrowserHelper::ExposeProjectEventsWithoutExtensionsInParallel(
+    gd::Project &project, gd::ParallelReadOnlyEventsWorker &worker,
+    std::size_t threadsCount) {
+  std::vector<ParallelEventsTask> tasks;
+  AddLayoutsEventsTasks(project, tasks);
+
+  gd::ObjectsContainer emptyObjectsContainer;
+  for (std::size_t s = 0; s < project.GetExternalEventsCount(); s++) {
+    const auto &externalEvents = project.GetExternalEvents(s);
+    const gd::String &associatedLayout = externalEvents.GetAssociatedLayout();
+    const gd::ObjectsContainer &objectsContainer =
+        project.HasLayoutNamed(associatedLayout)
+            ? static_cast<const gd::ObjectsContainer &>(
+                  project.GetLayout(associatedLayout))
+            : emptyObjectsContainer;
+    tasks.push_back([&project, &externalEvents,
+                     &objectsContainer](gd::ParallelReadOnlyEventsWorker &worker) {
+      worker.Launch(externalEvents.GetEvents(), project, objectsContainer);
+    });
+  }
+
+  RunInParallel(tasks, worker, threadsCount);
+}
+
 void ProjectBrowserHelper::ExposeLayoutEvents(
     gd::Project &project, gd::Layout &layout,
     gd::ArbitraryEventsWorker &worker) {
@@ -150,6 +300,21 @@ void ProjectBrowserHelper::ExposeProjectEvents(
   }
 }
 
+void ProjectBrowserHelper::ExposeProjectEvents(
+    gd::Project &project, gd::ArbitraryEventsWorkersComposite &worker) {
+  ExposeProjectEvents(
+      project, static_cast<gd::ArbitraryEventsWorkerWithContext &>(worker));
+
+  // External events without associated layout are only given to workers not
+  // needing the context.
+  for (std::size_t s = 0; s < project.GetExternalEventsCount(); s++) {
+    auto &externalEvents = project.GetExternalEvents(s);
+    if (!project.HasLayoutNamed(externalEvents.GetAssociatedLayout())) {
+      worker.LaunchWithoutContext(externalEvents.GetEvents());
+    }
+  }
+}
+
 void ProjectBrowserHelper::ExposeEventsBasedBehaviorEvents(
     gd::Project &project, const gd::EventsBasedBehavior &eventsBasedBehavior,
     gd::ArbitraryEventsWorker &worker) {
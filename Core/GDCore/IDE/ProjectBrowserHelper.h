@@ -4,6 +4,7 @@
  * reserved. This project is released under the MIT License.
  */
 #pragma once
+#include <cstddef>
 
 namespace gd {
 class Project;
@@ -15,6 +16,8 @@ class EventsBasedBehavior;
 class EventsBasedObject;
 class ArbitraryEventsWorker;
 class ArbitraryEventsWorkerWithContext;
+class ArbitraryEventsWorkersComposite;
+class ParallelReadOnlyEventsWorker;
 class ArbitraryEventsFunctionsWorker;
 class ArbitraryObjectsWorker;
 class ArbitraryEventBasedBehaviorsWorker;
@@ -46,6 +49,16 @@ public:
   static void ExposeProjectEvents(gd::Project &project,
                                   gd::ArbitraryEventsWorkerWithContext &worker);
 
+  /**
+   * \brief Call the specified workers on all events of the project (layout,
+   * external events, events functions...) in a single traversal.
+   *
+   * Each worker is called on the same events as if it was given alone to
+   * ExposeProjectEvents.
+   */
+  static void ExposeProjectEvents(gd::Project &project,
+                                  gd::ArbitraryEventsWorkersComposite &worker);
+
   /**
    * \brief Call the specified worker on all events of the project (layout and
    * external events) but not events from extensions.
@@ -56,6 +69,30 @@ public:
   ExposeProjectEventsWithoutExtensions(gd::Project &project,
                                        gd::ArbitraryEventsWorker &worker);
 
+  /**
+   * \brief Call clones of the specified worker on the same events as
+   * ExposeProjectEvents, each events list (or events function) being given to
+   * a clone on one of \a threadsCount threads (0 for one per hardware thread).
+   * The results of the clones are then reduced into \a worker.
+   *
+   * The events are only visited on the calling thread with Emscripten.
+   */
+  static void ExposeProjectEventsInParallel(
+      gd::Project &project, gd::ParallelReadOnlyEventsWorker &worker,
+      std::size_t threadsCount = 0);
+
+  /**
+   * \brief Call clones of the specified worker on all events of the project
+   * (layout and external events) but not events from extensions, in parallel
+   * like ExposeProjectEventsInParallel.
+   *
+   * External events without associated layout are given with empty objects
+   * containers. Only use this for stats.
+   */
+  static void ExposeProjectEventsWithoutExtensionsInParallel(
+      gd::Project &project, gd::ParallelReadOnlyEventsWorker &worker,
+      std::size_t threadsCount = 0);
+
   /**
    * \brief Call the specified worker on all events of a layout and
    * its external events.
@@ -21,7 +21,7 @@ void GD_CORE_API ProjectStripper::StripProjectForExport(gd::Project &project) {
 
   for (unsigned int i = 0; i < project.GetLayoutsCount(); ++i) {
     project.GetLayout(i).GetObjectGroups().Clear();
-    project.GetLayout(i).GetEvents().Clear();
+    project.GetLayout(i).ClearEvents();
   }
 
   // Keep the EventsBasedObject object list because it's useful for the Runtime
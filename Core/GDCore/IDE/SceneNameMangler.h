@@ -6,6 +6,7 @@
 
 #ifndef SCENENAMEMANGLER_H
 #define SCENENAMEMANGLER_H
+#include <mutex>
 #include <unordered_map>
 #include "GDCore/String.h"
 
@@ -25,7 +26,7 @@ class GD_CORE_API SceneNameMangler {
    * must be a letter, otherwise it is also replaced in the same manner.
    *
    * The mangled name is memoized as this is intensively used during project
-   * export and events code generation.
+   * export and events code generation. This can be called concurrently.
    */
   const gd::String& GetMangledSceneName(const gd::String& sceneName);
 
@@ -39,6 +40,7 @@ class GD_CORE_API SceneNameMangler {
 
   std::unordered_map<gd::String, gd::String>
       mangledSceneNames;  ///< Memoized results of mangling
+  std::mutex mutex;       ///< Protects the memoized results.
 };
 
 }  // namespace gd
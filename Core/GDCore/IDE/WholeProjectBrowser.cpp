@@ -6,6 +6,7 @@
 #include "WholeProjectBrowser.h"
 
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersComposite.h"
 #include "GDCore/IDE/Project/ArbitraryEventBasedBehaviorsWorker.h"
 #include "GDCore/IDE/Project/ArbitraryEventsFunctionsWorker.h"
 #include "GDCore/IDE/Project/ArbitraryObjectsWorker.h"
@@ -26,6 +27,11 @@ void WholeProjectBrowser::ExposeEvents(
   gd::ProjectBrowserHelper::ExposeProjectEvents(project, worker);
 }
 
+void WholeProjectBrowser::ExposeEvents(
+    gd::Project &project, gd::ArbitraryEventsWorkersComposite &worker) const {
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, worker);
+}
+
 void WholeProjectBrowser::ExposeObjects(
     gd::Project &project, gd::ArbitraryObjectsWorker &worker) const {
   gd::ProjectBrowserHelper::ExposeProjectObjects(project, worker);
@@ -16,6 +16,7 @@ class EventsBasedBehavior;
 class EventsBasedObject;
 class ArbitraryEventsWorker;
 class ArbitraryEventsWorkerWithContext;
+class ArbitraryEventsWorkersComposite;
 class ArbitraryEventsFunctionsWorker;
 class ArbitraryObjectsWorker;
 class ArbitraryEventBasedBehaviorsWorker;
@@ -48,6 +49,16 @@ public:
   ExposeEvents(gd::Project &project,
                gd::ArbitraryEventsWorkerWithContext &worker) const override;
 
+  /**
+   * \brief Call the specified workers on all events of the project (layout,
+   * external events, events functions...) in a single traversal.
+   *
+   * \see gd::ProjectBrowserHelper::ExposeProjectEvents
+   */
+  void
+  ExposeEvents(gd::Project &project,
+               gd::ArbitraryEventsWorkersComposite &worker) const override;
+
   /**
    * \brief Call the specified worker on all ObjectContainers of the project
    * (global, layouts...)
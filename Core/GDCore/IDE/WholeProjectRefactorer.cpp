@@ -10,12 +10,14 @@
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/DependenciesAnalyzer.h"
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersComposite.h"
 #include "GDCore/IDE/Events/EventsBehaviorRenamer.h"
 #include "GDCore/IDE/Events/ProjectElementRenamer.h"
 #include "GDCore/IDE/Events/LinkEventTargetRenamer.h"
 #include "GDCore/IDE/Events/CustomObjectTypeRenamer.h"
 #include "GDCore/IDE/Events/BehaviorTypeRenamer.h"
 #include "GDCore/IDE/Events/EventsRefactorer.h"
+#include "GDCore/IDE/Events/EventsReferencesIndex.h"
 #include "GDCore/IDE/Events/ExpressionsParameterMover.h"
 #include "GDCore/IDE/Events/ExpressionsRenamer.h"
 #include "GDCore/IDE/Events/InstructionsParameterMover.h"
@@ -463,30 +465,30 @@ void WholeProjectRefactorer::RenameBehaviorEventsFunction(
   const gd::EventsFunction& eventsFunction =
       eventsFunctions.GetEventsFunction(oldFunctionName);
 
-  // Order is important: we first rename the expressions then the instructions,
-  // to avoid being unable to fetch the metadata (the types of parameters) of
+  // Order is important: we first rename the expressions then the instructions
+  // (the workers are called in this order on each instruction), to avoid
+  // being unable to fetch the metadata (the types of parameters) of
   // instructions after they are renamed.
-  if (eventsFunction.IsExpression()) {
-    gd::ExpressionsRenamer renamer =
-        gd::ExpressionsRenamer(project.GetCurrentPlatform());
-    renamer.SetReplacedBehaviorExpression(
-        gd::PlatformExtension::GetBehaviorFullType(eventsFunctionsExtension.GetName(),
-                            eventsBasedBehavior.GetName()),
-        oldFunctionName,
-        newFunctionName);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
-  }
-  if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
-    gd::InstructionsTypeRenamer renamer = gd::InstructionsTypeRenamer(
-        project,
-        gd::PlatformExtension::GetBehaviorEventsFunctionFullType(eventsFunctionsExtension.GetName(),
-                                          eventsBasedBehavior.GetName(),
-                                          oldFunctionName),
-        gd::PlatformExtension::GetBehaviorEventsFunctionFullType(eventsFunctionsExtension.GetName(),
-                                          eventsBasedBehavior.GetName(),
-                                          newFunctionName));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
-  }
+  gd::ExpressionsRenamer expressionRenamer =
+      gd::ExpressionsRenamer(project.GetCurrentPlatform());
+  expressionRenamer.SetReplacedBehaviorExpression(
+      gd::PlatformExtension::GetBehaviorFullType(eventsFunctionsExtension.GetName(),
+                          eventsBasedBehavior.GetName()),
+      oldFunctionName,
+      newFunctionName);
+  gd::InstructionsTypeRenamer instructionRenamer = gd::InstructionsTypeRenamer(
+      project,
+      gd::PlatformExtension::GetBehaviorEventsFunctionFullType(eventsFunctionsExtension.GetName(),
+                                        eventsBasedBehavior.GetName(),
+                                        oldFunctionName),
+      gd::PlatformExtension::GetBehaviorEventsFunctionFullType(eventsFunctionsExtension.GetName(),
+                                        eventsBasedBehavior.GetName(),
+                                        newFunctionName));
+  gd::ArbitraryEventsWorkersComposite renamers;
+  if (eventsFunction.IsExpression()) renamers.AddWorker(expressionRenamer);
+  if (eventsFunction.IsAction() || eventsFunction.IsCondition())
+    renamers.AddWorker(instructionRenamer);
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamers);
   if (eventsFunction.GetFunctionType() == gd::EventsFunction::ExpressionAndCondition) {
     for (auto&& otherFunction : eventsBasedBehavior.GetEventsFunctions().GetInternalVector())
     {
@@ -510,27 +512,30 @@ void WholeProjectRefactorer::RenameObjectEventsFunction(
   const gd::EventsFunction& eventsFunction =
       eventsFunctions.GetEventsFunction(oldFunctionName);
 
-  if (eventsFunction.IsExpression()) {
-    gd::ExpressionsRenamer renamer =
-        gd::ExpressionsRenamer(project.GetCurrentPlatform());
-    renamer.SetReplacedObjectExpression(
-        gd::PlatformExtension::GetObjectFullType(eventsFunctionsExtension.GetName(),
-                            eventsBasedObject.GetName()),
-        oldFunctionName,
-        newFunctionName);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
-  }
-  if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
-    gd::InstructionsTypeRenamer renamer = gd::InstructionsTypeRenamer(
-        project,
-        gd::PlatformExtension::GetObjectEventsFunctionFullType(eventsFunctionsExtension.GetName(),
-                                          eventsBasedObject.GetName(),
-                                          oldFunctionName),
-        gd::PlatformExtension::GetObjectEventsFunctionFullType(eventsFunctionsExtension.GetName(),
-                                          eventsBasedObject.GetName(),
-                                          newFunctionName));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
-  }
+  // Order is important: we first rename the expressions then the instructions
+  // (the workers are called in this order on each instruction), to avoid
+  // being unable to fetch the metadata (the types of parameters) of
+  // instructions after they are renamed.
+  gd::ExpressionsRenamer expressionRenamer =
+      gd::ExpressionsRenamer(project.GetCurrentPlatform());
+  expressionRenamer.SetReplacedObjectExpression(
+      gd::PlatformExtension::GetObjectFullType(eventsFunctionsExtension.GetName(),
+                          eventsBasedObject.GetName()),
+      oldFunctionName,
+      newFunctionName);
+  gd::InstructionsTypeRenamer instructionRenamer = gd::InstructionsTypeRenamer(
+      project,
+      gd::PlatformExtension::GetObjectEventsFunctionFullType(eventsFunctionsExtension.GetName(),
+                                        eventsBasedObject.GetName(),
+                                        oldFunctionName),
+      gd::PlatformExtension::GetObjectEventsFunctionFullType(eventsFunctionsExtension.GetName(),
+                                        eventsBasedObject.GetName(),
+                                        newFunctionName));
+  gd::ArbitraryEventsWorkersComposite renamers;
+  if (eventsFunction.IsExpression()) renamers.AddWorker(expressionRenamer);
+  if (eventsFunction.IsAction() || eventsFunction.IsCondition())
+    renamers.AddWorker(instructionRenamer);
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamers);
   if (eventsFunction.GetFunctionType() == gd::EventsFunction::ExpressionAndCondition) {
     for (auto&& otherFunction : eventsBasedObject.GetEventsFunctions().GetInternalVector())
     {
@@ -556,22 +561,21 @@ void WholeProjectRefactorer::MoveEventsFunctionParameter(
   const gd::String& eventsFunctionType = gd::PlatformExtension::GetEventsFunctionFullType(
       eventsFunctionsExtension.GetName(), functionName);
 
-  if (eventsFunction.IsExpression()) {
-    gd::ExpressionsParameterMover mover =
-        gd::ExpressionsParameterMover(project.GetCurrentPlatform());
-    mover.SetFreeExpressionMovedParameter(
-        eventsFunctionType, oldIndex, newIndex);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, mover);
-  }
-  if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
-    const int operatorIndexOffset = eventsFunction.IsExpression() ? 2 : 0;
-    gd::InstructionsParameterMover mover = gd::InstructionsParameterMover(
-        project,
-        eventsFunctionType,
-        oldIndex + operatorIndexOffset,
-        newIndex + operatorIndexOffset);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, mover);
-  }
+  gd::ExpressionsParameterMover expressionMover =
+      gd::ExpressionsParameterMover(project.GetCurrentPlatform());
+  expressionMover.SetFreeExpressionMovedParameter(
+      eventsFunctionType, oldIndex, newIndex);
+  const int operatorIndexOffset = eventsFunction.IsExpression() ? 2 : 0;
+  gd::InstructionsParameterMover instructionMover =
+      gd::InstructionsParameterMover(project,
+                                     eventsFunctionType,
+                                     oldIndex + operatorIndexOffset,
+                                     newIndex + operatorIndexOffset);
+  gd::ArbitraryEventsWorkersComposite movers;
+  if (eventsFunction.IsExpression()) movers.AddWorker(expressionMover);
+  if (eventsFunction.IsAction() || eventsFunction.IsCondition())
+    movers.AddWorker(instructionMover);
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, movers);
 }
 
 void WholeProjectRefactorer::MoveBehaviorEventsFunctionParameter(
@@ -592,26 +596,25 @@ void WholeProjectRefactorer::MoveBehaviorEventsFunctionParameter(
                                         eventsBasedBehavior.GetName(),
                                         functionName);
 
-  if (eventsFunction.IsExpression()) {
-    gd::ExpressionsParameterMover mover =
-        gd::ExpressionsParameterMover(project.GetCurrentPlatform());
-    mover.SetBehaviorExpressionMovedParameter(
-        gd::PlatformExtension::GetBehaviorFullType(eventsFunctionsExtension.GetName(),
-                            eventsBasedBehavior.GetName()),
-        functionName,
-        oldIndex,
-        newIndex);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, mover);
-  }
-  if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
-    const int operatorIndexOffset = eventsFunction.IsExpression() ? 2 : 0;
-    gd::InstructionsParameterMover mover = gd::InstructionsParameterMover(
-        project,
-        eventsFunctionType,
-        oldIndex + operatorIndexOffset,
-        newIndex + operatorIndexOffset);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, mover);
-  }
+  gd::ExpressionsParameterMover expressionMover =
+      gd::ExpressionsParameterMover(project.GetCurrentPlatform());
+  expressionMover.SetBehaviorExpressionMovedParameter(
+      gd::PlatformExtension::GetBehaviorFullType(eventsFunctionsExtension.GetName(),
+                          eventsBasedBehavior.GetName()),
+      functionName,
+      oldIndex,
+      newIndex);
+  const int operatorIndexOffset = eventsFunction.IsExpression() ? 2 : 0;
+  gd::InstructionsParameterMover instructionMover =
+      gd::InstructionsParameterMover(project,
+                                     eventsFunctionType,
+                                     oldIndex + operatorIndexOffset,
+                                     newIndex + operatorIndexOffset);
+  gd::ArbitraryEventsWorkersComposite movers;
+  if (eventsFunction.IsExpression()) movers.AddWorker(expressionMover);
+  if (eventsFunction.IsAction() || eventsFunction.IsCondition())
+    movers.AddWorker(instructionMover);
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, movers);
 }
 
 void WholeProjectRefactorer::MoveObjectEventsFunctionParameter(
@@ -632,26 +635,25 @@ void WholeProjectRefactorer::MoveObjectEventsFunctionParameter(
                                         eventsBasedObject.GetName(),
                                         functionName);
 
-  if (eventsFunction.IsExpression()) {
-    gd::ExpressionsParameterMover mover =
-        gd::ExpressionsParameterMover(project.GetCurrentPlatform());
-    mover.SetObjectExpressionMovedParameter(
-        gd::PlatformExtension::GetObjectFullType(eventsFunctionsExtension.GetName(),
-                            eventsBasedObject.GetName()),
-        functionName,
-        oldIndex,
-        newIndex);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, mover);
-  }
-  if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
-    const int operatorIndexOffset = eventsFunction.IsExpression() ? 2 : 0;
-    gd::InstructionsParameterMover mover = gd::InstructionsParameterMover(
-        project,
-        eventsFunctionType,
-        oldIndex + operatorIndexOffset,
-        newIndex + operatorIndexOffset);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, mover);
-  }
+  gd::ExpressionsParameterMover expressionMover =
+      gd::ExpressionsParameterMover(project.GetCurrentPlatform());
+  expressionMover.SetObjectExpressionMovedParameter(
+      gd::PlatformExtension::GetObjectFullType(eventsFunctionsExtension.GetName(),
+                          eventsBasedObject.GetName()),
+      functionName,
+      oldIndex,
+      newIndex);
+  const int operatorIndexOffset = eventsFunction.IsExpression() ? 2 : 0;
+  gd::InstructionsParameterMover instructionMover =
+      gd::InstructionsParameterMover(project,
+                                     eventsFunctionType,
+                                     oldIndex + operatorIndexOffset,
+                                     newIndex + operatorIndexOffset);
+  gd::ArbitraryEventsWorkersComposite movers;
+  if (eventsFunction.IsExpression()) movers.AddWorker(expressionMover);
+  if (eventsFunction.IsAction() || eventsFunction.IsCondition())
+    movers.AddWorker(instructionMover);
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, movers);
 }
 
 void WholeProjectRefactorer::RenameEventsBasedBehaviorProperty(
@@ -684,7 +686,8 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorProperty(
 
     // Order is important: we first rename the expressions then the
     // instructions, to avoid being unable to fetch the metadata (the types of
-    // parameters) of instructions after they are renamed.
+    // parameters) of instructions after they are renamed. The renamers are
+    // run in a single traversal, called in this order on each instruction.
     gd::ExpressionsRenamer expressionRenamer =
         gd::ExpressionsRenamer(project.GetCurrentPlatform());
     expressionRenamer.SetReplacedBehaviorExpression(
@@ -692,8 +695,6 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorProperty(
                             eventsBasedBehavior.GetName()),
         EventsBasedBehavior::GetPropertyExpressionName(oldPropertyName),
         EventsBasedBehavior::GetPropertyExpressionName(newPropertyName));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionRenamer);
-
     gd::InstructionsTypeRenamer actionRenamer = gd::InstructionsTypeRenamer(
         project,
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
@@ -704,8 +705,6 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorProperty(
             eventsFunctionsExtension.GetName(),
             eventsBasedBehavior.GetName(),
             EventsBasedBehavior::GetPropertyActionName(newPropertyName)));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
-
     gd::InstructionsTypeRenamer conditionRenamer = gd::InstructionsTypeRenamer(
         project,
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
@@ -716,7 +715,11 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorProperty(
             eventsFunctionsExtension.GetName(),
             eventsBasedBehavior.GetName(),
             EventsBasedBehavior::GetPropertyConditionName(newPropertyName)));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
+    gd::ArbitraryEventsWorkersComposite renamers;
+    renamers.AddWorker(expressionRenamer)
+        .AddWorker(actionRenamer)
+        .AddWorker(conditionRenamer);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamers);
   }
 }
 
@@ -750,7 +753,8 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorSharedProperty(
 
     // Order is important: we first rename the expressions then the
     // instructions, to avoid being unable to fetch the metadata (the types of
-    // parameters) of instructions after they are renamed.
+    // parameters) of instructions after they are renamed. The renamers are
+    // run in a single traversal, called in this order on each instruction.
     gd::ExpressionsRenamer expressionRenamer =
         gd::ExpressionsRenamer(project.GetCurrentPlatform());
     expressionRenamer.SetReplacedBehaviorExpression(
@@ -758,8 +762,6 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorSharedProperty(
                             eventsBasedBehavior.GetName()),
         EventsBasedBehavior::GetSharedPropertyExpressionName(oldPropertyName),
         EventsBasedBehavior::GetSharedPropertyExpressionName(newPropertyName));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionRenamer);
-
     gd::InstructionsTypeRenamer actionRenamer = gd::InstructionsTypeRenamer(
         project,
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
@@ -770,8 +772,6 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorSharedProperty(
             eventsFunctionsExtension.GetName(),
             eventsBasedBehavior.GetName(),
             EventsBasedBehavior::GetSharedPropertyActionName(newPropertyName)));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
-
     gd::InstructionsTypeRenamer conditionRenamer = gd::InstructionsTypeRenamer(
         project,
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
@@ -782,7 +782,11 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorSharedProperty(
             eventsFunctionsExtension.GetName(),
             eventsBasedBehavior.GetName(),
             EventsBasedBehavior::GetSharedPropertyConditionName(newPropertyName)));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
+    gd::ArbitraryEventsWorkersComposite renamers;
+    renamers.AddWorker(expressionRenamer)
+        .AddWorker(actionRenamer)
+        .AddWorker(conditionRenamer);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamers);
   }
 }
 
@@ -800,7 +804,8 @@ void WholeProjectRefactorer::RenameEventsBasedObjectProperty(
 
   // Order is important: we first rename the expressions then the
   // instructions, to avoid being unable to fetch the metadata (the types of
-  // parameters) of instructions after they are renamed.
+  // parameters) of instructions after they are renamed. The renamers are
+  // run in a single traversal, called in this order on each instruction.
   gd::ExpressionsRenamer expressionRenamer =
       gd::ExpressionsRenamer(project.GetCurrentPlatform());
   expressionRenamer.SetReplacedObjectExpression(
@@ -808,8 +813,6 @@ void WholeProjectRefactorer::RenameEventsBasedObjectProperty(
                           eventsBasedObject.GetName()),
       EventsBasedObject::GetPropertyExpressionName(oldPropertyName),
       EventsBasedObject::GetPropertyExpressionName(newPropertyName));
-  gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionRenamer);
-
   gd::InstructionsTypeRenamer actionRenamer = gd::InstructionsTypeRenamer(
       project,
       gd::PlatformExtension::GetObjectEventsFunctionFullType(
@@ -820,8 +823,6 @@ void WholeProjectRefactorer::RenameEventsBasedObjectProperty(
           eventsFunctionsExtension.GetName(),
           eventsBasedObject.GetName(),
           EventsBasedObject::GetPropertyActionName(newPropertyName)));
-  gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
-
   gd::InstructionsTypeRenamer conditionRenamer = gd::InstructionsTypeRenamer(
       project,
       gd::PlatformExtension::GetObjectEventsFunctionFullType(
@@ -832,7 +833,11 @@ void WholeProjectRefactorer::RenameEventsBasedObjectProperty(
           eventsFunctionsExtension.GetName(),
           eventsBasedObject.GetName(),
           EventsBasedObject::GetPropertyConditionName(newPropertyName)));
-  gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
+  gd::ArbitraryEventsWorkersComposite renamers;
+  renamers.AddWorker(expressionRenamer)
+      .AddWorker(actionRenamer)
+      .AddWorker(conditionRenamer);
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamers);
 }
 
 void WholeProjectRefactorer::AddBehaviorAndRequiredBehaviors(
@@ -859,7 +864,8 @@ void WholeProjectRefactorer::AddRequiredBehaviorsFor(
 
   const gd::Platform& platform = project.GetCurrentPlatform();
   const gd::BehaviorMetadata& behaviorMetadata =
-      MetadataProvider::GetBehaviorMetadata(platform, behavior.GetTypeName());
+      MetadataProvider::GetBehaviorMetadata(platform,
+                                            behavior.GetInternedTypeName());
   if (MetadataProvider::IsBadBehaviorMetadata(behaviorMetadata)) {
     // Should not happen because the behavior was added successfully (so its
     // metadata are valid) - but double check anyway and bail out if the
@@ -1064,8 +1070,12 @@ void WholeProjectRefactorer::RenameEventsBasedBehavior(
   }
   auto& eventsBasedBehavior = eventsBasedBehaviors.Get(oldBehaviorName);
 
+  // Renamers are run together in a single traversal of the project events.
+  std::vector<gd::InstructionsTypeRenamer> renamers;
+
   auto renameBehaviorEventsFunction =
       [&project,
+       &renamers,
        &eventsFunctionsExtension,
        &oldBehaviorName,
        &newBehaviorName](const gd::EventsFunction& eventsFunction) {
@@ -1074,7 +1084,7 @@ void WholeProjectRefactorer::RenameEventsBasedBehavior(
           // behavior
         }
         if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
-          gd::InstructionsTypeRenamer renamer = gd::InstructionsTypeRenamer(
+          renamers.emplace_back(
               project,
               gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
                   eventsFunctionsExtension.GetName(),
@@ -1084,17 +1094,17 @@ void WholeProjectRefactorer::RenameEventsBasedBehavior(
                   eventsFunctionsExtension.GetName(),
                   newBehaviorName,
                   eventsFunction.GetName()));
-          gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
         }
       };
 
   auto renameBehaviorProperty = [&project,
+                                 &renamers,
                                  &eventsFunctionsExtension,
                                  &oldBehaviorName,
                                  &newBehaviorName](
                                     const gd::NamedPropertyDescriptor&
                                         property) {
-    gd::InstructionsTypeRenamer actionRenamer = gd::InstructionsTypeRenamer(
+    renamers.emplace_back(
         project,
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
             eventsFunctionsExtension.GetName(),
@@ -1104,9 +1114,8 @@ void WholeProjectRefactorer::RenameEventsBasedBehavior(
             eventsFunctionsExtension.GetName(),
             newBehaviorName,
             EventsBasedBehavior::GetPropertyActionName(property.GetName())));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
 
-    gd::InstructionsTypeRenamer conditionRenamer = gd::InstructionsTypeRenamer(
+    renamers.emplace_back(
         project,
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
             eventsFunctionsExtension.GetName(),
@@ -1116,19 +1125,19 @@ void WholeProjectRefactorer::RenameEventsBasedBehavior(
             eventsFunctionsExtension.GetName(),
             newBehaviorName,
             EventsBasedBehavior::GetPropertyConditionName(property.GetName())));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
 
     // Nothing to do for expression, expressions are not including the name of
     // the behavior
   };
 
   auto renameBehaviorSharedProperty = [&project,
+                                 &renamers,
                                  &eventsFunctionsExtension,
                                  &oldBehaviorName,
                                  &newBehaviorName](
                                     const gd::NamedPropertyDescriptor&
                                         property) {
-    gd::InstructionsTypeRenamer actionRenamer = gd::InstructionsTypeRenamer(
+    renamers.emplace_back(
         project,
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
             eventsFunctionsExtension.GetName(),
@@ -1138,9 +1147,8 @@ void WholeProjectRefactorer::RenameEventsBasedBehavior(
             eventsFunctionsExtension.GetName(),
             newBehaviorName,
             EventsBasedBehavior::GetSharedPropertyActionName(property.GetName())));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
 
-    gd::InstructionsTypeRenamer conditionRenamer = gd::InstructionsTypeRenamer(
+    renamers.emplace_back(
         project,
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
             eventsFunctionsExtension.GetName(),
@@ -1150,7 +1158,6 @@ void WholeProjectRefactorer::RenameEventsBasedBehavior(
             eventsFunctionsExtension.GetName(),
             newBehaviorName,
             EventsBasedBehavior::GetSharedPropertyConditionName(property.GetName())));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
 
     // Nothing to do for expression, expressions are not including the name of
     // the behavior
@@ -1183,6 +1190,10 @@ void WholeProjectRefactorer::RenameEventsBasedBehavior(
     renameBehaviorSharedProperty(*property);
   }
 
+  gd::ArbitraryEventsWorkersComposite renamersComposite;
+  for (auto& renamer : renamers) renamersComposite.AddWorker(renamer);
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamersComposite);
+
   const WholeProjectBrowser wholeProjectExposer;
   DoRenameBehavior(
       project,
@@ -1205,8 +1216,12 @@ void WholeProjectRefactorer::RenameEventsBasedObject(
   }
   auto& eventsBasedObject = eventsBasedObjects.Get(oldObjectName);
 
+  // Renamers are run together in a single traversal of the project events.
+  std::vector<gd::InstructionsTypeRenamer> renamers;
+
   auto renameObjectEventsFunction =
       [&project,
+       &renamers,
        &eventsFunctionsExtension,
        &oldObjectName,
        &newObjectName](const gd::EventsFunction& eventsFunction) {
@@ -1215,7 +1230,7 @@ void WholeProjectRefactorer::RenameEventsBasedObject(
           // object
         }
         if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
-          gd::InstructionsTypeRenamer renamer = gd::InstructionsTypeRenamer(
+          renamers.emplace_back(
               project,
               gd::PlatformExtension::GetObjectEventsFunctionFullType(
                   eventsFunctionsExtension.GetName(),
@@ -1225,17 +1240,17 @@ void WholeProjectRefactorer::RenameEventsBasedObject(
                   eventsFunctionsExtension.GetName(),
                   newObjectName,
                   eventsFunction.GetName()));
-          gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamer);
         }
       };
 
   auto renameObjectProperty = [&project,
+                                 &renamers,
                                  &eventsFunctionsExtension,
                                  &oldObjectName,
                                  &newObjectName](
                                     const gd::NamedPropertyDescriptor&
                                         property) {
-    gd::InstructionsTypeRenamer actionRenamer = gd::InstructionsTypeRenamer(
+    renamers.emplace_back(
         project,
         gd::PlatformExtension::GetObjectEventsFunctionFullType(
             eventsFunctionsExtension.GetName(),
@@ -1245,9 +1260,8 @@ void WholeProjectRefactorer::RenameEventsBasedObject(
             eventsFunctionsExtension.GetName(),
             newObjectName,
             EventsBasedObject::GetPropertyActionName(property.GetName())));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
 
-    gd::InstructionsTypeRenamer conditionRenamer = gd::InstructionsTypeRenamer(
+    renamers.emplace_back(
         project,
         gd::PlatformExtension::GetObjectEventsFunctionFullType(
             eventsFunctionsExtension.GetName(),
@@ -1257,7 +1271,6 @@ void WholeProjectRefactorer::RenameEventsBasedObject(
             eventsFunctionsExtension.GetName(),
             newObjectName,
             EventsBasedObject::GetPropertyConditionName(property.GetName())));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
 
     // Nothing to do for expression, expressions are not including the name of
     // the object
@@ -1288,6 +1301,10 @@ void WholeProjectRefactorer::RenameEventsBasedObject(
     renameObjectProperty(*property);
   }
 
+  gd::ArbitraryEventsWorkersComposite renamersComposite;
+  for (auto& renamer : renamers) renamersComposite.AddWorker(renamer);
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamersComposite);
+
   const WholeProjectBrowser wholeProjectExposer;
   DoRenameObject(
       project,
@@ -1302,20 +1319,20 @@ void WholeProjectRefactorer::DoRenameEventsFunction(
     const gd::String& oldFullType,
     const gd::String& newFullType,
     const gd::ProjectBrowser& projectBrowser) {
-  // Order is important: we first rename the expressions then the instructions,
-  // to avoid being unable to fetch the metadata (the types of parameters) of
+  // Order is important: we first rename the expressions then the instructions
+  // (the workers are called in this order on each instruction), to avoid
+  // being unable to fetch the metadata (the types of parameters) of
   // instructions after they are renamed.
-  if (eventsFunction.IsExpression()) {
-    gd::ExpressionsRenamer renamer =
-        gd::ExpressionsRenamer(project.GetCurrentPlatform());
-    renamer.SetReplacedFreeExpression(oldFullType, newFullType);
-    projectBrowser.ExposeEvents(project, renamer);
-  }
-  if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
-    gd::InstructionsTypeRenamer renamer =
-        gd::InstructionsTypeRenamer(project, oldFullType, newFullType);
-    projectBrowser.ExposeEvents(project, renamer);
-  }
+  gd::ExpressionsRenamer expressionRenamer =
+      gd::ExpressionsRenamer(project.GetCurrentPlatform());
+  expressionRenamer.SetReplacedFreeExpression(oldFullType, newFullType);
+  gd::InstructionsTypeRenamer instructionRenamer =
+      gd::InstructionsTypeRenamer(project, oldFullType, newFullType);
+  gd::ArbitraryEventsWorkersComposite renamers;
+  if (eventsFunction.IsExpression()) renamers.AddWorker(expressionRenamer);
+  if (eventsFunction.IsAction() || eventsFunction.IsCondition())
+    renamers.AddWorker(instructionRenamer);
+  projectBrowser.ExposeEvents(project, renamers);
 }
 
 void WholeProjectRefactorer::DoRenameBehavior(
@@ -1374,11 +1391,16 @@ void WholeProjectRefactorer::ObjectOrGroupRemovedInLayout(
     bool removeEventsAndGroups) {
   // Remove object in the current layout
   if (removeEventsAndGroups) {
-    gd::EventsRefactorer::RemoveObjectInEvents(project.GetCurrentPlatform(),
-                                               project,
-                                               layout,
-                                               layout.GetEvents(),
-                                               objectName);
+    if (project.IsEventsReferencesIndexEnabled()) {
+      project.GetEventsReferencesIndex().RemoveObjectInEvents(
+          layout.GetEvents(), project, layout, objectName);
+    } else {
+      gd::EventsRefactorer::RemoveObjectInEvents(project.GetCurrentPlatform(),
+                                                 project,
+                                                 layout,
+                                                 layout.GetEvents(),
+                                                 objectName);
+    }
   }
   if (!isObjectGroup) {  // Object groups can't have instances or be in other
                          // groups
@@ -1396,9 +1418,14 @@ void WholeProjectRefactorer::ObjectOrGroupRemovedInLayout(
     for (auto &externalEventsName :
          GetAssociatedExternalEvents(project, layout.GetName())) {
       auto &externalEvents = project.GetExternalEvents(externalEventsName);
-      gd::EventsRefactorer::RemoveObjectInEvents(
-          project.GetCurrentPlatform(), project, layout,
-          externalEvents.GetEvents(), objectName);
+      if (project.IsEventsReferencesIndexEnabled()) {
+        project.GetEventsReferencesIndex().RemoveObjectInEvents(
+            externalEvents.GetEvents(), project, layout, objectName);
+      } else {
+        gd::EventsRefactorer::RemoveObjectInEvents(
+            project.GetCurrentPlatform(), project, layout,
+            externalEvents.GetEvents(), objectName);
+      }
     }
   }
 
@@ -1421,12 +1448,17 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInLayout(
     const gd::String& newName,
     bool isObjectGroup) {
   // Rename object in the current layout
-  gd::EventsRefactorer::RenameObjectInEvents(project.GetCurrentPlatform(),
-                                             project,
-                                             layout,
-                                             layout.GetEvents(),
-                                             oldName,
-                                             newName);
+  if (project.IsEventsReferencesIndexEnabled()) {
+    project.GetEventsReferencesIndex().RenameObjectInEvents(
+        layout.GetEvents(), project, layout, oldName, newName);
+  } else {
+    gd::EventsRefactorer::RenameObjectInEvents(project.GetCurrentPlatform(),
+                                               project,
+                                               layout,
+                                               layout.GetEvents(),
+                                               oldName,
+                                               newName);
+  }
 
   if (!isObjectGroup) {  // Object groups can't have instances or be in other
                          // groups
@@ -1440,9 +1472,14 @@ void WholeProjectRefactorer::ObjectOrGroupRenamedInLayout(
   for (auto &externalEventsName :
        GetAssociatedExternalEvents(project, layout.GetName())) {
     auto &externalEvents = project.GetExternalEvents(externalEventsName);
-    gd::EventsRefactorer::RenameObjectInEvents(
-        project.GetCurrentPlatform(), project, layout,
-        externalEvents.GetEvents(), oldName, newName);
+    if (project.IsEventsReferencesIndexEnabled()) {
+      project.GetEventsReferencesIndex().RenameObjectInEvents(
+          externalEvents.GetEvents(), project, layout, oldName, newName);
+    } else {
+      gd::EventsRefactorer::RenameObjectInEvents(
+          project.GetCurrentPlatform(), project, layout,
+          externalEvents.GetEvents(), oldName, newName);
+    }
   }
 
   // Rename object in external layouts
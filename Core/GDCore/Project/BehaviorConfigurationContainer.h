@@ -10,6 +10,7 @@
 #include <memory>
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 
 namespace gd {
 class PropertyDescriptor;
@@ -51,12 +52,20 @@ class GD_CORE_API BehaviorConfigurationContainer {
   /**
    * \brief Return the type of the behavior
    */
-  const gd::String& GetTypeName() const { return type; }
+  const gd::String& GetTypeName() const { return type.GetString(); }
+
+  /**
+   * \brief Return the type of the behavior, as an interned string so that it
+   * can be compared or used as a key in constant time.
+   */
+  const gd::InternedString& GetInternedTypeName() const { return type; }
 
   /**
    * \brief Set the type of the behavior.
    */
-  void SetTypeName(const gd::String& type_) { type = type_; };
+  void SetTypeName(const gd::String& type_) {
+    type = gd::InternedString(type_);
+  };
 
   /**
    * \brief Called when the IDE wants to know about the custom properties of the
@@ -144,8 +153,9 @@ protected:
 
  private:
   gd::String name;  ///< Name of the behavior
-  gd::String type;  ///< The type of the behavior that is represented. Usually
-                    ///< in the form "ExtensionName::BehaviorTypeName"
+  gd::InternedString type;  ///< The type of the behavior that is represented.
+                            ///< Usually in the form
+                            ///< "ExtensionName::BehaviorTypeName"
 
   gd::SerializerElement content;  // Storage for the behavior properties
 };
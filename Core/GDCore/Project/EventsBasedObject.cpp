@@ -22,6 +22,7 @@ EventsBasedObject::EventsBasedObject(const gd::EventsBasedObject &_eventBasedObj
         : AbstractEventsBasedEntity(_eventBasedObject) {
   // TODO Add a copy constructor in ObjectsContainer.
   initialObjects = gd::Clone(_eventBasedObject.initialObjects);
+  objectsIndex.Invalidate();
   objectGroups = _eventBasedObject.objectGroups;
 }
 
@@ -6,6 +6,9 @@
 
 #include "GDCore/Project/InitialInstance.h"
 
+#include <algorithm>
+
+#include "GDCore/Project/InitialInstancesContainer.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/Project.h"
@@ -17,24 +20,61 @@ namespace gd {
 
 gd::String* InitialInstance::badStringProperyValue = NULL;
 
+namespace {
+
+/**
+ * \brief Return the iterator to the property called \a name in \a
+ * properties, sorted by name, or to the position where it should be inserted.
+ */
+template <class Properties>
+auto FindProperty(Properties& properties, const gd::String& name)
+    -> decltype(properties.begin()) {
+  // Properties are usually set in order when unserialized.
+  if (properties.empty() || properties.back().first.GetString() < name)
+    return properties.end();
+
+  return std::lower_bound(
+      properties.begin(),
+      properties.end(),
+      name,
+      [](const typename Properties::value_type& property,
+         const gd::String& name) { return property.first.GetString() < name; });
+}
+
+template <class Properties>
+bool IsPropertyFound(const Properties& properties,
+                     typename Properties::const_iterator it,
+                     const gd::String& name) {
+  return it != properties.end() && it->first.GetString() == name;
+}
+
+}  // namespace
+
 InitialInstance::InitialInstance()
-    : objectName(""),
-      x(0),
+    : x(0),
       y(0),
-      z(0),
       angle(0),
-      rotationX(0),
-      rotationY(0),
+      width(0),
+      height(0),
       zOrder(0),
-      layer(""),
       customSize(false),
       customDepth(false),
-      width(0),
-      height(0),
-      depth(0),
       locked(false),
-      sealed(false),
-      persistentUuid(UUID::MakeUuid4()) {}
+      sealed(false) {
+  ResetPersistentUuid();
+}
+
+InitialInstance::SpatialIndexLink& InitialInstance::SpatialIndexLink::operator=(
+    const SpatialIndexLink&) {
+  // The bounds of the instance are being replaced: the instances of the
+  // container must be indexed again.
+  if (container) container->MarkSpatialIndexOutdated();
+  return *this;
+}
+
+void InitialInstance::OnBoundsChanged() {
+  spatialIndexLink.container->OnInstanceBoundsChanged(*this);
+}
 
 void InitialInstance::UnserializeFrom(const SerializerElement& element) {
   SetObjectName(element.GetStringAttribute("name", "", "nom"));
@@ -59,8 +99,19 @@ void InitialInstance::UnserializeFrom(const SerializerElement& element) {
   SetLocked(element.GetBoolAttribute("locked", false));
   SetSealed(element.GetBoolAttribute("sealed", false));
 
-  persistentUuid = element.GetStringAttribute("persistentUuid");
-  if (persistentUuid.empty()) ResetPersistentUuid();
+  gd::String persistentUuid = element.GetStringAttribute("persistentUuid");
+  sole::uuid uuid;
+  if (persistentUuid.empty()) {
+    ResetPersistentUuid();
+  } else if (UUID::FromString(persistentUuid, uuid)) {
+    persistentUuidHigh = uuid.ab;
+    persistentUuidLow = uuid.cd;
+    if (extraData.data) extraData.data->persistentUuid.clear();
+  } else {
+    persistentUuidHigh = 0;
+    persistentUuidLow = 0;
+    GetExtraData().persistentUuid = persistentUuid;
+  }
 
   numberProperties.clear();
   const SerializerElement& numberPropertiesElement =
@@ -85,11 +136,11 @@ void InitialInstance::UnserializeFrom(const SerializerElement& element) {
     }
     // end of compatibility code
     else {
-      numberProperties[name] = value;
+      SetRawDoubleProperty(name, value);
     }
   }
 
-  stringProperties.clear();
+  if (extraData.data) extraData.data->stringProperties.clear();
   const SerializerElement& stringPropElement =
       element.GetChild("stringProperties", 0, "stringInfos");
   stringPropElement.ConsiderAsArrayOf("property", "Info");
@@ -97,11 +148,17 @@ void InitialInstance::UnserializeFrom(const SerializerElement& element) {
     gd::String name = stringPropElement.GetChild(j).GetStringAttribute("name");
     gd::String value =
         stringPropElement.GetChild(j).GetStringAttribute("value");
-    stringProperties[name] = value;
+    SetRawStringProperty(name, value);
   }
 
-  GetVariables().UnserializeFrom(
+  // Variables are only stored if there are some.
+  gd::VariablesContainer initialVariables;
+  initialVariables.UnserializeFrom(
       element.GetChild("initialVariables", 0, "InitialVariables"));
+  if (initialVariables.Count() != 0)
+    GetVariables() = initialVariables;
+  else if (extraData.data)
+    extraData.data->initialVariables.Clear();
 }
 
 void InitialInstance::SerializeTo(SerializerElement& element) const {
@@ -121,34 +178,55 @@ void InitialInstance::SerializeTo(SerializerElement& element) const {
   if (IsLocked()) element.SetAttribute("locked", IsLocked());
   if (IsSealed()) element.SetAttribute("sealed", IsSealed());
 
-  if (persistentUuid.empty()) persistentUuid = UUID::MakeUuid4();
-  element.SetStringAttribute("persistentUuid", persistentUuid);
+  if (extraData.data && !extraData.data->persistentUuid.empty()) {
+    element.SetStringAttribute("persistentUuid",
+                               extraData.data->persistentUuid);
+  } else {
+    if (persistentUuidHigh == 0 && persistentUuidLow == 0) {
+      sole::uuid uuid = UUID::MakeBinaryUuid4();
+      persistentUuidHigh = uuid.ab;
+      persistentUuidLow = uuid.cd;
+    }
+    element.SetStringAttribute(
+        "persistentUuid",
+        UUID::ToString(sole::rebuild(persistentUuidHigh, persistentUuidLow)));
+  }
 
   SerializerElement& numberPropertiesElement =
       element.AddChild("numberProperties");
   numberPropertiesElement.ConsiderAsArrayOf("property");
   for (const auto& property : numberProperties) {
     numberPropertiesElement.AddChild("property")
-        .SetAttribute("name", property.first)
+        .SetAttribute("name", property.first.GetString())
         .SetAttribute("value", property.second);
   }
 
   SerializerElement& stringPropElement = element.AddChild("stringProperties");
   stringPropElement.ConsiderAsArrayOf("property");
-  for (const auto& property : stringProperties) {
-    stringPropElement.AddChild("property")
-        .SetAttribute("name", property.first)
-        .SetAttribute("value", property.second);
+  if (extraData.data) {
+    for (const auto& property : extraData.data->stringProperties) {
+      stringPropElement.AddChild("property")
+          .SetAttribute("name", property.first.GetString())
+          .SetAttribute("value", property.second);
+    }
   }
 
   GetVariables().SerializeTo(element.AddChild("initialVariables"));
 }
 
 InitialInstance& InitialInstance::ResetPersistentUuid() {
-  persistentUuid = UUID::MakeUuid4();
+  sole::uuid uuid = UUID::MakeBinaryUuid4();
+  persistentUuidHigh = uuid.ab;
+  persistentUuidLow = uuid.cd;
+  if (extraData.data) extraData.data->persistentUuid.clear();
   return *this;
 }
 
+const gd::VariablesContainer& InitialInstance::GetVariables() const {
+  static const gd::VariablesContainer noVariables;
+  return extraData.data ? extraData.data->initialVariables : noVariables;
+}
+
 std::map<gd::String, gd::PropertyDescriptor>
 InitialInstance::GetCustomProperties(gd::Project& project, gd::Layout& layout) {
   // Find an object
@@ -182,26 +260,38 @@ bool InitialInstance::UpdateCustomProperty(const gd::String& name,
 }
 
 double InitialInstance::GetRawDoubleProperty(const gd::String& name) const {
-  const auto& it = numberProperties.find(name);
-  return it != numberProperties.end() ? it->second : 0;
+  auto it = FindProperty(numberProperties, name);
+  return IsPropertyFound(numberProperties, it, name) ? it->second : 0;
 }
 
 const gd::String& InitialInstance::GetRawStringProperty(
     const gd::String& name) const {
   if (!badStringProperyValue) badStringProperyValue = new gd::String("");
+  if (!extraData.data) return *badStringProperyValue;
 
-  const auto& it = stringProperties.find(name);
-  return it != stringProperties.end() ? it->second : *badStringProperyValue;
+  const auto& stringProperties = extraData.data->stringProperties;
+  auto it = FindProperty(stringProperties, name);
+  return IsPropertyFound(stringProperties, it, name) ? it->second
+                                                     : *badStringProperyValue;
 }
 
 void InitialInstance::SetRawDoubleProperty(const gd::String& name,
                                            double value) {
-  numberProperties[name] = value;
+  auto it = FindProperty(numberProperties, name);
+  if (IsPropertyFound(numberProperties, it, name))
+    it->second = value;
+  else
+    numberProperties.emplace(it, gd::InternedString(name), value);
 }
 
 void InitialInstance::SetRawStringProperty(const gd::String& name,
                                            const gd::String& value) {
-  stringProperties[name] = value;
+  auto& stringProperties = GetExtraData().stringProperties;
+  auto it = FindProperty(stringProperties, name);
+  if (IsPropertyFound(stringProperties, it, name))
+    it->second = value;
+  else
+    stringProperties.emplace(it, gd::InternedString(name), value);
 }
 
 }  // namespace gd
@@ -6,14 +6,20 @@
 
 #ifndef GDCORE_INITIALINSTANCE_H
 #define GDCORE_INITIALINSTANCE_H
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 namespace gd {
 class PropertyDescriptor;
 class Project;
 class Layout;
+class InitialInstancesContainer;
 }  // namespace gd
 
 namespace gd {
@@ -21,6 +27,11 @@ namespace gd {
 /**
  * \brief Represents an instance of an object to be created on a layout start
  * up.
+ *
+ * As scenes can have hundreds of thousands of instances, instances are kept
+ * small: the object and layer names are interned, the persistent UUID is
+ * stored in binary form, and the rarely used properties (3D position and
+ * depth, string properties, variables) are only allocated when set.
  */
 class GD_CORE_API InitialInstance {
  public:
@@ -45,12 +56,15 @@ class GD_CORE_API InitialInstance {
   /**
    * \brief Get the name of object instantiated on the layout.
    */
-  const gd::String& GetObjectName() const { return objectName; }
+  const gd::String& GetObjectName() const { return objectName.GetString(); }
 
   /**
    * \brief Set the name of object instantiated on the layout.
    */
-  void SetObjectName(const gd::String& name) { objectName = name; }
+  void SetObjectName(const gd::String& name) {
+    objectName = gd::InternedString(name);
+    NotifyBoundsChanged();
+  }
 
   /**
    * \brief Get the X position of the instance
@@ -60,7 +74,10 @@ class GD_CORE_API InitialInstance {
   /**
    * \brief Set the X position of the instance
    */
-  void SetX(double x_) { x = x_; }
+  void SetX(double x_) {
+    x = x_;
+    NotifyBoundsChanged();
+  }
 
   /**
    * \brief Get the Y position of the instance
@@ -70,17 +87,22 @@ class GD_CORE_API InitialInstance {
   /**
    * \brief Set the Y position of the instance
    */
-  void SetY(double y_) { y = y_; }
+  void SetY(double y_) {
+    y = y_;
+    NotifyBoundsChanged();
+  }
 
   /**
    * \brief Get the Z position of the instance
    */
-  double GetZ() const { return z; }
+  double GetZ() const { return extraData.data ? extraData.data->z : 0; }
 
   /**
    * \brief Set the Z position of the instance
    */
-  void SetZ(double z_) { z = z_; }
+  void SetZ(double z_) {
+    if (z_ != 0 || extraData.data) GetExtraData().z = z_;
+  }
 
   /**
    * \brief Get the rotation of the instance on Z axis, in radians.
@@ -95,22 +117,32 @@ class GD_CORE_API InitialInstance {
   /**
    * \brief Get the rotation of the instance on X axis, in radians.
    */
-  double GetRotationX() const { return rotationX; }
+  double GetRotationX() const {
+    return extraData.data ? extraData.data->rotationX : 0;
+  }
 
   /**
    * \brief Set the rotation of the instance on X axis, in radians.
    */
-  void SetRotationX(double rotationX_) { rotationX = rotationX_; }
+  void SetRotationX(double rotationX_) {
+    if (rotationX_ != 0 || extraData.data)
+      GetExtraData().rotationX = rotationX_;
+  }
 
   /**
    * \brief Get the rotation of the instance on Y axis, in radians.
    */
-  double GetRotationY() const { return rotationY; }
+  double GetRotationY() const {
+    return extraData.data ? extraData.data->rotationY : 0;
+  }
 
   /**
    * \brief Set the rotation of the instance on Y axis, in radians.
    */
-  void SetRotationY(double rotationY_) { rotationY = rotationY_; }
+  void SetRotationY(double rotationY_) {
+    if (rotationY_ != 0 || extraData.data)
+      GetExtraData().rotationY = rotationY_;
+  }
 
   /**
    * \brief Get the Z order of the instance (for a 2D object).
@@ -125,12 +157,15 @@ class GD_CORE_API InitialInstance {
   /**
    * \brief Get the layer the instance belongs to.
    */
-  const gd::String& GetLayer() const { return layer; }
+  const gd::String& GetLayer() const { return layer.GetString(); }
 
   /**
    * \brief Set the layer the instance belongs to.
    */
-  void SetLayer(const gd::String& layer_) { layer = layer_; }
+  void SetLayer(const gd::String& layer_) {
+    layer = gd::InternedString(layer_);
+    NotifyBoundsChanged();
+  }
 
   /**
    * \brief Return true if the instance has a width/height which is different from its
@@ -157,6 +192,7 @@ class GD_CORE_API InitialInstance {
    */
   void SetHasCustomSize(bool hasCustomSize_) {
     customSize = hasCustomSize_;
+    NotifyBoundsChanged();
   }
 
   /**
@@ -173,11 +209,21 @@ class GD_CORE_API InitialInstance {
   }
 
   double GetCustomWidth() const { return width; }
-  void SetCustomWidth(double width_) { width = width_; }
+  void SetCustomWidth(double width_) {
+    width = width_;
+    NotifyBoundsChanged();
+  }
   double GetCustomHeight() const { return height; }
-  void SetCustomHeight(double height_) { height = height_; }
-  double GetCustomDepth() const { return depth; }
-  void SetCustomDepth(double depth_) { depth = depth_; }
+  void SetCustomHeight(double height_) {
+    height = height_;
+    NotifyBoundsChanged();
+  }
+  double GetCustomDepth() const {
+    return extraData.data ? extraData.data->depth : 0;
+  }
+  void SetCustomDepth(double depth_) {
+    if (depth_ != 0 || extraData.data) GetExtraData().depth = depth_;
+  }
 
   /**
    * \brief Return true if the instance is locked and cannot be moved in the
@@ -217,15 +263,15 @@ class GD_CORE_API InitialInstance {
    * Must return a reference to the container storing the instance variables
    * \see gd::VariablesContainer
    */
-  const gd::VariablesContainer& GetVariables() const {
-    return initialVariables;
-  }
+  const gd::VariablesContainer& GetVariables() const;
 
   /**
    * Must return a reference to the container storing the instance variables
    * \see gd::VariablesContainer
    */
-  gd::VariablesContainer& GetVariables() { return initialVariables; }
+  gd::VariablesContainer& GetVariables() {
+    return GetExtraData().initialVariables;
+  }
   ///@}
 
   /** \name Others properties management
@@ -316,32 +362,93 @@ class GD_CORE_API InitialInstance {
   ///@}
 
  private:
+  friend class InitialInstancesContainer;
+
+  /**
+   * \brief The container to notify when the position, the size or the layer
+   * of the instance change, only set while the container has a spatial index.
+   *
+   * It's not copied with the instance: an instance copied into a container is
+   * linked by the container, and an instance assigned from another one only
+   * asks its container to index its instances again.
+   */
+  class SpatialIndexLink {
+   public:
+    SpatialIndexLink() : container(nullptr){};
+    SpatialIndexLink(const SpatialIndexLink&) : container(nullptr){};
+    SpatialIndexLink& operator=(const SpatialIndexLink&);
+
+    gd::InitialInstancesContainer* container;
+  };
+
+  void NotifyBoundsChanged() {
+    if (spatialIndexLink.container) OnBoundsChanged();
+  }
+  void OnBoundsChanged();
+
+  /**
+   * \brief The properties that most instances don't use.
+   */
+  struct ExtraData {
+    ExtraData() : z(0), rotationX(0), rotationY(0), depth(0){};
+
+    double z;          ///< Instance Z position (for a 3D object)
+    double rotationX;  ///< Instance angle on X axis (for a 3D object)
+    double rotationY;  ///< Instance angle on Y axis (for a 3D object)
+    double depth;      ///< Instance custom depth
+    std::vector<std::pair<gd::InternedString, gd::String>>
+        stringProperties;  ///< Sorted by name.
+    gd::VariablesContainer initialVariables;  ///< Instance specific variables
+    gd::String persistentUuid;  ///< The persistent UUID, only when it can't
+                                ///< be stored in binary form.
+  };
+
+  /**
+   * \brief Own the extra data, if any, and copy it with the instance.
+   */
+  class ExtraDataHolder {
+   public:
+    ExtraDataHolder(){};
+    ExtraDataHolder(const ExtraDataHolder& other)
+        : data(other.data ? new ExtraData(*other.data) : nullptr){};
+    ExtraDataHolder& operator=(const ExtraDataHolder& other) {
+      if (this != &other)
+        data.reset(other.data ? new ExtraData(*other.data) : nullptr);
+      return *this;
+    };
+
+    std::unique_ptr<ExtraData> data;
+  };
+
+  ExtraData& GetExtraData() {
+    if (!extraData.data) extraData.data.reset(new ExtraData);
+    return *extraData.data;
+  }
+
   // More properties can be stored in numberProperties and stringProperties.
   // These properties are then managed by the Object class.
-  std::map<gd::String, double>
-      numberProperties;  ///< More data which can be used by the object
-  std::map<gd::String, gd::String>
-      stringProperties;  ///< More data which can be used by the object
-
-  gd::String objectName;  ///< Object name
-  double x;               ///< Instance X position
-  double y;               ///< Instance Y position
-  double z;               ///< Instance Z position (for a 3D object)
-  double angle;           ///< Instance angle on Z axis
-  double rotationX;       ///< Instance angle on X axis (for a 3D object)
-  double rotationY;       ///< Instance angle on Y axis (for a 3D object)
-  int zOrder;             ///< Instance Z order (for a 2D object)
-  gd::String layer;       ///< Instance layer
-  bool customSize;        ///< True if object has a custom width and height
-  bool customDepth;       ///< True if object has a custom depth
-  double width;           ///< Instance custom width
-  double height;          ///< Instance custom height
-  double depth;           ///< Instance custom depth
-  gd::VariablesContainer initialVariables;  ///< Instance specific variables
-  bool locked;                              ///< True if the instance is locked
-  bool sealed;                              ///< True if the instance is sealed
-  mutable gd::String persistentUuid;  ///< A persistent random version 4 UUID,
-                                      ///< useful for hot reloading.
+  std::vector<std::pair<gd::InternedString, double>>
+      numberProperties;  ///< More data which can be used by the object,
+                         ///< sorted by name.
+  gd::InternedString objectName;  ///< Object name
+  gd::InternedString layer;       ///< Instance layer
+  double x;                       ///< Instance X position
+  double y;                       ///< Instance Y position
+  double angle;                   ///< Instance angle on Z axis
+  double width;                   ///< Instance custom width
+  double height;                  ///< Instance custom height
+  int zOrder;                     ///< Instance Z order (for a 2D object)
+  bool customSize;   ///< True if object has a custom width and height
+  bool customDepth;  ///< True if object has a custom depth
+  bool locked;       ///< True if the instance is locked
+  bool sealed;       ///< True if the instance is sealed
+  mutable std::uint64_t persistentUuidHigh;  ///< A persistent random version
+                                             ///< 4 UUID, useful for hot
+                                             ///< reloading (0 if not
+                                             ///< generated yet).
+  mutable std::uint64_t persistentUuidLow;
+  ExtraDataHolder extraData;  ///< The rarely used properties, if any.
+  SpatialIndexLink spatialIndexLink;
 
   static gd::String*
       badStringProperyValue;  ///< Empty string returned by GetRawStringProperty
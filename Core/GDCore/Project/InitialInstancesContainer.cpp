@@ -10,7 +10,9 @@
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/InitialInstance.h"
 #include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/InitialInstancesSpatialIndex.h"
 #include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/MakeUnique.h"
 
 using namespace std;
 
@@ -18,6 +20,58 @@ namespace gd {
 
 gd::InitialInstance InitialInstancesContainer::badPosition;
 
+namespace {
+
+struct InstanceBounds {
+  double left, top, right, bottom;
+};
+
+InstanceBounds GetInstanceBounds(
+    const gd::InitialInstance& instance,
+    const std::map<gd::String, std::pair<double, double>>& objectsDefaultSizes) {
+  double width = 0;
+  double height = 0;
+  if (instance.HasCustomSize()) {
+    width = instance.GetCustomWidth();
+    height = instance.GetCustomHeight();
+  } else {
+    auto it = objectsDefaultSizes.find(instance.GetObjectName());
+    if (it != objectsDefaultSizes.end()) {
+      width = it->second.first;
+      height = it->second.second;
+    }
+  }
+
+  return InstanceBounds{std::min(instance.GetX(), instance.GetX() + width),
+                        std::min(instance.GetY(), instance.GetY() + height),
+                        std::max(instance.GetX(), instance.GetX() + width),
+                        std::max(instance.GetY(), instance.GetY() + height)};
+}
+
+}  // namespace
+
+InitialInstancesContainer::InitialInstancesContainer() {}
+
+InitialInstancesContainer::InitialInstancesContainer(
+    const InitialInstancesContainer& other)
+    : initialInstances(other.initialInstances),
+      objectsDefaultSizes(other.objectsDefaultSizes) {
+  SetSpatialIndexEnabled(other.IsSpatialIndexEnabled());
+}
+
+InitialInstancesContainer& InitialInstancesContainer::operator=(
+    const InitialInstancesContainer& other) {
+  if (this != &other) {
+    // Unlink the instances before they are replaced.
+    SetSpatialIndexEnabled(false);
+    initialInstances = other.initialInstances;
+    objectsDefaultSizes = other.objectsDefaultSizes;
+    SetSpatialIndexEnabled(other.IsSpatialIndexEnabled());
+  }
+
+  return *this;
+}
+
 InitialInstancesContainer::~InitialInstancesContainer() {}
 
 std::size_t InitialInstancesContainer::GetInstancesCount() const {
@@ -27,12 +81,14 @@ std::size_t InitialInstancesContainer::GetInstancesCount() const {
 void InitialInstancesContainer::UnserializeFrom(
     const SerializerElement& element) {
   initialInstances.clear();
+  if (spatialIndex) spatialIndex->Clear();
 
   element.ConsiderAsArrayOf("instance", "Objet");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
     gd::InitialInstance instance;
     instance.UnserializeFrom(element.GetChild(i));
     initialInstances.push_back(instance);
+    AddToSpatialIndex(initialInstances.back());
   }
 }
 
@@ -63,6 +119,7 @@ void InitialInstancesContainer::IterateOverInstancesWithZOrdering(
 gd::InitialInstance& InitialInstancesContainer::InsertNewInitialInstance() {
   gd::InitialInstance newInstance;
   initialInstances.push_back(newInstance);
+  AddToSpatialIndex(initialInstances.back());
 
   return initialInstances.back();
 }
@@ -75,9 +132,10 @@ void InitialInstancesContainer::RemoveInstanceIf(
   for (std::list<gd::InitialInstance>::iterator it = initialInstances.begin(),
                                                 end = initialInstances.end();
        it != end;) {
-    if (predicate(*it))
+    if (predicate(*it)) {
+      if (spatialIndex) spatialIndex->Remove(*it);
       it = initialInstances.erase(it);
-    else
+    } else
       ++it;
   }
 }
@@ -95,6 +153,7 @@ gd::InitialInstance& InitialInstancesContainer::InsertInitialInstance(
     const gd::InitialInstance& castedInstance =
         dynamic_cast<const gd::InitialInstance&>(instance);
     initialInstances.push_back(castedInstance);
+    AddToSpatialIndex(initialInstances.back());
 
     return initialInstances.back();
   } catch (...) {
@@ -167,11 +226,105 @@ void InitialInstancesContainer::Create(
 
 void InitialInstancesContainer::SerializeTo(SerializerElement& element) const {
   element.ConsiderAsArrayOf("instance");
-  for (auto instance : initialInstances)
+  for (const auto& instance : initialInstances)
     instance.SerializeTo(element.AddChild("instance"));
 }
 
-void InitialInstancesContainer::Clear() { initialInstances.clear(); }
+void InitialInstancesContainer::Clear() {
+  initialInstances.clear();
+  if (spatialIndex) spatialIndex->Clear();
+}
+
+void InitialInstancesContainer::SetSpatialIndexEnabled(bool enable) {
+  if (enable == IsSpatialIndexEnabled()) return;
+
+  if (!enable) {
+    for (auto& instance : initialInstances)
+      instance.spatialIndexLink.container = nullptr;
+    spatialIndex.reset();
+    return;
+  }
+
+  spatialIndex = gd::make_unique<gd::InitialInstancesSpatialIndex>();
+  spatialIndexOutdated = false;
+  for (auto& instance : initialInstances) AddToSpatialIndex(instance);
+}
+
+void InitialInstancesContainer::SetObjectDefaultSize(
+    const gd::String& objectName, double width, double height) {
+  objectsDefaultSizes[objectName] = std::make_pair(width, height);
+  if (!spatialIndex) return;
+
+  for (auto& instance : initialInstances) {
+    if (!instance.HasCustomSize() && instance.GetObjectName() == objectName)
+      OnInstanceBoundsChanged(instance);
+  }
+}
+
+void InitialInstancesContainer::IterateOverInstancesInRegion(
+    gd::InitialInstanceFunctor& func,
+    const gd::String& layer,
+    double left,
+    double top,
+    double right,
+    double bottom) {
+  if (spatialIndex) {
+    UpdateSpatialIndex();
+    spatialIndex->QueryRegion(
+        layer, left, top, right, bottom, [&func](gd::InitialInstance& instance) {
+          func(instance);
+        });
+    return;
+  }
+
+  if (left > right) std::swap(left, right);
+  if (top > bottom) std::swap(top, bottom);
+  for (auto& instance : initialInstances) {
+    if (instance.GetLayer() != layer) continue;
+
+    InstanceBounds bounds = GetInstanceBounds(instance, objectsDefaultSizes);
+    if (bounds.left <= right && bounds.right >= left && bounds.top <= bottom &&
+        bounds.bottom >= top)
+      func(instance);
+  }
+}
+
+void InitialInstancesContainer::IterateOverInstancesAtPoint(
+    gd::InitialInstanceFunctor& func,
+    const gd::String& layer,
+    double x,
+    double y) {
+  IterateOverInstancesInRegion(func, layer, x, y, x, y);
+}
+
+void InitialInstancesContainer::AddToSpatialIndex(
+    gd::InitialInstance& instance) {
+  if (!spatialIndex) return;
+
+  instance.spatialIndexLink.container = this;
+  if (spatialIndexOutdated) return;
+
+  InstanceBounds bounds = GetInstanceBounds(instance, objectsDefaultSizes);
+  spatialIndex->Update(
+      instance, bounds.left, bounds.top, bounds.right, bounds.bottom);
+}
+
+void InitialInstancesContainer::UpdateSpatialIndex() {
+  if (!spatialIndex || !spatialIndexOutdated) return;
+
+  spatialIndex->Clear();
+  spatialIndexOutdated = false;
+  for (auto& instance : initialInstances) AddToSpatialIndex(instance);
+}
+
+void InitialInstancesContainer::OnInstanceBoundsChanged(
+    gd::InitialInstance& instance) {
+  if (!spatialIndex || spatialIndexOutdated) return;
+
+  InstanceBounds bounds = GetInstanceBounds(instance, objectsDefaultSizes);
+  spatialIndex->Update(
+      instance, bounds.left, bounds.top, bounds.right, bounds.bottom);
+}
 
 InitialInstanceFunctor::~InitialInstanceFunctor(){};
 
@@ -7,10 +7,14 @@
 #ifndef GDCORE_INITIALINSTANCESCONTAINER_H
 #define GDCORE_INITIALINSTANCESCONTAINER_H
 #include <list>
+#include <map>
+#include <memory>
+#include <utility>
 #include "GDCore/Project/InitialInstance.h"
 #include "GDCore/String.h"
 namespace gd {
 class InitialInstanceFunctor;
+class InitialInstancesSpatialIndex;
 }
 namespace gd {
 class Project;
@@ -37,7 +41,9 @@ namespace gd {
  */
 class GD_CORE_API InitialInstancesContainer {
  public:
-  InitialInstancesContainer(){};
+  InitialInstancesContainer();
+  InitialInstancesContainer(const InitialInstancesContainer &other);
+  InitialInstancesContainer &operator=(const InitialInstancesContainer &other);
   virtual ~InitialInstancesContainer();
 
   /**
@@ -158,6 +164,73 @@ class GD_CORE_API InitialInstancesContainer {
 #endif
   ///@}
 
+  /** \name Spatial queries
+   * Members functions related to finding the instances in a region.
+   *
+   * The bounding box of an instance starts at its position and has its custom
+   * size, or the default size of its object if set with SetObjectDefaultSize
+   * (otherwise, it's only the position). The angle of the instance is not
+   * taken into account.
+   */
+  ///@{
+
+  /**
+   * \brief Enable or disable the spatial index, a grid of the bounding boxes
+   * of the instances kept up to date when instances are added, moved or
+   * removed, so that the instances in a region are found without iterating
+   * over all of them.
+   *
+   * Without the index, spatial queries iterate over all the instances.
+   *
+   * \note Only the setters of gd::InitialInstance update the index: an
+   * instance must not be given a new position by other means.
+   *
+   * \note The index is not enabled by the editor: its selection and culling
+   * use the rendered bounds of the instances (with their origin and angle),
+   * which the bounding boxes of the index don't contain.
+   */
+  void SetSpatialIndexEnabled(bool enable);
+
+  /**
+   * \brief Return true if the spatial index is enabled.
+   */
+  bool IsSpatialIndexEnabled() const { return spatialIndex != nullptr; }
+
+  /**
+   * \brief Set the size of the instances of the object not having a custom
+   * size.
+   */
+  void SetObjectDefaultSize(const gd::String &objectName,
+                            double width,
+                            double height);
+
+  /**
+   * \brief Apply \a func to each instance on the layer having a bounding box
+   * intersecting the given region (borders included), in no particular order.
+   *
+   * \warning Instances must not be added or removed by \a func.
+   * \see InitialInstanceFunctor
+   */
+  void IterateOverInstancesInRegion(InitialInstanceFunctor &func,
+                                    const gd::String &layer,
+                                    double left,
+                                    double top,
+                                    double right,
+                                    double bottom);
+
+  /**
+   * \brief Apply \a func to each instance on the layer having a bounding box
+   * containing the given point, in no particular order.
+   *
+   * \warning Instances must not be added or removed by \a func.
+   * \see InitialInstanceFunctor
+   */
+  void IterateOverInstancesAtPoint(InitialInstanceFunctor &func,
+                                   const gd::String &layer,
+                                   double x,
+                                   double y);
+  ///@}
+
   /** \name Saving and loading
    * Members functions related to saving and loading the object.
    */
@@ -177,10 +250,32 @@ class GD_CORE_API InitialInstancesContainer {
   ///@}
 
  private:
+  friend class InitialInstance;
+
   void RemoveInstanceIf(
       std::function<bool(const gd::InitialInstance &)> predicate);
 
+  /**
+   * \brief Link the instance to the container and add it to the spatial
+   * index, if enabled.
+   */
+  void AddToSpatialIndex(gd::InitialInstance &instance);
+
+  /**
+   * \brief Index again all the instances, if the spatial index is outdated.
+   */
+  void UpdateSpatialIndex();
+
+  void OnInstanceBoundsChanged(gd::InitialInstance &instance);
+  void MarkSpatialIndexOutdated() { spatialIndexOutdated = true; };
+
   std::list<gd::InitialInstance> initialInstances;
+  std::map<gd::String, std::pair<double, double>>
+      objectsDefaultSizes;  ///< The width and height of the instances of
+                            ///< objects not having a custom size.
+  std::unique_ptr<gd::InitialInstancesSpatialIndex>
+      spatialIndex;  ///< The spatial index, or nullptr if disabled.
+  bool spatialIndexOutdated = false;
 
   static gd::InitialInstance badPosition;
 };
@@ -0,0 +1,221 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/InitialInstancesSpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "GDCore/Project/InitialInstance.h"
+
+namespace gd {
+
+const std::int64_t InitialInstancesSpatialIndex::maxCellsPerInstance = 64;
+
+namespace {
+
+template <class Items>
+void RemoveItemOf(Items& items, const gd::InitialInstance* instance) {
+  for (std::size_t i = 0; i < items.size(); ++i) {
+    if (items[i].instance == instance) {
+      // Order of the items does not matter.
+      items[i] = items.back();
+      items.pop_back();
+      return;
+    }
+  }
+}
+
+/**
+ * \brief Return true if a region of the given number of cells in each direction
+ * has more cells than the (positive) limit.
+ *
+ * The multiplication is avoided, as it overflows for regions spanning most
+ * of the coordinates (like those with infinite bounds).
+ */
+bool HasMoreCellsThan(std::int64_t cellsCountX,
+                      std::int64_t cellsCountY,
+                      std::int64_t limit) {
+  return cellsCountY > 0 && cellsCountX > limit / cellsCountY;
+}
+
+}  // namespace
+
+InitialInstancesSpatialIndex::InitialInstancesSpatialIndex(double cellSize_)
+    : cellSize(cellSize_ > 0 ? cellSize_ : 256) {}
+
+InitialInstancesSpatialIndex::~InitialInstancesSpatialIndex() {}
+
+std::int32_t InitialInstancesSpatialIndex::GetCellCoordinate(
+    double position) const {
+  double cell = std::floor(position / cellSize);
+  // Also handles NaN, by putting the instance in the first cell.
+  if (!(cell >= std::numeric_limits<std::int32_t>::min()))
+    return std::numeric_limits<std::int32_t>::min();
+  if (cell > std::numeric_limits<std::int32_t>::max())
+    return std::numeric_limits<std::int32_t>::max();
+  return static_cast<std::int32_t>(cell);
+}
+
+std::uint64_t InitialInstancesSpatialIndex::GetCellKey(std::int32_t cellX,
+                                                       std::int32_t cellY) {
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cellX)) << 32) |
+         static_cast<std::uint32_t>(cellY);
+}
+
+void InitialInstancesSpatialIndex::Update(gd::InitialInstance& instance,
+                                          double left,
+                                          double top,
+                                          double right,
+                                          double bottom) {
+  auto it = entries.find(&instance);
+  if (it != entries.end()) {
+    RemoveFromGrid(it->second);
+  } else {
+    it = entries.emplace(&instance, Entry()).first;
+  }
+
+  Entry& entry = it->second;
+  entry.instance = &instance;
+  entry.layer = instance.GetLayer();
+  entry.left = std::min(left, right);
+  entry.right = std::max(left, right);
+  entry.top = std::min(top, bottom);
+  entry.bottom = std::max(top, bottom);
+  entry.minCellX = GetCellCoordinate(entry.left);
+  entry.minCellY = GetCellCoordinate(entry.top);
+  entry.maxCellX = GetCellCoordinate(entry.right);
+  entry.maxCellY = GetCellCoordinate(entry.bottom);
+  entry.isLarge = HasMoreCellsThan(
+      static_cast<std::int64_t>(entry.maxCellX) - entry.minCellX + 1,
+      static_cast<std::int64_t>(entry.maxCellY) - entry.minCellY + 1,
+      maxCellsPerInstance);
+  AddToGrid(entry);
+}
+
+void InitialInstancesSpatialIndex::Remove(const gd::InitialInstance& instance) {
+  auto it = entries.find(&instance);
+  if (it == entries.end()) return;
+
+  RemoveFromGrid(it->second);
+  entries.erase(it);
+}
+
+void InitialInstancesSpatialIndex::Clear() {
+  entries.clear();
+  layers.clear();
+}
+
+void InitialInstancesSpatialIndex::AddToGrid(const Entry& entry) {
+  CellItem item{entry.instance,
+                entry.left,
+                entry.top,
+                entry.right,
+                entry.bottom,
+                entry.minCellX,
+                entry.minCellY};
+  LayerGrid& grid = layers[entry.layer];
+  if (entry.isLarge) {
+    grid.largeInstances.push_back(item);
+    return;
+  }
+
+  for (std::int64_t cellX = entry.minCellX; cellX <= entry.maxCellX; ++cellX) {
+    for (std::int64_t cellY = entry.minCellY; cellY <= entry.maxCellY;
+         ++cellY) {
+      grid.cells[GetCellKey(cellX, cellY)].push_back(item);
+    }
+  }
+}
+
+void InitialInstancesSpatialIndex::RemoveFromGrid(const Entry& entry) {
+  auto gridIt = layers.find(entry.layer);
+  if (gridIt == layers.end()) return;
+
+  LayerGrid& grid = gridIt->second;
+  if (entry.isLarge) {
+    RemoveItemOf(grid.largeInstances, entry.instance);
+    return;
+  }
+
+  for (std::int64_t cellX = entry.minCellX; cellX <= entry.maxCellX; ++cellX) {
+    for (std::int64_t cellY = entry.minCellY; cellY <= entry.maxCellY;
+         ++cellY) {
+      auto cellIt = grid.cells.find(GetCellKey(cellX, cellY));
+      if (cellIt == grid.cells.end()) continue;
+
+      RemoveItemOf(cellIt->second, entry.instance);
+      if (cellIt->second.empty()) grid.cells.erase(cellIt);
+    }
+  }
+}
+
+void InitialInstancesSpatialIndex::QueryRegion(
+    const gd::String& layer,
+    double left,
+    double top,
+    double right,
+    double bottom,
+    const std::function<void(gd::InitialInstance&)>& func) const {
+  auto gridIt = layers.find(layer);
+  if (gridIt == layers.end()) return;
+  const LayerGrid& grid = gridIt->second;
+
+  if (left > right) std::swap(left, right);
+  if (top > bottom) std::swap(top, bottom);
+  auto intersects = [&](const CellItem& item) {
+    return item.left <= right && item.right >= left && item.top <= bottom &&
+           item.bottom >= top;
+  };
+
+  for (const CellItem& item : grid.largeInstances) {
+    if (intersects(item)) func(*item.instance);
+  }
+
+  const std::int64_t minCellX = GetCellCoordinate(left);
+  const std::int64_t minCellY = GetCellCoordinate(top);
+  const std::int64_t maxCellX = GetCellCoordinate(right);
+  const std::int64_t maxCellY = GetCellCoordinate(bottom);
+  if (HasMoreCellsThan(maxCellX - minCellX + 1,
+                       maxCellY - minCellY + 1,
+                       static_cast<std::int64_t>(grid.cells.size()))) {
+    // The region covers more cells than the layer has: check each cell
+    // instead of each position of the region.
+    for (const auto& cell : grid.cells) {
+      const std::int64_t cellX = static_cast<std::int32_t>(cell.first >> 32);
+      const std::int64_t cellY = static_cast<std::int32_t>(cell.first);
+      if (cellX < minCellX || cellX > maxCellX || cellY < minCellY ||
+          cellY > maxCellY)
+        continue;
+
+      for (const CellItem& item : cell.second) {
+        // Instances covering several cells are only given for the first of
+        // their cells covered by the region.
+        if (cellX == std::max<std::int64_t>(item.minCellX, minCellX) &&
+            cellY == std::max<std::int64_t>(item.minCellY, minCellY) &&
+            intersects(item))
+          func(*item.instance);
+      }
+    }
+    return;
+  }
+
+  for (std::int64_t cellX = minCellX; cellX <= maxCellX; ++cellX) {
+    for (std::int64_t cellY = minCellY; cellY <= maxCellY; ++cellY) {
+      auto cellIt = grid.cells.find(GetCellKey(cellX, cellY));
+      if (cellIt == grid.cells.end()) continue;
+
+      for (const CellItem& item : cellIt->second) {
+        if (cellX == std::max<std::int64_t>(item.minCellX, minCellX) &&
+            cellY == std::max<std::int64_t>(item.minCellY, minCellY) &&
+            intersects(item))
+          func(*item.instance);
+      }
+    }
+  }
+}
+
+}  // namespace gd
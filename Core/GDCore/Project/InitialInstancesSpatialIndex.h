@@ -0,0 +1,118 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_INITIALINSTANCESSPATIALINDEX_H
+#define GDCORE_INITIALINSTANCESSPATIALINDEX_H
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class InitialInstance;
+}
+
+namespace gd {
+
+/**
+ * \brief A uniform grid storing the bounding boxes of initial instances, for
+ * each layer, so that the instances in a region can be found without
+ * iterating over all of them.
+ *
+ * Instances are stored in all the cells covered by their bounding box, except
+ * the ones covering too many cells which are checked for each query.
+ *
+ * \see gd::InitialInstancesContainer::SetSpatialIndexEnabled
+ *
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API InitialInstancesSpatialIndex {
+ public:
+  /**
+   * \brief Create an empty index, with cells of \a cellSize pixels.
+   */
+  InitialInstancesSpatialIndex(double cellSize = 256);
+  virtual ~InitialInstancesSpatialIndex();
+
+  /**
+   * \brief Add the instance to the index, or update its bounding box and
+   * layer if already indexed.
+   */
+  void Update(gd::InitialInstance& instance,
+              double left,
+              double top,
+              double right,
+              double bottom);
+
+  /**
+   * \brief Remove the instance from the index, if indexed.
+   */
+  void Remove(const gd::InitialInstance& instance);
+
+  /**
+   * \brief Remove all the instances from the index.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the number of indexed instances.
+   */
+  std::size_t GetInstancesCount() const { return entries.size(); };
+
+  /**
+   * \brief Call \a func on each instance of the layer having a bounding box
+   * intersecting the given region (borders included). Instances are given in
+   * no particular order.
+   */
+  void QueryRegion(const gd::String& layer,
+                   double left,
+                   double top,
+                   double right,
+                   double bottom,
+                   const std::function<void(gd::InitialInstance&)>& func) const;
+
+ private:
+  struct Entry {
+    gd::InitialInstance* instance;
+    gd::String layer;
+    double left, top, right, bottom;
+    std::int32_t minCellX, minCellY, maxCellX, maxCellY;
+    bool isLarge;  ///< True if stored in the large instances of the layer
+                   ///< instead of in the cells.
+  };
+
+  /**
+   * \brief An instance stored in a cell, with its bounding box so that
+   * queries don't have to look for its entry.
+   */
+  struct CellItem {
+    gd::InitialInstance* instance;
+    double left, top, right, bottom;
+    std::int32_t minCellX, minCellY;
+  };
+
+  struct LayerGrid {
+    std::unordered_map<std::uint64_t, std::vector<CellItem>> cells;
+    std::vector<CellItem> largeInstances;
+  };
+
+  std::int32_t GetCellCoordinate(double position) const;
+  static std::uint64_t GetCellKey(std::int32_t cellX, std::int32_t cellY);
+  void AddToGrid(const Entry& entry);
+  void RemoveFromGrid(const Entry& entry);
+
+  double cellSize;
+  std::unordered_map<const gd::InitialInstance*, Entry> entries;
+  std::unordered_map<gd::String, LayerGrid> layers;
+
+  static const std::int64_t maxCellsPerInstance;  ///< Instances covering more
+                                                  ///< cells are stored as
+                                                  ///< large instances.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_INITIALINSTANCESSPATIALINDEX_H
@@ -294,7 +294,7 @@ void Layout::SerializeTo(SerializerElement& element) const {
   GetVariables().SerializeTo(element.AddChild("variables"));
   GetInitialInstances().SerializeTo(element.AddChild("instances"));
   SerializeObjectsTo(element.AddChild("objects"));
-  gd::EventsListSerialization::SerializeEventsTo(events,
+  gd::EventsListSerialization::SerializeEventsTo(GetEvents(),
                                                  element.AddChild("events"));
 
   SerializeLayersTo(element.AddChild("layers"));
@@ -353,7 +353,7 @@ void Layout::UnserializeFrom(gd::Project& project,
       project, GetEvents(), element.GetChild("events", 0, "Events"));
 
   UnserializeObjectsFrom(project, element.GetChild("objects", 0, "Objets"));
-  initialInstances.UnserializeFrom(
+  GetInitialInstances().UnserializeFrom(
       element.GetChild("instances", 0, "Positions"));
   variables.UnserializeFrom(element.GetChild("variables", 0, "Variables"));
 
@@ -399,7 +399,7 @@ void Layout::UnserializeFrom(gd::Project& project,
   }
 }
 
-void Layout::Init(const Layout& other) {
+void Layout::Init(const Layout& other, bool asSnapshot) {
   SetName(other.name);
   backgroundColorR = other.backgroundColorR;
   backgroundColorG = other.backgroundColorG;
@@ -408,11 +408,15 @@ void Layout::Init(const Layout& other) {
   title = other.title;
   stopSoundsOnStartup = other.stopSoundsOnStartup;
   disableInputWhenNotFocused = other.disableInputWhenNotFocused;
-  initialInstances = other.initialInstances;
+  if (asSnapshot)
+    initialInstances.ShareWith(other.initialInstances);
+  else
+    initialInstances = other.initialInstances;
   initialLayers = other.initialLayers;
   variables = other.GetVariables();
 
   initialObjects = gd::Clone(other.initialObjects);
+  objectsIndex.Invalidate();
 
   behaviorsSharedData.clear();
   for (const auto& it : other.behaviorsSharedData) {
@@ -420,7 +424,10 @@ void Layout::Init(const Layout& other) {
         std::unique_ptr<gd::BehaviorsSharedData>(it.second->Clone());
   }
 
-  events = other.events;
+  if (asSnapshot)
+    events.ShareWith(other.events);
+  else
+    events = other.events;
   editorSettings = other.editorSettings;
   objectGroups = other.objectGroups;
 
@@ -18,6 +18,7 @@
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
 #include "GDCore/IDE/Dialogs/LayoutEditorCanvas/EditorSettings.h"
+#include "GDCore/Tools/CopyOnWrite.h"
 
 namespace gd {
 class BaseEvent;
@@ -48,6 +49,15 @@ class GD_CORE_API Layout : public ObjectsContainer {
    */
   Layout* Clone() const { return new Layout(*this); };
 
+  /**
+   * \brief Initialize the layout as a copy of \a layout sharing its events
+   * and initial instances, which are only copied when accessed for
+   * modification.
+   *
+   * \see gd::Project::InitAsSnapshotOf
+   */
+  void InitAsSnapshotOf(const gd::Layout& layout) { Init(layout, true); };
+
   /** \name Common properties
    * Members functions related to common properties of layouts
    */
@@ -113,14 +123,14 @@ class GD_CORE_API Layout : public ObjectsContainer {
    * Return the container storing initial instances.
    */
   const gd::InitialInstancesContainer& GetInitialInstances() const {
-    return initialInstances;
+    return initialInstances.Get();
   }
 
   /**
    * Return the container storing initial instances.
    */
   gd::InitialInstancesContainer& GetInitialInstances() {
-    return initialInstances;
+    return initialInstances.GetMutable();
   }
   ///@}
 
@@ -132,12 +142,26 @@ class GD_CORE_API Layout : public ObjectsContainer {
   /**
    * Get the events of the layout
    */
-  const gd::EventsList& GetEvents() const { return events; }
+  const gd::EventsList& GetEvents() const { return events.Get(); }
 
   /**
    * Get the events of the layout
    */
-  gd::EventsList& GetEvents() { return events; }
+  gd::EventsList& GetEvents() { return events.GetMutable(); }
+
+  /**
+   * Remove all the events of the layout.
+   *
+   * \note Unlike `GetEvents().Clear()`, this does not copy the events if they
+   * are shared with another layout (see InitAsSnapshotOf).
+   */
+  void ClearEvents() { events.Reset(); }
+
+  /**
+   * Return true if the events are shared with another layout, and so will be
+   * copied when accessed for modification (see InitAsSnapshotOf).
+   */
+  bool HasSharedEvents() const { return events.IsShared(); }
 
   ///@}
 
@@ -375,7 +399,8 @@ class GD_CORE_API Layout : public ObjectsContainer {
   unsigned int backgroundColorB;     ///< Background color Blue component
   gd::String title;                  ///< Title displayed in the window
   gd::VariablesContainer variables;  ///< Variables list
-  gd::InitialInstancesContainer initialInstances;  ///< Initial instances
+  gd::CopyOnWrite<gd::InitialInstancesContainer>
+      initialInstances;  ///< Initial instances
   std::vector<gd::Layer> initialLayers;            ///< Initial layers
   std::map<gd::String, std::unique_ptr<gd::BehaviorsSharedData>>
       behaviorsSharedData;   ///< Initial shared datas of behaviors
@@ -392,7 +417,7 @@ class GD_CORE_API Layout : public ObjectsContainer {
                            ///< GetBehaviorSharedData can not find the
                            ///< specified behavior shared data.
 
-  EventsList events;  ///< Scene events
+  gd::CopyOnWrite<gd::EventsList> events;  ///< Scene events
   gd::EditorSettings editorSettings;
 
 // TODO: GD C++ Platform specific code below
@@ -402,8 +427,11 @@ class GD_CORE_API Layout : public ObjectsContainer {
   /**
    * Initialize from another layout. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
+   *
+   * \param asSnapshot If true, the events and initial instances are shared
+   * with the other layout instead of being copied.
    */
-  void Init(const gd::Layout& other);
+  void Init(const gd::Layout& other, bool asSnapshot = false);
 
   std::unique_ptr<gd::BehaviorsSharedData> CreateBehaviorsSharedData(
       gd::Project& project,
@@ -129,7 +129,7 @@ void Object::UnserializeFrom(gd::Project& project,
                              const SerializerElement& element) {
   SetType(element.GetStringAttribute("type"));
   assetStoreId = element.GetStringAttribute("assetStoreId");
-  name = element.GetStringAttribute("name", name, "nom");
+  SetName(element.GetStringAttribute("name", name.GetString(), "nom"));
   tags = element.GetStringAttribute("tags");
 
   objectVariables.UnserializeFrom(
@@ -14,7 +14,9 @@
 #include "GDCore/Project/ObjectConfiguration.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 #include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/NameIndex.h"
 #include "GDCore/Vector2.h"
 
 namespace gd {
@@ -61,7 +63,10 @@ class GD_CORE_API Object {
    * Assignment operator. Calls Init().
    */
   Object& operator=(const gd::Object& object) {
-    if ((this) != &object) Init(object);
+    if ((this) != &object) {
+      if (object.name != name) nameIndexNotifier.NotifyRenamed();
+      Init(object);
+    }
     return *this;
   }
 
@@ -96,11 +101,27 @@ class GD_CORE_API Object {
 
   /** \brief Change the name of the object with the name passed as parameter.
    */
-  void SetName(const gd::String& name_) { name = name_; };
+  void SetName(const gd::String& name_) {
+    if (name_ != name.GetString()) nameIndexNotifier.NotifyRenamed();
+    name = gd::InternedString(name_);
+  };
 
   /** \brief Return the name of the object.
    */
-  const gd::String& GetName() const { return name; };
+  const gd::String& GetName() const { return name.GetString(); };
+
+  /**
+   * \brief Return the notifier used to update the index of the container of
+   * the object when it's renamed.
+   */
+  const gd::NameIndexNotifier& GetNameIndexNotifier() const {
+    return nameIndexNotifier;
+  };
+
+  /** \brief Return the name of the object, as an interned string so that it
+   * can be compared or used as a key in constant time.
+   */
+  const gd::InternedString& GetInternedName() const { return name; };
 
   /** \brief Change the asset store id of the object.
    */
@@ -246,7 +267,7 @@ class GD_CORE_API Object {
   ///@}
 
  protected:
-  gd::String name;          ///< The full name of the object
+  gd::InternedString name;  ///< The full name of the object
   gd::String assetStoreId;  ///< The ID of the asset if the object comes from
                             ///< the store.
   std::unique_ptr<gd::ObjectConfiguration> configuration;
@@ -259,6 +280,7 @@ class GD_CORE_API Object {
   gd::String tags;      ///< Comma-separated list of tags
   gd::EffectsContainer
       effectsContainer;  ///< The effects container for the object.
+  gd::NameIndexNotifier nameIndexNotifier;
 
   /**
    * Initialize object using another object. Used by copy-ctor and assign-op.
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 
 namespace gd {
 class SerializerElement;
@@ -56,7 +57,18 @@ class GD_CORE_API ObjectGroup {
 
   /** \brief Change group name
    */
-  inline void SetName(const gd::String& name_) { name = name_; };
+  inline void SetName(const gd::String& name_) {
+    if (name_ != name) nameIndexNotifier.NotifyRenamed();
+    name = name_;
+  };
+
+  /**
+   * \brief Return the notifier used to update the index of the container of
+   * the group when it's renamed.
+   */
+  const gd::NameIndexNotifier& GetNameIndexNotifier() const {
+    return nameIndexNotifier;
+  };
 
   /**
    * \brief Get a vector with objects names.
@@ -78,6 +90,7 @@ class GD_CORE_API ObjectGroup {
  private:
   std::vector<gd::String> memberObjects;
   gd::String name;  ///< Group name
+  gd::NameIndexNotifier nameIndexNotifier;
 };
 
 }  // namespace gd
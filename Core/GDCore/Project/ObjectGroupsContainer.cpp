@@ -32,6 +32,7 @@ ObjectGroupsContainer& ObjectGroupsContainer::operator=(
 
 void ObjectGroupsContainer::Init(const ObjectGroupsContainer& other) {
   objectGroups.clear();
+  groupsIndex.Invalidate();
   for (auto& it : other.objectGroups) {
     objectGroups.push_back(gd::make_unique<gd::ObjectGroup>(*it));
   }
@@ -46,6 +47,7 @@ void ObjectGroupsContainer::SerializeTo(SerializerElement& element) const {
 
 void ObjectGroupsContainer::UnserializeFrom(const SerializerElement& element) {
   objectGroups.clear();
+  groupsIndex.Invalidate();
   element.ConsiderAsArrayOf("group", "Groupe");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
     const SerializerElement& groupElement = element.GetChild(i);
@@ -55,13 +57,23 @@ void ObjectGroupsContainer::UnserializeFrom(const SerializerElement& element) {
   }
 }
 
+std::size_t ObjectGroupsContainer::FindPosition(const gd::String& name) const {
+  return groupsIndex.Find(
+      objectGroups,
+      name,
+      [](const std::unique_ptr<gd::ObjectGroup>& group)
+          -> const gd::ObjectGroup& { return *group; });
+}
+
+void ObjectGroupsContainer::OnInserted(std::size_t position) {
+  if (position == objectGroups.size() - 1)
+    groupsIndex.OnAppended(*objectGroups[position], objectGroups.size());
+  else
+    groupsIndex.Invalidate();
+}
+
 bool ObjectGroupsContainer::Has(const gd::String& name) const {
-  auto i = std::find_if(objectGroups.begin(),
-                        objectGroups.end(),
-                        [&name](const std::unique_ptr<gd::ObjectGroup>& group) {
-                          return group->GetName() == name;
-                        });
-  return (i != objectGroups.end());
+  return FindPosition(name) != gd::String::npos;
 }
 
 ObjectGroup& ObjectGroupsContainer::Get(std::size_t index) {
@@ -77,23 +89,15 @@ const ObjectGroup& ObjectGroupsContainer::Get(std::size_t index) const {
 }
 
 ObjectGroup& ObjectGroupsContainer::Get(const gd::String& name) {
-  auto i = std::find_if(objectGroups.begin(),
-                        objectGroups.end(),
-                        [&name](const std::unique_ptr<gd::ObjectGroup>& group) {
-                          return group->GetName() == name;
-                        });
-  if (i != objectGroups.end()) return **i;
+  std::size_t position = FindPosition(name);
+  if (position != gd::String::npos) return *objectGroups[position];
 
   return badGroup;
 }
 
 const ObjectGroup& ObjectGroupsContainer::Get(const gd::String& name) const {
-  auto i = std::find_if(objectGroups.begin(),
-                        objectGroups.end(),
-                        [&name](const std::unique_ptr<gd::ObjectGroup>& group) {
-                          return group->GetName() == name;
-                        });
-  if (i != objectGroups.end()) return **i;
+  std::size_t position = FindPosition(name);
+  if (position != gd::String::npos) return *objectGroups[position];
 
   return badGroup;
 }
@@ -106,47 +110,42 @@ void ObjectGroupsContainer::Remove(const gd::String& name) {
                        return group->GetName() == name;
                      }),
       objectGroups.end());
+  groupsIndex.Invalidate();
 }
 
 std::size_t ObjectGroupsContainer::GetPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < objectGroups.size(); ++i) {
-    if (objectGroups[i]->GetName() == name) return i;
-  }
-
-  return gd::String::npos;
+  return FindPosition(name);
 }
 
 ObjectGroup& ObjectGroupsContainer::InsertNew(const gd::String& name,
                                               std::size_t position) {
-  gd::ObjectGroup& newlyInsertedGroup = *(*(objectGroups.insert(
+  auto newGroup = gd::make_unique<gd::ObjectGroup>();
+  newGroup->SetName(name);
+  auto it = objectGroups.insert(
       position < objectGroups.size() ? objectGroups.begin() + position
                                      : objectGroups.end(),
-      gd::make_unique<gd::ObjectGroup>())));
-  newlyInsertedGroup.SetName(name);
-  return newlyInsertedGroup;
+      std::move(newGroup));
+  OnInserted(it - objectGroups.begin());
+  return **it;
 }
 
 ObjectGroup& ObjectGroupsContainer::Insert(const gd::ObjectGroup& group,
                                            std::size_t position) {
-  gd::ObjectGroup& newlyInsertedGroup = *(*(objectGroups.insert(
+  auto it = objectGroups.insert(
       position < objectGroups.size() ? objectGroups.begin() + position
                                      : objectGroups.end(),
-      gd::make_unique<gd::ObjectGroup>(group))));
-  return newlyInsertedGroup;
+      gd::make_unique<gd::ObjectGroup>(group));
+  OnInserted(it - objectGroups.begin());
+  return **it;
 }
 
 bool ObjectGroupsContainer::Rename(const gd::String& oldName,
                                    const gd::String& newName) {
   if (Has(newName)) return false;
 
-  auto i =
-      std::find_if(objectGroups.begin(),
-                   objectGroups.end(),
-                   [&oldName](const std::unique_ptr<gd::ObjectGroup>& group) {
-                     return group->GetName() == oldName;
-                   });
-  if (i != objectGroups.end()) {
-    (*i)->SetName(newName);
+  std::size_t position = FindPosition(oldName);
+  if (position != gd::String::npos) {
+    objectGroups[position]->SetName(newName);
   }
 
   return true;
@@ -160,6 +159,7 @@ void ObjectGroupsContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
       std::move(objectGroups[oldIndex]);
   objectGroups.erase(objectGroups.begin() + oldIndex);
   objectGroups.insert(objectGroups.begin() + newIndex, std::move(objectGroup));
+  groupsIndex.Invalidate();
 }
 
 }  // namespace gd
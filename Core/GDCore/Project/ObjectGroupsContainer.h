@@ -12,6 +12,7 @@
 
 #include "GDCore/Project/ObjectGroup.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 namespace gd {
 class SerializerElement;
 }
@@ -115,7 +116,10 @@ class GD_CORE_API ObjectGroupsContainer {
   /**
    * \brief Clear all groups of the container.
    */
-  inline void Clear() { objectGroups.clear(); }
+  inline void Clear() {
+    objectGroups.clear();
+    groupsIndex.Invalidate();
+  }
   ///@}
 
   /** \name Saving and loading
@@ -182,7 +186,19 @@ class GD_CORE_API ObjectGroupsContainer {
   void Init(const gd::ObjectGroupsContainer& other);
 
  private:
+  /**
+   * \brief Return the position of the group called \a name, or
+   * gd::String::npos.
+   */
+  std::size_t FindPosition(const gd::String& name) const;
+
+  /**
+   * \brief Update the index after a group was inserted at \a position.
+   */
+  void OnInserted(std::size_t position);
+
   std::vector<std::unique_ptr<gd::ObjectGroup>> objectGroups;
+  gd::NameIndex groupsIndex;  ///< Position of the groups, by name.
   static ObjectGroup badGroup;
 };
 
@@ -28,6 +28,7 @@ void ObjectsContainer::SerializeObjectsTo(SerializerElement& element) const {
 void ObjectsContainer::UnserializeObjectsFrom(
     gd::Project& project, const SerializerElement& element) {
   initialObjects.clear();
+  objectsIndex.Invalidate();
   element.ConsiderAsArrayOf("object", "Objet");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
     const SerializerElement& objectElement = element.GetChild(i);
@@ -45,20 +46,28 @@ void ObjectsContainer::UnserializeObjectsFrom(
   }
 }
 
+std::size_t ObjectsContainer::FindObjectPosition(
+    const gd::String& name) const {
+  return objectsIndex.Find(
+      initialObjects, name, [](const std::unique_ptr<gd::Object>& object)
+          -> const gd::Object& { return *object; });
+}
+
+void ObjectsContainer::OnObjectInserted(std::size_t position) {
+  if (position == initialObjects.size() - 1)
+    objectsIndex.OnAppended(*initialObjects[position], initialObjects.size());
+  else
+    objectsIndex.Invalidate();
+}
+
 bool ObjectsContainer::HasObjectNamed(const gd::String& name) const {
-  return (find_if(initialObjects.begin(),
-                  initialObjects.end(),
-                  bind2nd(gd::ObjectHasName(), name)) != initialObjects.end());
+  return FindObjectPosition(name) != gd::String::npos;
 }
 gd::Object& ObjectsContainer::GetObject(const gd::String& name) {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    bind2nd(gd::ObjectHasName(), name)));
+  return *initialObjects[FindObjectPosition(name)];
 }
 const gd::Object& ObjectsContainer::GetObject(const gd::String& name) const {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    bind2nd(gd::ObjectHasName(), name)));
+  return *initialObjects[FindObjectPosition(name)];
 }
 gd::Object& ObjectsContainer::GetObject(std::size_t index) {
   return *initialObjects[index];
@@ -67,10 +76,7 @@ const gd::Object& ObjectsContainer::GetObject(std::size_t index) const {
   return *initialObjects[index];
 }
 std::size_t ObjectsContainer::GetObjectPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < initialObjects.size(); ++i) {
-    if (initialObjects[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return FindObjectPosition(name);
 }
 std::size_t ObjectsContainer::GetObjectsCount() const {
   return initialObjects.size();
@@ -79,22 +85,24 @@ gd::Object& ObjectsContainer::InsertNewObject(const gd::Project& project,
                                               const gd::String& objectType,
                                               const gd::String& name,
                                               std::size_t position) {
-  gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
+  auto it = initialObjects.insert(
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
-      project.CreateObject(objectType, name))));
+      project.CreateObject(objectType, name));
+  OnObjectInserted(it - initialObjects.begin());
 
-  return newlyCreatedObject;
+  return **it;
 }
 
 gd::Object& ObjectsContainer::InsertObject(const gd::Object& object,
                                            std::size_t position) {
-  gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
+  auto it = initialObjects.insert(
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
-      std::unique_ptr<gd::Object>(object.Clone()))));
+      std::unique_ptr<gd::Object>(object.Clone()));
+  OnObjectInserted(it - initialObjects.begin());
 
-  return newlyCreatedObject;
+  return **it;
 }
 
 void ObjectsContainer::SwapObjects(std::size_t firstObjectIndex,
@@ -105,6 +113,7 @@ void ObjectsContainer::SwapObjects(std::size_t firstObjectIndex,
 
   std::iter_swap(initialObjects.begin() + firstObjectIndex,
                  initialObjects.begin() + secondObjectIndex);
+  objectsIndex.Invalidate();
 }
 
 void ObjectsContainer::MoveObject(std::size_t oldIndex, std::size_t newIndex) {
@@ -114,36 +123,34 @@ void ObjectsContainer::MoveObject(std::size_t oldIndex, std::size_t newIndex) {
   std::unique_ptr<gd::Object> object = std::move(initialObjects[oldIndex]);
   initialObjects.erase(initialObjects.begin() + oldIndex);
   initialObjects.insert(initialObjects.begin() + newIndex, std::move(object));
+  objectsIndex.Invalidate();
 }
 
 void ObjectsContainer::RemoveObject(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::Object>>::iterator objectIt =
-      find_if(initialObjects.begin(),
-              initialObjects.end(),
-              bind2nd(ObjectHasName(), name));
-  if (objectIt == initialObjects.end()) return;
+  std::size_t position = FindObjectPosition(name);
+  if (position == gd::String::npos) return;
 
-  initialObjects.erase(objectIt);
+  initialObjects.erase(initialObjects.begin() + position);
+  objectsIndex.Invalidate();
 }
 
 void ObjectsContainer::MoveObjectToAnotherContainer(
     const gd::String& name,
     gd::ObjectsContainer& newContainer,
     std::size_t newPosition) {
-  std::vector<std::unique_ptr<gd::Object>>::iterator objectIt =
-      find_if(initialObjects.begin(),
-              initialObjects.end(),
-              bind2nd(ObjectHasName(), name));
-  if (objectIt == initialObjects.end()) return;
+  std::size_t position = FindObjectPosition(name);
+  if (position == gd::String::npos) return;
 
-  std::unique_ptr<gd::Object> object = std::move(*objectIt);
-  initialObjects.erase(objectIt);
+  std::unique_ptr<gd::Object> object = std::move(initialObjects[position]);
+  initialObjects.erase(initialObjects.begin() + position);
+  objectsIndex.Invalidate();
 
-  newContainer.initialObjects.insert(
+  auto it = newContainer.initialObjects.insert(
       newPosition < newContainer.initialObjects.size()
           ? newContainer.initialObjects.begin() + newPosition
           : newContainer.initialObjects.end(),
       std::move(object));
+  newContainer.OnObjectInserted(it - newContainer.initialObjects.begin());
 }
 
 }  // namespace gd
@@ -9,6 +9,7 @@
 #include <vector>
 #include "GDCore/String.h"
 #include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Tools/NameIndex.h"
 namespace gd {
 class Object;
 class Project;
@@ -140,6 +141,10 @@ class GD_CORE_API ObjectsContainer {
 
   /**
    * Provide a raw access to the vector containing the objects
+   *
+   * \warning Prefer the other methods to modify the objects: changes made
+   * through this vector that keep the number of objects unchanged are not
+   * detected by the index of objects names.
    */
   std::vector<std::unique_ptr<gd::Object> >& GetObjects() {
     return initialObjects;
@@ -190,6 +195,21 @@ class GD_CORE_API ObjectsContainer {
   std::vector<std::unique_ptr<gd::Object> >
       initialObjects;  ///< Objects contained.
   gd::ObjectGroupsContainer objectGroups;
+  gd::NameIndex objectsIndex;  ///< Position of the objects, by name. Must be
+                               ///< invalidated when initialObjects is
+                               ///< modified directly.
+
+ private:
+  /**
+   * \brief Return the position of the object called \a name, or
+   * gd::String::npos.
+   */
+  std::size_t FindObjectPosition(const gd::String& name) const;
+
+  /**
+   * \brief Update the index after an object was inserted at \a position.
+   */
+  void OnObjectInserted(std::size_t position);
 };
 
 }  // namespace gd
@@ -19,6 +19,7 @@
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/Events/EventsReferencesIndex.h"
 #include "GDCore/IDE/Events/UsedExtensionsFinder.h"
 #include "GDCore/IDE/PlatformManager.h"
 #include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
@@ -80,6 +81,14 @@ Project::Project()
 
 Project::~Project() {}
 
+void Project::SetEventsReferencesIndexEnabled(bool enable) {
+  if (!enable)
+    eventsReferencesIndex.reset();
+  else if (!eventsReferencesIndex)
+    eventsReferencesIndex =
+        gd::make_unique<gd::EventsReferencesIndex>(GetCurrentPlatform());
+}
+
 void Project::ResetProjectUuid() { projectUuid = UUID::MakeUuid4(); }
 
 std::unique_ptr<gd::Object> Project::CreateObject(
@@ -802,7 +811,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
 
   GetObjectGroups().UnserializeFrom(
       element.GetChild("objectsGroups", 0, "ObjectGroups"));
-  resourcesManager.UnserializeFrom(
+  GetResourcesManager().UnserializeFrom(
       element.GetChild("resources", 0, "Resources"));
   UnserializeObjectsFrom(*this, element.GetChild("objects", 0, "Objects"));
   GetVariables().UnserializeFrom(element.GetChild("variables", 0, "Variables"));
@@ -953,7 +962,7 @@ void Project::SerializeTo(SerializerElement& element) const {
   else
     std::cout << "ERROR: The project current platform is NULL.";
 
-  resourcesManager.SerializeTo(element.AddChild("resources"));
+  GetResourcesManager().SerializeTo(element.AddChild("resources"));
   SerializeObjectsTo(element.AddChild("objects"));
   GetObjectGroups().SerializeTo(element.AddChild("objectsGroups"));
   GetVariables().SerializeTo(element.AddChild("variables"));
@@ -1022,7 +1031,13 @@ void Project::ExposeResources(gd::ArbitraryResourceWorker& worker) {
       GetLayout(s).GetObject(j).GetConfiguration().ExposeResources(worker);
     }
 
-    LaunchResourceWorkerOnEvents(*this, GetLayout(s).GetEvents(), worker);
+    // Events shared with another project (see InitAsSnapshotOf) are only
+    // accessed for modification, and so copied, if the worker changes some
+    // of their resources.
+    const gd::Layout& layout = GetLayout(s);
+    if (!layout.HasSharedEvents() ||
+        LaunchResourceWorkerOnReadOnlyEvents(*this, layout.GetEvents(), worker))
+      LaunchResourceWorkerOnEvents(*this, GetLayout(s).GetEvents(), worker);
   }
   // Add external events resources
   for (std::size_t s = 0; s < GetExternalEventsCount(); s++) {
@@ -1104,7 +1119,7 @@ Project& Project::operator=(const Project& other) {
   return *this;
 }
 
-void Project::Init(const gd::Project& game) {
+void Project::Init(const gd::Project& game, bool asSnapshot) {
   name = game.name;
   categories = game.categories;
   description = game.description;
@@ -1149,11 +1164,23 @@ void Project::Init(const gd::Project& game) {
   currentPlatform = game.currentPlatform;
   platforms = game.platforms;
 
-  resourcesManager = game.resourcesManager;
+  if (asSnapshot)
+    resourcesManager.ShareWith(game.resourcesManager);
+  else
+    resourcesManager = game.resourcesManager;
 
   initialObjects = gd::Clone(game.initialObjects);
+  objectsIndex.Invalidate();
 
-  scenes = gd::Clone(game.scenes);
+  if (asSnapshot) {
+    scenes.clear();
+    for (const auto& scene : game.scenes) {
+      scenes.push_back(gd::make_unique<gd::Layout>());
+      scenes.back()->InitAsSnapshotOf(*scene);
+    }
+  } else {
+    scenes = gd::Clone(game.scenes);
+  }
 
   externalEvents = gd::Clone(game.externalEvents);
 
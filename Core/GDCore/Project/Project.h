@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 
+#include "GDCore/Events/Parsers/ParsedExpressionsCache.h"
 #include "GDCore/Project/ExtensionProperties.h"
 #include "GDCore/Project/LoadingScreen.h"
 #include "GDCore/Project/Watermark.h"
@@ -18,6 +19,7 @@
 #include "GDCore/Project/ResourcesManager.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/CopyOnWrite.h"
 namespace gd {
 class Platform;
 class Layout;
@@ -36,6 +38,7 @@ class Behavior;
 class BehaviorsSharedData;
 class BaseEvent;
 class SerializerElement;
+class EventsReferencesIndex;
 }  // namespace gd
 #undef GetObject  // Disable an annoying macro
 #undef CreateEvent
@@ -54,6 +57,20 @@ class GD_CORE_API Project : public ObjectsContainer {
   virtual ~Project();
   Project& operator=(const Project& rhs);
 
+  /**
+   * \brief Initialize the project as a snapshot of \a project, sharing the
+   * events and initial instances of its layouts and its resources instead of
+   * copying them.
+   *
+   * Shared parts are only copied when accessed for modification, so that
+   * a snapshot can be modified (for example by an export) without changing
+   * the original project. The other parts of the project are copied.
+   *
+   * \warning The snapshot sees the modifications done to the original
+   * project: it must not be used after the original project is modified.
+   */
+  void InitAsSnapshotOf(const gd::Project& project) { Init(project, true); };
+
   /** \name Common properties
    * Some properties for the project
    */
@@ -933,14 +950,16 @@ class GD_CORE_API Project : public ObjectsContainer {
    * the resources.
    */
   const ResourcesManager& GetResourcesManager() const {
-    return resourcesManager;
+    return resourcesManager.Get();
   }
 
   /**
    * \brief Provide access to the ResourceManager member containing the list of
    * the resources.
    */
-  ResourcesManager& GetResourcesManager() { return resourcesManager; }
+  ResourcesManager& GetResourcesManager() {
+    return resourcesManager.GetMutable();
+  }
 
   /**
    * \brief Called ( e.g. during compilation ) so as to inventory internal
@@ -986,6 +1005,53 @@ class GD_CORE_API Project : public ObjectsContainer {
   static bool ValidateName(const gd::String& name);
   ///@}
 
+  /** \name Expressions
+   */
+  ///@{
+  /**
+   * \brief Return the cache of parsed expressions, used by the workers that
+   * only read the expressions of the project (code generation, analysis...)
+   * to parse each distinct expression only once.
+   *
+   * \see gd::Expression::GetRootNode
+   */
+  gd::ParsedExpressionsCache& GetParsedExpressionsCache() const {
+    return parsedExpressionsCache;
+  }
+
+  /**
+   * \brief Enable (or disable) the index of the references to objects,
+   * behaviors, variables and functions in the events of the project.
+   *
+   * When enabled, the renaming and removal of objects in layouts are done by
+   * visiting only the instructions using them, and the usages of a name can
+   * be found without browsing the events. Other refactorings (like renaming
+   * behaviors or events functions) still browse all the events.
+   *
+   * \note The index uses the current platform of the project: it must be set
+   * before enabling the index.
+   * \see gd::EventsReferencesIndex
+   */
+  void SetEventsReferencesIndexEnabled(bool enable);
+
+  /**
+   * \brief Return true if the index of the references in the events is
+   * enabled.
+   */
+  bool IsEventsReferencesIndexEnabled() const {
+    return eventsReferencesIndex != nullptr;
+  }
+
+  /**
+   * \brief Return the index of the references in the events.
+   *
+   * \warning Only call this when IsEventsReferencesIndexEnabled returns true.
+   */
+  gd::EventsReferencesIndex& GetEventsReferencesIndex() {
+    return *eventsReferencesIndex;
+  }
+  ///@}
+
   /** \name External source files
    * To manage external C++ or Javascript source files used by the game
    */
@@ -1040,8 +1106,11 @@ class GD_CORE_API Project : public ObjectsContainer {
   /**
    * Initialize from another game. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
+   *
+   * \param asSnapshot If true, share the resources and the events and initial
+   * instances of the layouts instead of copying them (see InitAsSnapshotOf).
    */
-  void Init(const gd::Project& project);
+  void Init(const gd::Project& project, bool asSnapshot = false);
 
   gd::String name;            ///< Game name
   gd::String description;     ///< Game description
@@ -1075,7 +1144,7 @@ class GD_CORE_API Project : public ObjectsContainer {
       externalLayouts;  ///< List of all externals layouts
   std::vector<std::unique_ptr<gd::EventsFunctionsExtension> >
       eventsFunctionsExtensions;
-  gd::ResourcesManager
+  gd::CopyOnWrite<gd::ResourcesManager>
       resourcesManager;  ///< Contains all resources used by the project
   std::vector<gd::Platform*>
       platforms;  ///< Pointers to the platforms this project supports.
@@ -1118,6 +1187,12 @@ class GD_CORE_API Project : public ObjectsContainer {
                                         ///< time the project was saved.
   mutable unsigned int gdBuildVersion;  ///< The GD build version used the last
                                         ///< time the project was saved.
+  mutable gd::ParsedExpressionsCache
+      parsedExpressionsCache;  ///< Not copied with the project.
+  std::unique_ptr<gd::EventsReferencesIndex>
+      eventsReferencesIndex;  ///< Optional, not copied with the project.
+                              ///< Declared last so that it's destroyed before
+                              ///< the events.
 };
 
 }  // namespace gd
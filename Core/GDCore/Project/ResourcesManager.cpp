@@ -48,6 +48,7 @@ void ResourceFolder::Init(const ResourceFolder& other) {
 
 void ResourcesManager::Init(const ResourcesManager& other) {
   resources.clear();
+  resourcesIndex.Invalidate();
   for (std::size_t i = 0; i < other.resources.size(); ++i) {
     resources.push_back(std::shared_ptr<Resource>(other.resources[i]->Clone()));
   }
@@ -57,18 +58,26 @@ void ResourcesManager::Init(const ResourcesManager& other) {
   }
 }
 
+std::size_t ResourcesManager::FindResourcePosition(
+    const gd::String& name) const {
+  return resourcesIndex.Find(
+      resources,
+      name,
+      [](const std::shared_ptr<Resource>& resource) -> const gd::Resource& {
+        return *resource;
+      });
+}
+
 Resource& ResourcesManager::GetResource(const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
-  }
+  std::size_t position = FindResourcePosition(name);
+  if (position != gd::String::npos) return *resources[position];
 
   return badResource;
 }
 
 const Resource& ResourcesManager::GetResource(const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
-  }
+  std::size_t position = FindResourcePosition(name);
+  if (position != gd::String::npos) return *resources[position];
 
   return badResource;
 }
@@ -99,11 +108,7 @@ std::shared_ptr<Resource> ResourcesManager::CreateResource(
 }
 
 bool ResourcesManager::HasResource(const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return true;
-  }
-
-  return false;
+  return FindResourcePosition(name) != gd::String::npos;
 }
 
 const gd::String& ResourcesManager::GetResourceNameWithOrigin(
@@ -225,6 +230,7 @@ bool ResourcesManager::AddResource(const gd::Resource& resource) {
   if (newResource == std::shared_ptr<Resource>()) return false;
 
   resources.push_back(newResource);
+  resourcesIndex.OnAppended(*newResource, resources.size());
   return true;
 }
 
@@ -238,6 +244,7 @@ bool ResourcesManager::AddResource(const gd::String& name,
   res->SetName(name);
 
   resources.push_back(res);
+  resourcesIndex.OnAppended(*res, resources.size());
 
   return true;
 }
@@ -314,19 +321,18 @@ bool ResourceFolder::MoveResourceDownInList(const gd::String& name) {
 }
 
 bool ResourcesManager::MoveResourceUpInList(const gd::String& name) {
+  resourcesIndex.Invalidate();
   return gd::MoveResourceUpInList(resources, name);
 }
 
 bool ResourcesManager::MoveResourceDownInList(const gd::String& name) {
+  resourcesIndex.Invalidate();
   return gd::MoveResourceDownInList(resources, name);
 }
 
 std::size_t ResourcesManager::GetResourcePosition(
     const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return FindResourcePosition(name);
 }
 
 void ResourcesManager::MoveResource(std::size_t oldIndex,
@@ -336,6 +342,7 @@ void ResourcesManager::MoveResource(std::size_t oldIndex,
   auto resource = resources[oldIndex];
   resources.erase(resources.begin() + oldIndex);
   resources.insert(resources.begin() + newIndex, resource);
+  resourcesIndex.Invalidate();
 }
 
 bool ResourcesManager::MoveFolderUpInList(const gd::String& name) {
@@ -362,9 +369,8 @@ bool ResourcesManager::MoveFolderDownInList(const gd::String& name) {
 
 std::shared_ptr<gd::Resource> ResourcesManager::GetResourceSPtr(
     const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return resources[i];
-  }
+  std::size_t position = FindResourcePosition(name);
+  if (position != gd::String::npos) return resources[position];
 
   return std::shared_ptr<gd::Resource>();
 }
@@ -457,6 +463,7 @@ void ResourcesManager::RemoveResource(const gd::String& name) {
     else
       ++i;
   }
+  resourcesIndex.Invalidate();
 
   for (std::size_t i = 0; i < folders.size(); ++i)
     folders[i].RemoveResource(name);
@@ -489,6 +496,7 @@ void ResourceFolder::SerializeTo(SerializerElement& element) const {
 
 void ResourcesManager::UnserializeFrom(const SerializerElement& element) {
   resources.clear();
+  resourcesIndex.Invalidate();
   const SerializerElement& resourcesElement =
       element.GetChild("resources", 0, "Resources");
   resourcesElement.ConsiderAsArrayOf("resource", "Resource");
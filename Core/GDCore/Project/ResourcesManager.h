@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 namespace gd {
 class Project;
 class ResourceFolder;
@@ -32,12 +33,23 @@ class GD_CORE_API Resource {
 
   /** \brief Change the name of the resource with the name passed as parameter.
    */
-  virtual void SetName(const gd::String& name_) { name = name_; }
+  virtual void SetName(const gd::String& name_) {
+    if (name_ != name) nameIndexNotifier.NotifyRenamed();
+    name = name_;
+  }
 
   /** \brief Return the name of the resource.
    */
   virtual const gd::String& GetName() const { return name; }
 
+  /**
+   * \brief Return the notifier used to update the index of the resources
+   * manager of the resource when it's renamed.
+   */
+  const gd::NameIndexNotifier& GetNameIndexNotifier() const {
+    return nameIndexNotifier;
+  }
+
   /** \brief Change the kind of the resource
    */
   virtual void SetKind(const gd::String& newKind) { kind = newKind; }
@@ -154,6 +166,7 @@ class GD_CORE_API Resource {
   gd::String originIdentifier;
   bool userAdded;  ///< True if the resource was added by the user, and not
                    ///< automatically by GDevelop.
+  gd::NameIndexNotifier nameIndexNotifier;
 
   static gd::String badStr;
 };
@@ -670,7 +683,14 @@ class GD_CORE_API ResourcesManager {
  private:
   void Init(const ResourcesManager& other);
 
+  /**
+   * \brief Return the position of the resource called \a name, or
+   * gd::String::npos.
+   */
+  std::size_t FindResourcePosition(const gd::String& name) const;
+
   std::vector<std::shared_ptr<Resource> > resources;
+  gd::NameIndex resourcesIndex;  ///< Position of the resources, by name.
   std::vector<ResourceFolder> folders;
 
   static ResourceFolder badFolder;
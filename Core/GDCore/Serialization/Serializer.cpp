@@ -6,19 +6,34 @@
 
 #include "GDCore/Serialization/Serializer.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Serialization/SerializerElement.h"
-#include "rapidjson/document.h"
+#include "rapidjson/memorystream.h"
 #include "rapidjson/prettywriter.h"
 #include "rapidjson/rapidjson.h"
+#include "rapidjson/reader.h"
+#include "rapidjson/writer.h"
 #if !defined(EMSCRIPTEN)
 #include "GDCore/TinyXml/tinyxml.h"
+#if defined(WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #endif
 
 using namespace rapidjson;
@@ -111,120 +126,712 @@ gd::String Serializer::ToEscapedXMLString(const gd::String& str) {
 }
 
 namespace {
-void RapidJsonValueToElement(const Value& value,
-                             gd::SerializerElement& element) {
-  if (value.IsBool()) {
-    element.SetBoolValue(value.GetBool());
-  } else if (value.IsNumber()) {
-    if (value.IsInt64())
-      element.SetIntValue(value.GetInt64());
-    else if (value.IsUint64())
-      element.SetIntValue(value.GetUint64());
-    else if (value.IsInt())
-      element.SetValue(value.GetInt());
-    else if (value.IsUint())
-      element.SetValue(value.GetUint());
-    else if (value.IsDouble())
-      element.SetValue(value.GetDouble());
-    else if (value.IsFloat())
-      element.SetValue(value.GetFloat());
-  } else if (value.IsString()) {
-    element.SetStringValue(value.GetString());
-  } else if (value.IsObject()) {
-    for (auto& m : value.GetObject()) {
-      RapidJsonValueToElement(m.value, element.AddChild(m.name.GetString()));
-    }
-  } else if (value.IsArray()) {
-    element.ConsiderAsArray();
-    for (auto& m : value.GetArray()) {
-      RapidJsonValueToElement(m, element.AddChild(""));
+/**
+ * \brief A memory arena used to allocate all the elements of a loaded file in
+ * a few large blocks, instead of doing one allocation per element.
+ *
+ * Memory is only given back when the arena is destroyed, i.e: when all the
+ * elements allocated in it are destroyed.
+ */
+class SerializerElementArena {
+ public:
+  SerializerElementArena() : currentBlockUsed(0){};
+
+  void* Allocate(std::size_t size) {
+    const std::size_t alignment = alignof(std::max_align_t);
+    size = (size + alignment - 1) / alignment * alignment;
+    if (size > BLOCK_SIZE) {
+      blocks.emplace_back(new char[size]);
+      return blocks.back().get();
     }
+
+    if (blocks.empty() || currentBlockUsed + size > BLOCK_SIZE) {
+      blocks.emplace_back(new char[BLOCK_SIZE]);
+      currentBlock = blocks.back().get();
+      currentBlockUsed = 0;
+    }
+
+    void* memory = currentBlock + currentBlockUsed;
+    currentBlockUsed += size;
+    return memory;
+  }
+
+ private:
+  static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+
+  std::vector<std::unique_ptr<char[]>> blocks;
+  char* currentBlock = nullptr;
+  std::size_t currentBlockUsed;
+};
+
+/**
+ * \brief An allocator using a SerializerElementArena, to be used with
+ * std::allocate_shared. The arena is kept alive by the allocators (which are
+ * stored in the control block of each std::shared_ptr).
+ */
+template <class T>
+class SerializerElementArenaAllocator {
+ public:
+  typedef T value_type;
+
+  SerializerElementArenaAllocator(
+      std::shared_ptr<SerializerElementArena> arena_)
+      : arena(std::move(arena_)){};
+
+  template <class U>
+  SerializerElementArenaAllocator(
+      const SerializerElementArenaAllocator<U>& other)
+      : arena(other.arena){};
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(arena->Allocate(n * sizeof(T)));
+  }
+  void deallocate(T*, std::size_t){};
+
+  template <class U>
+  bool operator==(const SerializerElementArenaAllocator<U>& other) const {
+    return arena == other.arena;
+  }
+  template <class U>
+  bool operator!=(const SerializerElementArenaAllocator<U>& other) const {
+    return arena != other.arena;
+  }
+
+ private:
+  template <class U>
+  friend class SerializerElementArenaAllocator;
+
+  std::shared_ptr<SerializerElementArena> arena;
+};
+
+/**
+ * \brief A RapidJSON SAX handler building the gd::SerializerElement while
+ * the JSON is read, without building a rapidjson::Document first.
+ */
+class SerializerElementBuilder
+    : public BaseReaderHandler<UTF8<>, SerializerElementBuilder> {
+ public:
+  SerializerElementBuilder(gd::SerializerElement& rootElement_)
+      : rootElement(rootElement_),
+        allocator(std::make_shared<SerializerElementArena>()){};
+
+  bool Null() {
+    NextElement();
+    return true;
+  }
+  bool Bool(bool b) {
+    NextElement().SetBoolValue(b);
+    return true;
+  }
+  bool Int(int i) {
+    NextElement().SetIntValue(i);
+    return true;
+  }
+  bool Uint(unsigned u) {
+    NextElement().SetIntValue(u);
+    return true;
+  }
+  bool Int64(int64_t i) {
+    NextElement().SetIntValue(i);
+    return true;
+  }
+  bool Uint64(uint64_t u) {
+    NextElement().SetIntValue(u);
+    return true;
+  }
+  bool Double(double d) {
+    NextElement().SetValue(d);
+    return true;
+  }
+  bool String(const char* str, SizeType, bool) {
+    NextElement().SetStringValue(str);
+    return true;
+  }
+  bool StartObject() {
+    elementsStack.push_back(&NextElement());
+    return true;
+  }
+  bool Key(const char* str, SizeType, bool) {
+    key = str;
+    return true;
+  }
+  bool EndObject(SizeType) {
+    elementsStack.pop_back();
+    return true;
+  }
+  bool StartArray() {
+    gd::SerializerElement& element = NextElement();
+    element.ConsiderAsArray();
+    elementsStack.push_back(&element);
+    return true;
+  }
+  bool EndArray(SizeType) {
+    elementsStack.pop_back();
+    return true;
+  }
+
+ private:
+  /**
+   * \brief Return the element that must receive the next value: the root
+   * element, or a new child of the object/array being read.
+   */
+  gd::SerializerElement& NextElement() {
+    if (elementsStack.empty()) return rootElement;
+
+    gd::SerializerElement& parent = *elementsStack.back();
+    return parent.AddChild(parent.ConsideredAsArray() ? "" : key, allocator);
   }
+
+  gd::SerializerElement& rootElement;
+  std::vector<gd::SerializerElement*> elementsStack;
+  gd::String key;
+  SerializerElementArenaAllocator<gd::SerializerElement> allocator;
+};
+
+/**
+ * \brief A RapidJSON output stream appending the characters to a
+ * std::string.
+ */
+class StringOutputStream {
+ public:
+  typedef char Ch;
+
+  StringOutputStream(std::string& output_) : output(output_){};
+
+  void Put(Ch c) { output.push_back(c); }
+  void Flush(){};
+
+ private:
+  std::string& output;
+};
+
+template <typename Handler>
+bool WriteValue(const gd::SerializerValue& serializerValue, Handler& handler) {
+  // TODO: use GetRaw to avoid conversions
+  if (serializerValue.IsBoolean())
+    return handler.Bool(serializerValue.GetBool());
+  else if (serializerValue.IsDouble())
+    return handler.Double(serializerValue.GetDouble());
+  else if (serializerValue.IsInt())
+    return handler.Int(serializerValue.GetInt());
+  else if (serializerValue.IsString())
+    return handler.String(serializerValue.GetRawString().c_str());
+
+  return handler.Null();
 }
 
-void ElementToRapidJson(const gd::SerializerElement& element,
-                        Value& value,
-                        Document::AllocatorType& allocator) {
+/**
+ * \brief Send the element (and its children) to a RapidJSON handler (usually
+ * a writer), without building a RapidJSON document.
+ *
+ * Attributes are written before the children, in the same way as they would
+ * be if the element was converted to a rapidjson::Document.
+ */
+template <typename Handler>
+bool WriteElement(const gd::SerializerElement& element, Handler& handler) {
   if (!element.IsValueUndefined()) {
-    const SerializerValue& serializerValue = element.GetValue();
-    // TODO: use GetRaw to avoid conversions
-    if (serializerValue.IsBoolean())
-      value.SetBool(serializerValue.GetBool());
-    else if (serializerValue.IsDouble())
-      value.SetDouble(serializerValue.GetDouble());
-    else if (serializerValue.IsInt())
-      value.SetInt(serializerValue.GetInt());
-    else if (serializerValue.IsString()) {
-      // This does a copy of the string, and measure the string length.
-      value.SetString(serializerValue.GetRawString().c_str(), allocator);
-    }
+    return WriteValue(element.GetValue(), handler);
   } else if (element.ConsideredAsArray()) {
-    value.SetArray();
+    if (!handler.StartArray()) return false;
 
     const auto& children = element.GetAllChildren();
-    value.Reserve(children.size(), allocator);
-
     for (const auto& child : children) {
-      Value childValue;
-      ElementToRapidJson(*child.second, childValue, allocator);
-      value.PushBack(childValue, allocator);
+      if (!WriteElement(*child.second, handler)) return false;
     }
+    return handler.EndArray(children.size());
   } else {
-    value.SetObject();
+    if (!handler.StartObject()) return false;
 
     const auto& attributes = element.GetAllAttributes();
     const auto& children = element.GetAllChildren();
 
     for (const auto& attribute : attributes) {
-      Value name(attribute.first.c_str(),
-                 allocator);  // Copying the name is required.
-      Value childValue;
-      ElementToRapidJson(attribute.second, childValue, allocator);
-      value.AddMember(name, childValue, allocator);
+      if (!handler.Key(attribute.first.c_str())) return false;
+      if (!WriteValue(attribute.second, handler)) return false;
     }
     for (const auto& child : children) {
-      Value name(child.first.c_str(),
-                 allocator);  // Copying the name is required.
-      Value childValue;
-      ElementToRapidJson(*child.second, childValue, allocator);
-      value.AddMember(name, childValue, allocator);
+      if (!handler.Key(child.first.c_str())) return false;
+      if (!WriteElement(*child.second, handler)) return false;
     }
+    return handler.EndObject(attributes.size() + children.size());
   }
 }
-}  // namespace
 
-SerializerElement Serializer::FromJSON(const char* json) {
+/**
+ * \brief Build the gd::SerializerElement from JSON read from a RapidJSON
+ * input stream.
+ */
+template <typename InputStream>
+SerializerElement ParseJSON(InputStream& stream) {
   SerializerElement element;
-  size_t len = strlen(json);
-  if (len != 0) {
-    Document document;
-
-    // In-situ parsing, decode strings directly in the source string. Source
-    // must be string.
-    char buffer[len + 1];
-    memcpy(buffer, json, len + 1);
-    if (document.ParseInsitu(buffer).HasParseError()) {
+  if (stream.Peek() != '\0') {
+    // Build the elements while parsing, without copying the JSON string
+    // nor building a rapidjson::Document.
+    SerializerElementBuilder builder(element);
+    Reader reader;
+    if (reader.Parse(stream, builder).IsError()) {
       std::cout << "TODO: error while parsing" << std::endl;
+      element = SerializerElement();
       return element;
     }
-
-    RapidJsonValueToElement(document, element);
   }
 
   return element;
 }
 
+/**
+ * The binary format is:
+ * - the header ("GDSB" followed by the version of the format),
+ * - the number of strings and the strings (each prefixed by its size),
+ * - the root element.
+ *
+ * An element is:
+ * - a byte with the type of its value (BinaryValueType) and the flags
+ *   telling if the element is an array, has attributes and has children,
+ * - the value (see BinaryWriter::WriteValue),
+ * - if any, the number of attributes and, for each attribute, the index of
+ *   its name, its type and its value,
+ * - if any, the number of children and, for each child, the index of its
+ *   name, its size in bytes and the child element.
+ *
+ * Unsigned integers (sizes, indexes of strings) are written as varints (7
+ * bits per byte, the highest bit being set if more bytes follow). Integer
+ * values are zigzag-encoded first, and doubles are written as 8 bytes (little
+ * endian).
+ */
+const char BINARY_HEADER[] = {'G', 'D', 'S', 'B', 1};
+const std::size_t BINARY_HEADER_SIZE = sizeof(BINARY_HEADER);
+const unsigned char BINARY_ARRAY_FLAG = 0x80;
+const unsigned char BINARY_ATTRIBUTES_FLAG = 0x40;
+const unsigned char BINARY_CHILDREN_FLAG = 0x20;
+const unsigned char BINARY_VALUE_TYPE_MASK = 0x1f;
+
+enum class BinaryValueType : unsigned char {
+  Undefined = 0,  ///< For elements without a value.
+  False,
+  True,
+  Int,
+  Double,
+  String,
+  Unknown  ///< A value of unknown type, stored as a string.
+};
+
+/**
+ * \brief Write the elements in the binary format, except the header and the
+ * strings, which are collected in a table while the elements are written.
+ */
+class BinaryWriter {
+ public:
+  BinaryWriter(std::string& output_) : output(output_){};
+
+  void WriteElement(const gd::SerializerElement& element) {
+    const auto& attributes = element.GetAllAttributes();
+    const auto& children = element.GetAllChildren();
+
+    unsigned char typeAndFlags = static_cast<unsigned char>(
+        element.IsValueUndefined() ? BinaryValueType::Undefined
+                                   : GetBinaryValueType(element.GetValue()));
+    if (element.ConsideredAsArray()) typeAndFlags |= BINARY_ARRAY_FLAG;
+    if (!attributes.empty()) typeAndFlags |= BINARY_ATTRIBUTES_FLAG;
+    if (!children.empty()) typeAndFlags |= BINARY_CHILDREN_FLAG;
+    output.push_back(static_cast<char>(typeAndFlags));
+    if (!element.IsValueUndefined()) WriteValue(element.GetValue());
+
+    if (!attributes.empty()) {
+      WriteVarint(attributes.size());
+      for (const auto& attribute : attributes) {
+        WriteString(attribute.first);
+        output.push_back(
+            static_cast<char>(GetBinaryValueType(attribute.second)));
+        WriteValue(attribute.second);
+      }
+    }
+
+    if (!children.empty()) {
+      WriteVarint(children.size());
+      for (const auto& child : children) {
+        // Children of arrays are unnamed, like when read from JSON.
+        WriteString(element.ConsideredAsArray() ? emptyString : child.first);
+
+        // Reserve a byte for the size, which is enough for most children,
+        // and make room for more bytes if needed once the child is written.
+        std::size_t sizePosition = output.size();
+        output.push_back('\0');
+        WriteElement(*child.second);
+        std::size_t size = output.size() - sizePosition - 1;
+        if (size < 0x80) {
+          output[sizePosition] = static_cast<char>(size);
+        } else {
+          std::string sizeVarint;
+          BinaryWriter(sizeVarint).WriteVarint(size);
+          output.replace(sizePosition, 1, sizeVarint);
+        }
+      }
+    }
+  }
+
+  const std::vector<const std::string*>& GetStrings() const { return strings; }
+
+  void WriteVarint(std::uint64_t value) {
+    while (value >= 0x80) {
+      output.push_back(static_cast<char>((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+    output.push_back(static_cast<char>(value));
+  }
+
+ private:
+  static BinaryValueType GetBinaryValueType(const gd::SerializerValue& value) {
+    if (value.IsBoolean())
+      return value.GetBool() ? BinaryValueType::True : BinaryValueType::False;
+    else if (value.IsInt())
+      return BinaryValueType::Int;
+    else if (value.IsDouble())
+      return BinaryValueType::Double;
+    else if (value.IsString())
+      return BinaryValueType::String;
+
+    return BinaryValueType::Unknown;
+  }
+
+  void WriteValue(const gd::SerializerValue& value) {
+    if (value.IsBoolean()) return;
+
+    if (value.IsInt()) {
+      std::int64_t intValue = value.GetInt();
+      WriteVarint((static_cast<std::uint64_t>(intValue) << 1) ^
+                  static_cast<std::uint64_t>(intValue >> 63));
+    } else if (value.IsDouble()) {
+      double doubleValue = value.GetDouble();
+      std::uint64_t bits;
+      std::memcpy(&bits, &doubleValue, sizeof(bits));
+      for (std::size_t i = 0; i < 8; ++i)
+        output.push_back(static_cast<char>((bits >> (i * 8)) & 0xff));
+    } else if (value.IsString()) {
+      WriteString(value.GetRawString());
+    } else {
+      WriteString(value.GetString());
+    }
+  }
+
+  void WriteString(const gd::String& string) {
+    auto it = stringsIndexes.find(string.Raw());
+    if (it == stringsIndexes.end()) {
+      it = stringsIndexes.emplace(string.Raw(), strings.size()).first;
+      strings.push_back(&it->first);
+    }
+    WriteVarint(it->second);
+  }
+
+  std::string& output;
+  std::unordered_map<std::string, std::size_t> stringsIndexes;
+  std::vector<const std::string*> strings;  ///< The strings (stored in
+                                            ///< stringsIndexes), in the
+                                            ///< order of their indexes.
+  const gd::String emptyString;
+};
+
+/**
+ * \brief Read elements in the binary format, checking that the data is
+ * valid.
+ */
+class BinaryReader {
+ public:
+  BinaryReader(const char* data_, std::size_t size_)
+      : data(reinterpret_cast<const unsigned char*>(data_)),
+        position(0),
+        size(size_),
+        allocator(std::make_shared<SerializerElementArena>()){};
+
+  bool ReadHeaderAndStrings() {
+    if (!Serializer::IsBinary(reinterpret_cast<const char*>(data), size))
+      return false;
+    position = BINARY_HEADER_SIZE;
+
+    std::uint64_t stringsCount;
+    if (!ReadVarint(stringsCount) || stringsCount > size - position)
+      return false;
+
+    strings.resize(stringsCount);
+    for (auto& string : strings) {
+      std::uint64_t length;
+      if (!ReadVarint(length) || length > size - position) return false;
+
+      string.Raw().assign(reinterpret_cast<const char*>(data + position),
+                          length);
+      position += length;
+    }
+
+    return true;
+  }
+
+  bool ReadElement(gd::SerializerElement& element) {
+    if (position >= size) return false;
+    unsigned char typeAndFlags = data[position++];
+    if (typeAndFlags & BINARY_ARRAY_FLAG) element.ConsiderAsArray();
+
+    BinaryValueType type =
+        static_cast<BinaryValueType>(typeAndFlags & BINARY_VALUE_TYPE_MASK);
+    if (type != BinaryValueType::Undefined &&
+        !ReadValue(type, element, nullptr))
+      return false;
+
+    if (typeAndFlags & BINARY_ATTRIBUTES_FLAG) {
+      std::uint64_t attributesCount;
+      if (!ReadVarint(attributesCount)) return false;
+      for (std::uint64_t i = 0; i < attributesCount; ++i) {
+        const gd::String* name;
+        if (!ReadString(name) || position >= size) return false;
+
+        type = static_cast<BinaryValueType>(data[position++]);
+        if (!ReadValue(type, element, name)) return false;
+      }
+    }
+
+    if (typeAndFlags & BINARY_CHILDREN_FLAG) {
+      std::uint64_t childrenCount;
+      if (!ReadVarint(childrenCount)) return false;
+      for (std::uint64_t i = 0; i < childrenCount; ++i) {
+        const gd::String* name;
+        std::uint64_t childSize;
+        if (!ReadString(name) || !ReadVarint(childSize) ||
+            childSize > size - position)
+          return false;
+
+        std::size_t childEnd = position + childSize;
+        gd::SerializerElement& child = element.AddChild(*name, allocator);
+        if (!ReadElement(child) || position != childEnd) return false;
+      }
+    }
+
+    return true;
+  }
+
+ private:
+  bool ReadVarint(std::uint64_t& value) {
+    value = 0;
+    for (std::size_t shift = 0; shift < 64 && position < size; shift += 7) {
+      unsigned char byte = data[position++];
+      value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) return true;
+    }
+
+    return false;
+  }
+
+  bool ReadString(const gd::String*& string) {
+    std::uint64_t index;
+    if (!ReadVarint(index) || index >= strings.size()) return false;
+
+    string = &strings[index];
+    return true;
+  }
+
+  /**
+   * \brief Read a value and set it as the value of the element, or as an
+   * attribute if \a attributeName is not null.
+   */
+  bool ReadValue(BinaryValueType type,
+                 gd::SerializerElement& element,
+                 const gd::String* attributeName) {
+    if (type == BinaryValueType::False || type == BinaryValueType::True) {
+      bool boolValue = type == BinaryValueType::True;
+      if (attributeName)
+        element.SetAttribute(*attributeName, boolValue);
+      else
+        element.SetBoolValue(boolValue);
+    } else if (type == BinaryValueType::Int) {
+      std::uint64_t zigzag;
+      if (!ReadVarint(zigzag)) return false;
+      int intValue = static_cast<int>(static_cast<std::int64_t>(zigzag >> 1) ^
+                                      -static_cast<std::int64_t>(zigzag & 1));
+      if (attributeName)
+        element.SetAttribute(*attributeName, intValue);
+      else
+        element.SetIntValue(intValue);
+    } else if (type == BinaryValueType::Double) {
+      if (size - position < 8) return false;
+      std::uint64_t bits = 0;
+      for (std::size_t i = 0; i < 8; ++i)
+        bits |= static_cast<std::uint64_t>(data[position++]) << (i * 8);
+      double doubleValue;
+      std::memcpy(&doubleValue, &bits, sizeof(doubleValue));
+      if (attributeName)
+        element.SetAttribute(*attributeName, doubleValue);
+      else
+        element.SetDoubleValue(doubleValue);
+    } else if (type == BinaryValueType::String ||
+               type == BinaryValueType::Unknown) {
+      const gd::String* string;
+      if (!ReadString(string)) return false;
+      if (attributeName) {
+        element.SetAttribute(*attributeName, *string);
+      } else if (type == BinaryValueType::String) {
+        element.SetStringValue(*string);
+      } else {
+        gd::SerializerValue value;
+        value.Set(*string);
+        element.SetValue(value);
+      }
+    } else {
+      return false;
+    }
+
+    return true;
+  }
+
+  const unsigned char* data;
+  std::size_t position;
+  std::size_t size;
+  std::vector<gd::String> strings;
+  SerializerElementArenaAllocator<gd::SerializerElement> allocator;
+};
+
+#if !defined(EMSCRIPTEN)
+/**
+ * \brief A file mapped in memory (read only).
+ */
+class MappedFile {
+ public:
+  MappedFile(const gd::String& filename) : data(nullptr), size(0) {
+#if defined(WINDOWS)
+    HANDLE file = CreateFileW(filename.ToWide().c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              NULL,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              NULL);
+    if (file == INVALID_HANDLE_VALUE) return;
+
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+      HANDLE mapping =
+          CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+      if (mapping) {
+        data = static_cast<const char*>(
+            MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (data) size = fileSize.QuadPart;
+        CloseHandle(mapping);
+      }
+    }
+    CloseHandle(file);
+#else
+    int file = open(filename.ToLocale().c_str(), O_RDONLY);
+    if (file == -1) return;
+
+    struct stat fileStat;
+    if (fstat(file, &fileStat) == 0 && fileStat.st_size > 0) {
+      void* mapping =
+          mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+      if (mapping != MAP_FAILED) {
+        data = static_cast<const char*>(mapping);
+        size = fileStat.st_size;
+      }
+    }
+    close(file);
+#endif
+  }
+
+  ~MappedFile() {
+    if (!data) return;
+#if defined(WINDOWS)
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<char*>(data), size);
+#endif
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const char* GetData() const { return data; }
+  std::size_t GetSize() const { return size; }
+
+ private:
+  const char* data;  ///< The content of the file, or nullptr if the file
+                     ///< could not be mapped (or is empty).
+  std::size_t size;
+};
+#endif
+}  // namespace
+
+SerializerElement Serializer::FromJSON(const char* json) {
+  StringStream stream(json);
+  return ParseJSON(stream);
+}
+
 gd::String Serializer::ToJSON(const SerializerElement& element) {
-  Document document;
-  Document::AllocatorType& allocator = document.GetAllocator();
+  gd::String json;
+  ToJSON(element, json);
+
+  return json;
+}
+
+void Serializer::ToJSON(const SerializerElement& element, gd::String& output) {
+  // Write directly in the output string, without building a
+  // rapidjson::Document or an intermediate buffer.
+  StringOutputStream stream(output.Raw());
+  Writer<StringOutputStream> writer(stream);
+  WriteElement(element, writer);
+}
+
+void Serializer::ToBinary(const SerializerElement& element,
+                          std::string& output) {
+  // Write the elements first, to know the strings to put in the table.
+  std::string elements;
+  BinaryWriter elementsWriter(elements);
+  elementsWriter.WriteElement(element);
+
+  output.append(BINARY_HEADER, BINARY_HEADER_SIZE);
+  BinaryWriter writer(output);
+  const auto& strings = elementsWriter.GetStrings();
+  writer.WriteVarint(strings.size());
+  for (const std::string* string : strings) {
+    writer.WriteVarint(string->size());
+    output += *string;
+  }
+  output += elements;
+}
 
-  ElementToRapidJson(element, document, allocator);
+std::string Serializer::ToBinary(const SerializerElement& element) {
+  std::string output;
+  ToBinary(element, output);
 
-  StringBuffer buffer;
-  Writer<StringBuffer> writer(buffer);
-  document.Accept(writer);
+  return output;
+}
+
+bool Serializer::IsBinary(const char* data, std::size_t size) {
+  return size >= BINARY_HEADER_SIZE &&
+         std::memcmp(data, BINARY_HEADER, BINARY_HEADER_SIZE) == 0;
+}
 
-  return buffer.GetString();  // Temporary copy
+SerializerElement Serializer::FromBinary(const char* data, std::size_t size) {
+  SerializerElement element;
+  BinaryReader reader(data, size);
+  if (!reader.ReadHeaderAndStrings() || !reader.ReadElement(element)) {
+    std::cout << "Invalid binary data, unable to read it." << std::endl;
+    element = SerializerElement();
+  }
+
+  return element;
 }
 
+SerializerElement Serializer::FromBinaryOrJSON(const char* data,
+                                               std::size_t size) {
+  if (IsBinary(data, size)) return FromBinary(data, size);
+
+  MemoryStream stream(data, size);
+  return ParseJSON(stream);
+}
+
+#if !defined(EMSCRIPTEN)
+SerializerElement Serializer::FromFile(const gd::String& filename) {
+  MappedFile file(filename);
+  if (!file.GetData()) return SerializerElement();
+
+  return FromBinaryOrJSON(file.GetData(), file.GetSize());
+}
+#endif
+
 }  // namespace gd
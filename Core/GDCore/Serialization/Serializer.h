@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_SERIALIZER_H
 #define GDCORE_SERIALIZER_H
+#include <cstddef>
 #include <string>
 #include "GDCore/Serialization/SerializerElement.h"
 class TiXmlElement;
@@ -14,7 +15,7 @@ namespace gd {
 
 /**
  * \brief The class used to save/load projects and GDCore classes
- * from/to XML or JSON.
+ * from/to XML, JSON or a binary format.
  */
 class GD_CORE_API Serializer {
  public:
@@ -44,6 +45,15 @@ class GD_CORE_API Serializer {
    */
   static gd::String ToJSON(const SerializerElement& element);
 
+  /**
+   * \brief Serialize a gd::SerializerElement to JSON, appending it at the end
+   * of the given string.
+   *
+   * This avoids copying the JSON when it must be written after some other
+   * content, and allows to reuse the same string (and its allocated memory).
+   */
+  static void ToJSON(const SerializerElement& element, gd::String& output);
+
   /**
    * \brief Construct a gd::SerializerElement from a JSON string.
    */
@@ -57,6 +67,62 @@ class GD_CORE_API Serializer {
   }
   ///@}
 
+  /** \name Binary serialization.
+   * Convert a gd::SerializerElement from/to a compact binary format, faster to
+   * write and read than JSON and keeping the exact types of values. It's meant
+   * for snapshots (like autosaves) read by the same version of GDevelop, JSON
+   * staying the format of project files.
+   *
+   * Names and string values are stored once in a table of strings, numbers
+   * are stored as varints and children are prefixed by their size, so that
+   * they can be skipped.
+   */
+  ///@{
+  /**
+   * \brief Serialize a gd::SerializerElement to the binary format, appending
+   * it at the end of the given string.
+   */
+  static void ToBinary(const SerializerElement& element, std::string& output);
+
+  /**
+   * \brief Serialize a gd::SerializerElement to the binary format.
+   */
+  static std::string ToBinary(const SerializerElement& element);
+
+  /**
+   * \brief Construct a gd::SerializerElement from data in the binary format.
+   *
+   * An empty element is returned if the data is invalid.
+   */
+  static SerializerElement FromBinary(const char* data, std::size_t size);
+
+  /**
+   * \brief Return true if the data starts with the header of the binary
+   * format.
+   */
+  static bool IsBinary(const char* data, std::size_t size);
+  ///@}
+
+  /**
+   * \brief Construct a gd::SerializerElement from data in the binary format
+   * or in JSON, detecting the format of the data.
+   *
+   * In JavaScript, use gd.Serializer.fromBinaryOrJSON, which copies the data
+   * of a Uint8Array in the Emscripten heap (and gd.Serializer.toBinary to get
+   * the binary format as a Uint8Array).
+   */
+  static SerializerElement FromBinaryOrJSON(const char* data, std::size_t size);
+
+#if !defined(EMSCRIPTEN)
+  /**
+   * \brief Construct a gd::SerializerElement from a file in the binary format
+   * or in JSON. The file is mapped in memory instead of being copied.
+   *
+   * An empty element is returned if the file can't be read.
+   */
+  static SerializerElement FromFile(const gd::String& filename);
+#endif
+
   virtual ~Serializer(){};
 
  private:
@@ -5,11 +5,16 @@
 namespace gd {
 
 SerializerElement SerializerElement::nullElement;
+constexpr std::size_t SerializerElement::CHILDREN_INDEX_THRESHOLD;
 
-SerializerElement::SerializerElement() : valueUndefined(true), isArray(false) {}
+SerializerElement::SerializerElement()
+    : valueUndefined(true), isArray(false), childrenHaveSameName(true) {}
 
 SerializerElement::SerializerElement(const SerializerValue& value)
-    : valueUndefined(false), elementValue(value), isArray(false) {}
+    : valueUndefined(false),
+      elementValue(value),
+      isArray(false),
+      childrenHaveSameName(true) {}
 
 SerializerElement::~SerializerElement() {}
 
@@ -140,6 +145,67 @@ bool SerializerElement::HasAttribute(const gd::String& name) const {
 }
 
 SerializerElement& SerializerElement::AddChild(gd::String name) {
+  SerializerElement* existingChild = PrepareChildAddition(name);
+  if (existingChild) return *existingChild;
+
+  return AddNewChild(name, std::make_shared<SerializerElement>());
+}
+
+SerializerElement& SerializerElement::AddNewChild(
+    const gd::String& name, std::shared_ptr<SerializerElement> child) {
+  childrenHaveSameName =
+      children.empty() || (childrenHaveSameName && children[0].first == name);
+  children.push_back(std::make_pair(name, std::move(child)));
+
+  if (children.size() == CHILDREN_INDEX_THRESHOLD)
+    UpdateChildrenIndex();
+  else if (children.size() > CHILDREN_INDEX_THRESHOLD)
+    childrenIndex.emplace(name, children.size() - 1);
+
+  return *children.back().second;
+}
+
+void SerializerElement::UpdateChildrenIndex() {
+  childrenIndex.clear();
+  childrenHaveSameName = true;
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    if (children[i].first != children[0].first) childrenHaveSameName = false;
+  }
+
+  if (children.size() < CHILDREN_INDEX_THRESHOLD) return;
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    childrenIndex.emplace(children[i].first, i);
+  }
+}
+
+std::size_t SerializerElement::FindChildPosition(
+    const gd::String& name, const gd::String& deprecatedName) const {
+  if (!childrenIndex.empty()) {
+    auto it = childrenIndex.find(name);
+    std::size_t position = it != childrenIndex.end() ? it->second
+                                                     : children.size();
+    if (!deprecatedName.empty()) {
+      auto deprecatedIt = childrenIndex.find(deprecatedName);
+      if (deprecatedIt != childrenIndex.end() &&
+          deprecatedIt->second < position)
+        position = deprecatedIt->second;
+    }
+
+    return position;
+  }
+
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+    if (children[i].first == name ||
+        (!deprecatedName.empty() && children[i].first == deprecatedName))
+      return i;
+  }
+
+  return children.size();
+}
+
+SerializerElement* SerializerElement::PrepareChildAddition(gd::String& name) {
   if (isArray) {
     if (name != arrayOf) {
       std::cout << "WARNING: Adding a child, to a SerializerElement which is "
@@ -152,17 +218,12 @@ SerializerElement& SerializerElement::AddChild(gd::String name) {
 
   // In case of children of objects, there can be only one child with
   // a given name.
-  // Note: searching for the existing children is O(number of children). This
-  // could be improved, but in practice has no visible impact on saving
-  // large projects.
-  if (!isArray && HasChild(name)) {
-    return GetChild(name);
+  if (!isArray) {
+    std::size_t position = FindChildPosition(name, "");
+    if (position < children.size()) return children[position].second.get();
   }
 
-  std::shared_ptr<SerializerElement> newElement(new SerializerElement);
-  children.push_back(std::make_pair(name, newElement));
-
-  return *newElement;
+  return nullptr;
 }
 
 SerializerElement& SerializerElement::GetChild(std::size_t index) const {
@@ -173,17 +234,23 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
     return nullElement;
   }
 
-  std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == arrayOf || children[i].first.empty() ||
-        (!deprecatedArrayOf.empty() &&
-         children[i].first == deprecatedArrayOf)) {
-      if (index == currentIndex)
-        return *children[i].second;
-      else
-        currentIndex++;
+  if (childrenHaveSameName && !children.empty() &&
+      IsMatchingChildName(children[0].first, arrayOf, deprecatedArrayOf)) {
+    // All the children are elements of the array: access them directly.
+    if (index < children.size()) return *children[index].second;
+  } else {
+    std::size_t currentIndex = 0;
+    for (size_t i = 0; i < children.size(); ++i) {
+      if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+      if (children[i].first == arrayOf || children[i].first.empty() ||
+          (!deprecatedArrayOf.empty() &&
+           children[i].first == deprecatedArrayOf)) {
+        if (index == currentIndex)
+          return *children[i].second;
+        else
+          currentIndex++;
+      }
     }
   }
 
@@ -204,16 +271,24 @@ SerializerElement& SerializerElement::GetChild(
     }
   }
 
-  std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == name || (isArray && children[i].first.empty()) ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName)) {
-      if (index == currentIndex)
-        return *children[i].second;
-      else
-        currentIndex++;
+  if (!isArray && index == 0) {
+    std::size_t position = FindChildPosition(name, deprecatedName);
+    if (position < children.size()) return *children[position].second;
+  } else if (childrenHaveSameName && !children.empty()) {
+    if (index < children.size() &&
+        IsMatchingChildName(children[0].first, name, deprecatedName))
+      return *children[index].second;
+  } else {
+    std::size_t currentIndex = 0;
+    for (size_t i = 0; i < children.size(); ++i) {
+      if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+      if (IsMatchingChildName(children[i].first, name, deprecatedName)) {
+        if (index == currentIndex)
+          return *children[i].second;
+        else
+          currentIndex++;
+      }
     }
   }
 
@@ -237,12 +312,18 @@ std::size_t SerializerElement::GetChildrenCount(
     deprecatedName = deprecatedArrayOf;
   }
 
+  if (childrenHaveSameName) {
+    return !children.empty() &&
+                   IsMatchingChildName(children[0].first, name, deprecatedName)
+               ? children.size()
+               : 0;
+  }
+
   std::size_t currentIndex = 0;
   for (size_t i = 0; i < children.size(); ++i) {
     if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
 
-    if (children[i].first == name || (isArray && children[i].first.empty()) ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName))
+    if (IsMatchingChildName(children[i].first, name, deprecatedName))
       currentIndex++;
   }
 
@@ -251,24 +332,19 @@ std::size_t SerializerElement::GetChildrenCount(
 
 bool SerializerElement::HasChild(const gd::String& name,
                                  gd::String deprecatedName) const {
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == name ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName))
-      return true;
-  }
-
-  return false;
+  return FindChildPosition(name, deprecatedName) < children.size();
 }
 
 void SerializerElement::RemoveChild(const gd::String& name) {
+  if (FindChildPosition(name, "") == children.size()) return;
+
   for (size_t i = 0; i < children.size();) {
     if (children[i].first == name)
       children.erase(children.begin() + i);
     else
       ++i;
   }
+  UpdateChildrenIndex();
 }
 
 void SerializerElement::Init(const gd::SerializerElement& other) {
@@ -283,6 +359,7 @@ void SerializerElement::Init(const gd::SerializerElement& other) {
                        std::shared_ptr<SerializerElement>(
                            new SerializerElement(*child.second))));
   }
+  UpdateChildrenIndex();
 
   isArray = other.isArray;
   arrayOf = other.arrayOf;
@@ -297,6 +374,7 @@ void SerializerElement::SetMultilineStringValue(const gd::String& value) {
 
   std::vector<gd::String> lines = value.Split('\n');
   children.clear();
+  UpdateChildrenIndex();
   ConsiderAsArrayOf("");
   for (const auto& line : lines) {
     AddChild("").SetStringValue(line);
@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/Serialization/SerializerValue.h"
@@ -28,9 +29,12 @@ namespace gd {
  * It also has specialized methods in GDevelop.js (see postjs.js) to be
  * converted to a JavaScript object.
  *
- * \note Children are stored with their order preserved, but this also
- * means that their access/removal is O(number of children). This class
- * is not appropriated for a use in game where fast access is required.
+ * \note Children are stored with their order preserved. Elements with a lot
+ * of children also maintain an index of their children names, so that
+ * accessing a child by its name is O(1) (and accessing the children of an
+ * array by their index too, if all children have the same name). Removal is
+ * still O(number of children). This class is not appropriated for a use in
+ * game where fast access is required.
  *
  * \see gd::Serializer
  */
@@ -391,6 +395,27 @@ class GD_CORE_API SerializerElement {
    */
   SerializerElement &AddChild(gd::String name);
 
+  /**
+   * \brief Add a child at the end of the children list with the given name and
+   * return a reference to it. The child is allocated using the given
+   * allocator.
+   *
+   * This is used to allocate all the elements of a loaded file in the same
+   * memory arena (see gd::Serializer::FromJSON).
+   *
+   * \param name The name of the new child.
+   * \param allocator The allocator used to create the child, with
+   * std::allocate_shared.
+   */
+  template <class Allocator>
+  SerializerElement &AddChild(gd::String name, const Allocator &allocator) {
+    SerializerElement *existingChild = PrepareChildAddition(name);
+    if (existingChild) return *existingChild;
+
+    return AddNewChild(name,
+                       std::allocate_shared<SerializerElement>(allocator));
+  }
+
   /**
    * \brief Get a child of the element using its name.
    *
@@ -425,7 +450,9 @@ class GD_CORE_API SerializerElement {
 
   /**
    * \brief Return true if the specified child exists.
-   * \note Complexity is O(number of children).
+   * \note Complexity is O(1) for elements with a lot of children (see
+   * SerializerElement::CHILDREN_INDEX_THRESHOLD), O(number of children)
+   * otherwise.
    * \param name The name of the child to find.
    */
   bool HasChild(const gd::String &name, gd::String deprecatedName = "") const;
@@ -448,6 +475,12 @@ class GD_CORE_API SerializerElement {
 
   static SerializerElement nullElement;
 
+  /**
+   * \brief The number of children from which an index of the children names
+   * is maintained.
+   */
+  static constexpr std::size_t CHILDREN_INDEX_THRESHOLD = 16;
+
  private:
   /**
    * Initialize element using another element. Used by copy-ctor and assign-op.
@@ -455,6 +488,45 @@ class GD_CORE_API SerializerElement {
    */
   void Init(const gd::SerializerElement &other);
 
+  /**
+   * Called before adding a child: rename the child if the element is an array
+   * and return the existing child if there is already one with this name
+   * (for elements that are not arrays). Return nullptr otherwise.
+   */
+  SerializerElement *PrepareChildAddition(gd::String &name);
+
+  /**
+   * Add the child at the end of the children, updating the index of the
+   * children names.
+   */
+  SerializerElement &AddNewChild(const gd::String &name,
+                                 std::shared_ptr<SerializerElement> child);
+
+  /**
+   * Rebuild the index of the children names, after children were removed or
+   * replaced.
+   */
+  void UpdateChildrenIndex();
+
+  /**
+   * Return the position of the first child having one of the given names, or
+   * children.size() if not found. Only to be used if the element is not an
+   * array.
+   */
+  std::size_t FindChildPosition(const gd::String &name,
+                                const gd::String &deprecatedName) const;
+
+  /**
+   * Return true if a child with the given name would be considered as one of
+   * the children with the given name, or an element of the array.
+   */
+  bool IsMatchingChildName(const gd::String &childName,
+                           const gd::String &name,
+                           const gd::String &deprecatedName) const {
+    return childName == name || (isArray && childName.empty()) ||
+           (!deprecatedName.empty() && childName == deprecatedName);
+  }
+
   bool valueUndefined;  ///< If true, the element does not have a value.
   SerializerValue elementValue;
 
@@ -465,6 +537,14 @@ class GD_CORE_API SerializerElement {
   mutable gd::String arrayOf;  ///< The name of the children (was useful for XML
                                ///< parsed elements).
   mutable gd::String deprecatedArrayOf;  ///< Alternate name for children
+
+  std::unordered_map<gd::String, std::size_t>
+      childrenIndex;  ///< The position of the first child with a given name,
+                      ///< only filled when there are more than
+                      ///< CHILDREN_INDEX_THRESHOLD children.
+  bool childrenHaveSameName;  ///< true if all children have the same name
+                              ///< (so that an array can be accessed by index
+                              ///< in O(1)).
 };
 
 }  // namespace gd
@@ -63,6 +63,31 @@ String::size_type String::size() const
     return std::distance(begin(), end());
 }
 
+std::string::size_type String::GetByteOffset( String::size_type position ) const
+{
+    std::string::const_iterator it = m_string.begin();
+    while(position > 0 && it != m_string.end())
+    {
+        ::utf8::unchecked::next(it);
+        --position;
+    }
+    if(position > 0) //We reach the end of the string before the position
+        return std::string::npos;
+
+    return std::distance(m_string.begin(), it);
+}
+
+std::string::size_type String::GetByteOffsetOrEnd( String::size_type position ) const
+{
+    std::string::size_type byteOffset = GetByteOffset(position);
+    return byteOffset == std::string::npos ? m_string.size() : byteOffset;
+}
+
+String::size_type String::GetPosition( std::string::size_type byteOffset ) const
+{
+    return std::distance(begin(), const_iterator(m_string.begin() + byteOffset));
+}
+
 String::iterator String::begin()
 {
     return String::iterator(m_string.begin());
@@ -195,8 +220,7 @@ String& String::ReplaceInvalid( value_type replacement )
 
 String::value_type String::operator[]( const String::size_type position ) const
 {
-    const_iterator it = begin();
-    std::advance(it, position);
+    const_iterator it( m_string.begin() + GetByteOffset(position) );
     return *it;
 }
 
@@ -230,11 +254,12 @@ void String::pop_back()
 
 String& String::insert( size_type pos, const String &str )
 {
-    iterator it = begin();
-    std::advance(it, pos);
+    //Use the real position as bytes
+    std::string::size_type byteOffset = GetByteOffset(pos);
+    if(byteOffset == std::string::npos)
+        throw std::out_of_range("[gd::String::insert] pos greater than size");
 
-    //Use the real position as bytes using the std::string::iterators
-    m_string.insert( std::distance(m_string.begin(), it.base()), str.m_string );
+    m_string.insert( byteOffset, str.m_string );
 
     return *this;
 }
@@ -289,40 +314,40 @@ String& String::replace( iterator i1, iterator i2, size_type n, const char c )
     return *this;
 }
 
+namespace priv
+{
+    /**
+     * \return the position of the character after the "len" characters
+     * starting at "pos", without overflowing if "len" is npos.
+     */
+    String::size_type GetEndPosition( String::size_type pos, String::size_type len )
+    {
+        return len > String::npos - pos ? String::npos : pos + len;
+    }
+}
+
 String& String::replace( String::size_type pos, String::size_type len, const char c )
 {
-    if(pos > size())
+    std::string::size_type startOffset = GetByteOffset(pos);
+    if(startOffset == std::string::npos)
         throw std::out_of_range("[gd::String::replace] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance( i1, pos );
-
-    iterator i2 = i1;
-    while(i2 != end() && len > 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        --len;
-    }
+    std::string::size_type endOffset = GetByteOffsetOrEnd(priv::GetEndPosition(pos, len));
+    m_string.replace(startOffset, endOffset - startOffset, 1, c);
 
-    return replace( i1, i2, 1, c );
+    return *this;
 }
 
 String& String::replace( String::size_type pos, String::size_type len, const String &str )
 {
-    if(pos > size())
+    std::string::size_type startOffset = GetByteOffset(pos);
+    if(startOffset == std::string::npos)
         throw std::out_of_range("[gd::String::replace] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance( i1, pos );
+    std::string::size_type endOffset = GetByteOffsetOrEnd(priv::GetEndPosition(pos, len));
+    m_string.replace(startOffset, endOffset - startOffset, str.m_string);
 
-    iterator i2 = i1;
-    while(i2 != end() && len > 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        --len;
-    }
-
-    return replace( i1, i2, str );
+    return *this;
 }
 
 String::iterator String::erase( String::iterator first, String::iterator last )
@@ -337,20 +362,12 @@ String::iterator String::erase( String::iterator p )
 
 void String::erase( String::size_type pos, String::size_type len )
 {
-    if(pos > size())
+    std::string::size_type startOffset = GetByteOffset(pos);
+    if(startOffset == std::string::npos)
         throw std::out_of_range("[gd::String::erase] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance(i1, pos);
-
-    iterator i2 = i1;
-    while(i2 != end() && len != 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        len--;
-    }
-
-    erase( i1, i2 );
+    std::string::size_type endOffset = GetByteOffsetOrEnd(priv::GetEndPosition(pos, len));
+    m_string.erase(startOffset, endOffset - startOffset);
 }
 
 std::vector<String> String::Split( String::value_type delimiter ) const
@@ -405,19 +422,22 @@ String String::LowerCase() const
 
 String String::FindAndReplace(String search, String replacement, bool all) const
 {
-    gd::String result(*this);
+    //As UTF8 is self-synchronizing, an UTF8 encoded string can be searched
+    //(and replaced) directly in the bytes, without computing any position.
+    gd::String result;
+    result.m_string.reserve(m_string.size());
 
-    size_type pos, lastPos = 0;
-    do {
-        pos = result.find(search, lastPos);
-        lastPos = pos;
-        if (pos != npos)
-        {
-            result.replace(pos, search.size(), replacement);
-            lastPos += replacement.size();
-        }
+    std::string::size_type pos, lastPos = 0;
+    while((pos = m_string.find(search.m_string, lastPos)) != std::string::npos)
+    {
+        result.m_string.append(m_string, lastPos, pos - lastPos);
+        result.m_string += replacement.m_string;
+        lastPos = pos + search.m_string.size();
 
-    } while(lastPos != npos && all);
+        //An empty search string is only replaced once (at the beginning)
+        if(!all || search.empty()) break;
+    }
+    result.m_string.append(m_string, lastPos, std::string::npos);
 
     return result;
 }
@@ -446,50 +466,31 @@ String String::substr( String::size_type start, String::size_type length ) const
 {
     String str;
 
-    const_iterator startIt = begin();
-    while(start > 0 && startIt != end())
-    {
-        ++startIt;
-        --start;
-    }
-    if(start > 0) //We reach the end of the string before the start position
+    std::string::size_type startOffset = GetByteOffset(start);
+    if(startOffset == std::string::npos) //We reach the end of the string before the start position
         throw std::out_of_range("[gd::String::substr] starting pos greater than size");
 
-    const_iterator endIt = startIt;
-    while(length > 0 && endIt != end())
-    {
-        ++endIt;
-        --length;
-    }
+    std::string::size_type endOffset = GetByteOffsetOrEnd(priv::GetEndPosition(start, length));
 
-    str.m_string = std::string( startIt.base(), endIt.base() );
+    str.m_string = m_string.substr( startOffset, endOffset - startOffset );
 
     return str;
 }
 
 String::size_type String::find( const String &search, String::size_type pos ) const
 {
-    const_iterator it = begin();
-
-    //Move to pos
-    if(pos < size())
-        std::advance( it, pos );
-    else
+    //Get the starting position as a **byte** offset
+    std::string::size_type startOffset = GetByteOffset(pos);
+    if(startOffset == std::string::npos || startOffset == m_string.size())
         return npos;
 
     //Use the standard std::string to find a string (using their internal std::strings).
-    //Use the raw std::string iterator to get the offset as a **byte** count for the starting
-    //position.
-    std::string::size_type findPos =
-        m_string.find( search.m_string, std::distance( m_string.begin(), it.base() ) );
+    std::string::size_type findPos = m_string.find( search.m_string, startOffset );
 
     if( findPos != std::string::npos )
     {
-        //Create a String::iterator from the std::string::iterator pointing to the find result.
-        const_iterator findPosIt( m_string.begin() + findPos );
-
-        //Return the distance in **characters** count (that's why we need a String::iterator).
-        return std::distance( begin(), findPosIt );
+        //Return the position in **characters** count.
+        return GetPosition( findPos );
     }
     else
         return npos;
@@ -507,32 +508,21 @@ String::size_type String::find( const String::value_type search, String::size_ty
 
 String::size_type String::rfind( const String &search, String::size_type pos ) const
 {
-    //Move to pos + 1 (we will then get the last byte of the character at pos)
-    const_iterator it = begin();
-    std::string::const_iterator baseIt;
-    if( pos < size() ) //little optimization by testing npos directly (avoid calculating size())
-    {
-        std::advance( it, pos + 1 );
-        baseIt = it.base();
-        --baseIt; //Decrement the std::string::iterator by one because we need
-        //it to point to the last byte of the character at pos
-    }
+    //Get the offset of the character after pos (we will then get the last byte of
+    //the character at pos). It's npos if pos is not a character of the string.
+    std::string::size_type nextOffset =
+        pos != npos ? GetByteOffset( pos + 1 ) : std::string::npos;
 
     //The last character is included, so we need to put the position
     //of the last byte of the character at the position "pos"
     std::string::size_type findPos = m_string.rfind( search.m_string,
-        pos < size() ? std::distance( m_string.begin(), baseIt ) : std::string::npos
+        nextOffset != std::string::npos ? nextOffset - 1 : std::string::npos
         );
 
     if( findPos != std::string::npos )
     {
-        //Create a String::iterator to the find position to be able to get the real
-        //distance as characters count (it would be a distance as bytes count
-        //with a std::string::iterator)
-        const_iterator findPosIt( m_string.begin() + findPos );
-
-        //Return the distance (which is a distance as characters count)
-        return std::distance( begin(), findPosIt );
+        //Return the position as characters count (not as bytes count)
+        return GetPosition( findPos );
     }
     else
         return npos;
@@ -559,11 +549,11 @@ namespace priv
         else
             return String::npos;
 
-        for( ; it != str.end(); ++it )
+        for( String::size_type pos = startPos; it != str.end(); ++it, ++pos )
         {
             //Search the current char in the match string
             if( ( std::find( match.begin(), match.end(), (*it) ) != match.end() ) != not_of )
-                return std::distance( str.begin(), it );
+                return pos;
         }
 
         return String::npos;
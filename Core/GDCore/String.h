@@ -527,6 +527,7 @@ public:
      * \param search The string that will be replaced by the new string.
      * \param replacement The value to replace the old substring with.
      * \param all If set to false, only the first matching substring will be replaced.
+     * \note An empty search string is only replaced once, at the beginning of the string.
      */
     String FindAndReplace(String search, String replacement, bool all = true) const;
 
@@ -670,6 +671,24 @@ public:
  */
 
 private:
+    /**
+     * \return the offset (in bytes) of the character at **position**, or
+     * std::string::npos if **position** is greater than the size of the string.
+     */
+    std::string::size_type GetByteOffset( size_type position ) const;
+
+    /**
+     * \return the offset (in bytes) of the character at **position**, or
+     * the size (in bytes) of the string if **position** is greater than the
+     * size of the string.
+     */
+    std::string::size_type GetByteOffsetOrEnd( size_type position ) const;
+
+    /**
+     * \return the position of the character starting at **byteOffset**.
+     */
+    size_type GetPosition( std::string::size_type byteOffset ) const;
+
     std::string m_string; ///< Internal std::string container
 
 };
@@ -0,0 +1,96 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_COPYONWRITE_H
+#define GDCORE_COPYONWRITE_H
+#include <memory>
+
+namespace gd {
+
+/**
+ * \brief Hold a value that can be shared with another holder until it is
+ * modified.
+ *
+ * Copying a holder copies the value, like for a plain member. Only ShareWith
+ * makes a holder share the value of another one: this other holder is never
+ * changed, and the holder sharing its value copies it the first time it is
+ * accessed for modification (see GetMutable).
+ *
+ * This is used to make snapshots of a project without copying its biggest
+ * parts (see gd::Project::InitAsSnapshotOf). References to the value of the
+ * original holder stay valid, but modifications done to it are seen by the
+ * holders sharing it: a snapshot must not be used while the original project
+ * is modified.
+ *
+ * \ingroup Tools
+ */
+template <class T>
+class CopyOnWrite {
+ public:
+  CopyOnWrite() : value(std::make_shared<T>()), isShared(false){};
+  CopyOnWrite(const CopyOnWrite<T>& other)
+      : value(std::make_shared<T>(other.Get())), isShared(false){};
+  CopyOnWrite<T>& operator=(const CopyOnWrite<T>& other) {
+    if (this == &other) return *this;
+
+    if (isShared) {
+      value = std::make_shared<T>(other.Get());
+      isShared = false;
+    } else {
+      *value = other.Get();
+    }
+    return *this;
+  };
+
+  /**
+   * \brief Share the value of \a other, until GetMutable is called.
+   */
+  void ShareWith(const CopyOnWrite<T>& other) {
+    value = other.value;
+    isShared = true;
+  };
+
+  /**
+   * \brief Return true if the value is shared with another holder.
+   */
+  bool IsShared() const { return isShared; };
+
+  /**
+   * \brief Return the value, for reading only.
+   */
+  const T& Get() const { return *value; };
+
+  /**
+   * \brief Return the value, copying it first if it is shared.
+   */
+  T& GetMutable() {
+    if (isShared) {
+      value = std::make_shared<T>(*value);
+      isShared = false;
+    }
+    return *value;
+  };
+
+  /**
+   * \brief Replace the value by a default one, without copying it if it is
+   * shared.
+   */
+  void Reset() {
+    if (isShared) {
+      value = std::make_shared<T>();
+      isShared = false;
+    } else {
+      *value = T();
+    }
+  };
+
+ private:
+  std::shared_ptr<T> value;
+  bool isShared;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_COPYONWRITE_H
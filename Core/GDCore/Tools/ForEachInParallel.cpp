@@ -0,0 +1,40 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/ForEachInParallel.h"
+
+#include <algorithm>
+#include <vector>
+#if !defined(EMSCRIPTEN)
+#include <atomic>
+#include <thread>
+#endif
+
+namespace gd {
+
+void ForEachInParallel(std::size_t count,
+                       std::size_t threadsCount,
+                       const std::function<void(std::size_t)> &function) {
+#if !defined(EMSCRIPTEN)
+  if (threadsCount == 0) threadsCount = std::thread::hardware_concurrency();
+  threadsCount = std::min(threadsCount, count);
+  if (threadsCount > 1) {
+    std::atomic<std::size_t> nextIndex(0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < threadsCount; ++t) {
+      threads.emplace_back([&]() {
+        for (std::size_t i = nextIndex++; i < count; i = nextIndex++)
+          function(i);
+      });
+    }
+    for (auto &thread : threads) thread.join();
+    return;
+  }
+#endif
+
+  for (std::size_t i = 0; i < count; ++i) function(i);
+}
+
+}  // namespace gd
@@ -0,0 +1,30 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_FOREACHINPARALLEL_H
+#define GDCORE_FOREACHINPARALLEL_H
+#include <cstddef>
+#include <functional>
+
+namespace gd {
+
+/**
+ * \brief Run \a function for each index in [0, count), using up to
+ * \a threadsCount threads (0 for one per hardware thread).
+ *
+ * Indexes are given to the threads in increasing order, as soon as a thread
+ * is available. When compiled with Emscripten, or if only one thread is used,
+ * \a function is called in order on the calling thread.
+ *
+ * \ingroup Tools
+ */
+void GD_CORE_API ForEachInParallel(
+    std::size_t count,
+    std::size_t threadsCount,
+    const std::function<void(std::size_t)> &function);
+
+}  // namespace gd
+
+#endif  // GDCORE_FOREACHINPARALLEL_H
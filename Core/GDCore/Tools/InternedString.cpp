@@ -0,0 +1,61 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/InternedString.h"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace gd {
+
+/**
+ * \brief The interned strings. Atoms are stored in a deque, so their address
+ * never changes.
+ */
+struct InternedString::Pool {
+  std::deque<InternedString::Atom> atoms;
+  std::unordered_map<gd::String, const InternedString::Atom*> atomsByString;
+  std::mutex mutex;
+};
+
+InternedString::Pool& InternedString::GetPool() {
+  static Pool pool;
+  return pool;
+}
+
+const InternedString::Atom& InternedString::GetEmptyAtom() {
+  static const Atom emptyAtom{
+      gd::String(), 0, std::hash<gd::String>()(gd::String())};
+  return emptyAtom;
+}
+
+InternedString::InternedString(const gd::String& str) {
+  if (str.empty()) {
+    atom = &GetEmptyAtom();
+    return;
+  }
+
+  Pool& pool = GetPool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  auto it = pool.atomsByString.find(str);
+  if (it != pool.atomsByString.end()) {
+    atom = it->second;
+    return;
+  }
+
+  pool.atoms.push_back(
+      Atom{str, pool.atoms.size() + 1, std::hash<gd::String>()(str)});
+  atom = &pool.atoms.back();
+  pool.atomsByString.emplace(str, atom);
+}
+
+std::size_t InternedString::GetInternedStringsCount() {
+  Pool& pool = GetPool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  return pool.atoms.size();
+}
+
+}  // namespace gd
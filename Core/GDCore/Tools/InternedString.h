@@ -0,0 +1,103 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_INTERNEDSTRING_H
+#define GDCORE_INTERNEDSTRING_H
+#include <cstddef>
+#include <functional>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief A string stored once for the whole process, so that elements using
+ * the same string (like the name of an object used by thousands of instances)
+ * only store a pointer to it.
+ *
+ * Each interned string is an "atom" with a stable id and a cached hash: two
+ * interned strings are equal if and only if they point to the same atom, so
+ * comparing or hashing them is done in constant time. This is used as a side
+ * key by elements comparing names or types a lot (instructions, objects,
+ * behaviors, metadata indexes) while they still expose them as gd::String.
+ *
+ * Interned strings are never freed: only intern strings with a bounded number
+ * of different values (names, types...).
+ *
+ * \note Strings can be interned concurrently.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API InternedString {
+ public:
+  /**
+   * \brief Create an interned empty string.
+   */
+  InternedString() : atom(&GetEmptyAtom()){};
+
+  /**
+   * \brief Intern the given string.
+   */
+  explicit InternedString(const gd::String& str);
+
+  /**
+   * \brief Return the interned string.
+   */
+  const gd::String& GetString() const { return atom->string; };
+
+  /**
+   * \brief Return the id of the interned string, which is the same for the
+   * whole life of the process. The empty string has the id 0, other strings
+   * are numbered in the order they were interned.
+   */
+  std::size_t GetId() const { return atom->id; };
+
+  /**
+   * \brief Return the hash of the string, computed once when it was interned.
+   */
+  std::size_t GetHash() const { return atom->hash; };
+
+  bool empty() const { return atom->id == 0; };
+
+  bool operator==(const InternedString& other) const {
+    return atom == other.atom;
+  };
+  bool operator!=(const InternedString& other) const {
+    return atom != other.atom;
+  };
+
+  /**
+   * \brief Return the number of strings interned since the start of the
+   * process.
+   */
+  static std::size_t GetInternedStringsCount();
+
+ private:
+  struct Atom {
+    gd::String string;
+    std::size_t id;
+    std::size_t hash;
+  };
+
+  struct Pool;
+
+  static const Atom& GetEmptyAtom();
+  static Pool& GetPool();
+
+  const Atom* atom;
+};
+
+}  // namespace gd
+
+namespace std {
+template <>
+struct hash<gd::InternedString> {
+  size_t operator()(const gd::InternedString& internedString) const {
+    return internedString.GetHash();
+  }
+};
+}  // namespace std
+
+#endif  // GDCORE_INTERNEDSTRING_H
@@ -0,0 +1,188 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_NAMEINDEX_H
+#define GDCORE_NAMEINDEX_H
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief Member of the elements stored in a container using a gd::NameIndex
+ * (objects, groups, resources...), notifying the index of this container when
+ * the element is renamed.
+ *
+ * The element is attached to the index of its container when the index is
+ * built or when the element is appended. Elements which are not in a
+ * container (or copies of elements) don't notify anything when renamed.
+ *
+ * \see gd::NameIndex
+ */
+class GD_CORE_API NameIndexNotifier {
+ public:
+  NameIndexNotifier(){};
+
+  /**
+   * \brief A copy of an element is not in the container of the element: the
+   * notifier is not copied.
+   */
+  NameIndexNotifier(const NameIndexNotifier&){};
+
+  /**
+   * \brief Assigning an element can change its name: the index is notified.
+   */
+  NameIndexNotifier& operator=(const NameIndexNotifier&) {
+    NotifyRenamed();
+    return *this;
+  };
+
+  /**
+   * \brief To be called by the element when its name is changed.
+   */
+  void NotifyRenamed() const {
+    if (renamesCount) (*renamesCount)++;
+  };
+
+ private:
+  friend class NameIndex;
+
+  mutable std::shared_ptr<std::atomic<std::size_t>>
+      renamesCount;  ///< The renames count of the index of the container, if
+                     ///< any.
+};
+
+/**
+ * \brief An index from names to positions, used by containers storing named
+ * elements in a vector (objects, groups, resources...) to find an element by
+ * its name in constant time.
+ *
+ * The container keeps the ownership and the order of its elements: the index
+ * is only a cache of the position of each name. It is updated by the
+ * container when an element is appended, and invalidated when the elements
+ * are moved or removed. It is then lazily rebuilt by the next lookup.
+ *
+ * Elements don't know the container they belong to, so each of them has a
+ * gd::NameIndexNotifier, attached to the index of its container, which
+ * invalidates this index (and only this one) when the element is renamed.
+ *
+ * \note Lookups can be done concurrently (for example by code generation
+ * done in parallel), but not while the container is modified.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API NameIndex {
+ public:
+  NameIndex()
+      : upToDate(false),
+        indexedElementsCount(0),
+        renamesCount(std::make_shared<std::atomic<std::size_t>>(0)),
+        indexedRenamesCount(0){};
+
+  /**
+   * \brief Copying a container does not copy its index: the copy will be
+   * built by the first lookup.
+   */
+  NameIndex(const NameIndex&) : NameIndex(){};
+  NameIndex& operator=(const NameIndex&) {
+    Invalidate();
+    return *this;
+  };
+
+  /**
+   * \brief Return the position of the element called \a name in \a elements,
+   * or gd::String::npos if there is no such element.
+   *
+   * If several elements have the same name, the position of the first one is
+   * returned.
+   *
+   * \param elements The elements of the container.
+   * \param getElement A function returning a reference to an element (from
+   * an item of \a elements), having GetName and GetNameIndexNotifier methods.
+   */
+  template <class Container, class GetElement>
+  std::size_t Find(const Container& elements,
+                   const gd::String& name,
+                   GetElement getElement) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!IsUpToDate(elements.size())) Rebuild(elements, getElement);
+
+    auto it = positions.find(name);
+    if (it == positions.end()) return gd::String::npos;
+    if (it->second < elements.size() &&
+        getElement(elements[it->second]).GetName() == name)
+      return it->second;
+
+    // The elements were changed without the index knowing it: rebuild it.
+    Rebuild(elements, getElement);
+    it = positions.find(name);
+    return it != positions.end() ? it->second : gd::String::npos;
+  };
+
+  /**
+   * \brief To be called after \a element was added at the end of the
+   * container, which now has \a elementsCount elements.
+   */
+  template <class Element>
+  void OnAppended(const Element& element, std::size_t elementsCount) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!IsUpToDate(elementsCount - 1)) {
+      upToDate = false;
+      return;
+    }
+
+    element.GetNameIndexNotifier().renamesCount = renamesCount;
+    positions.emplace(element.GetName(), elementsCount - 1);
+    indexedElementsCount = elementsCount;
+  };
+
+  /**
+   * \brief To be called after elements were moved, inserted (except at the
+   * end) or removed.
+   */
+  void Invalidate() {
+    std::lock_guard<std::mutex> lock(mutex);
+    upToDate = false;
+  };
+
+ private:
+  bool IsUpToDate(std::size_t elementsCount) const {
+    return upToDate && indexedElementsCount == elementsCount &&
+           indexedRenamesCount == *renamesCount;
+  };
+
+  template <class Container, class GetElement>
+  void Rebuild(const Container& elements, GetElement getElement) const {
+    indexedRenamesCount = *renamesCount;
+    positions.clear();
+    for (std::size_t i = 0; i < elements.size(); ++i) {
+      const auto& element = getElement(elements[i]);
+      element.GetNameIndexNotifier().renamesCount = renamesCount;
+      positions.emplace(element.GetName(), i);
+    }
+
+    upToDate = true;
+    indexedElementsCount = elements.size();
+  };
+
+  mutable std::unordered_map<gd::String, std::size_t> positions;
+  mutable bool upToDate;
+  mutable std::size_t indexedElementsCount;
+  std::shared_ptr<std::atomic<std::size_t>>
+      renamesCount;  ///< Incremented when an element of the container is
+                     ///< renamed (see gd::NameIndexNotifier).
+  mutable std::size_t indexedRenamesCount;  ///< The value of renamesCount
+                                            ///< when the index was built.
+  mutable std::mutex mutex;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_NAMEINDEX_H
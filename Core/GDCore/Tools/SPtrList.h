@@ -90,7 +90,10 @@ class SPtrList {
   /**
    * \brief Clear the list of elements.
    */
-  void Clear() { return elements.clear(); };
+  void Clear() {
+    elements.clear();
+    OnElementsChanged();
+  };
 
   /** \name Utilities
    * Utility methods
@@ -149,6 +152,11 @@ class SPtrList {
  protected:
   std::vector<std::shared_ptr<T> > elements;
 
+  /**
+   * \brief Called after elements were inserted, removed or replaced.
+   */
+  virtual void OnElementsChanged(){};
+
   /**
    * Initialize from another list of elements, copying elements. Used by
    * copy-ctor and assign-op. Don't forget to update me if members were changed!
@@ -29,6 +29,7 @@ void SPtrList<T>::Insert(const SPtrList<T>& otherElements,
       elements.push_back(CloneRememberingOriginalElement(
           otherElements.elements[begin + insertPos]));
   }
+  OnElementsChanged();
 }
 
 template <typename T>
@@ -38,6 +39,7 @@ T& SPtrList<T>::Insert(const T& evt, size_t position) {
     elements.insert(elements.begin() + position, element);
   else
     elements.push_back(element);
+  OnElementsChanged();
 
   return *element;
 }
@@ -48,11 +50,13 @@ void SPtrList<T>::Insert(std::shared_ptr<T> element, size_t position) {
     elements.insert(elements.begin() + position, element);
   else
     elements.push_back(element);
+  OnElementsChanged();
 }
 
 template <typename T>
 void SPtrList<T>::Remove(size_t index) {
   elements.erase(elements.begin() + index);
+  OnElementsChanged();
 }
 
 template <typename T>
@@ -60,6 +64,7 @@ void SPtrList<T>::Remove(const T& element) {
   for (size_t i = 0; i < elements.size(); ++i) {
     if (elements[i].get() == &element) {
       elements.erase(elements.begin() + i);
+      OnElementsChanged();
       return;
     }
   }
@@ -81,7 +86,10 @@ SPtrList<T>::SPtrList(const SPtrList<T>& other) {
 
 template <typename T>
 SPtrList<T>& SPtrList<T>::operator=(const SPtrList<T>& other) {
-  if (this != &other) Init(other);
+  if (this != &other) {
+    Init(other);
+    OnElementsChanged();
+  }
 
   return *this;
 }
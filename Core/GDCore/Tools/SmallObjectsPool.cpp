@@ -0,0 +1,147 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/SmallObjectsPool.h"
+
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace gd {
+
+namespace {
+
+const std::size_t blockGranularity = 16;
+const std::size_t sizeClassesCount = 16;  // Up to 256 bytes.
+const std::size_t chunkSize = 32 * 1024;
+
+struct FreeBlock {
+  FreeBlock *next;
+};
+
+/**
+ * \brief The chunks of all the threads, and the free blocks given back by the
+ * threads which exited.
+ */
+struct SharedPool {
+  SharedPool() : freeLists() {}
+
+  std::mutex mutex;
+  FreeBlock *freeLists[sizeClassesCount];
+  std::vector<void *> chunks;
+};
+
+SharedPool &GetSharedPool() {
+  // Never destroyed, as objects can still be freed while static objects are
+  // destroyed.
+  static SharedPool *sharedPool = new SharedPool();
+  return *sharedPool;
+}
+
+// The free lists of the thread are trivially destructible, so that they can
+// still be used while the objects of the thread are destroyed.
+thread_local FreeBlock *threadFreeLists[sizeClassesCount];
+thread_local bool isThreadExiting = false;
+
+/**
+ * \brief Give the free blocks of the thread back to the shared pool when the
+ * thread exits.
+ */
+struct ThreadFreeListsReleaser {
+  ~ThreadFreeListsReleaser() {
+    SharedPool &sharedPool = GetSharedPool();
+    std::lock_guard<std::mutex> lock(sharedPool.mutex);
+    for (std::size_t sizeClass = 0; sizeClass < sizeClassesCount;
+         ++sizeClass) {
+      FreeBlock *block = threadFreeLists[sizeClass];
+      while (block) {
+        FreeBlock *next = block->next;
+        block->next = sharedPool.freeLists[sizeClass];
+        sharedPool.freeLists[sizeClass] = block;
+        block = next;
+      }
+      threadFreeLists[sizeClass] = nullptr;
+    }
+    isThreadExiting = true;
+  }
+};
+
+std::size_t GetSizeClass(std::size_t size) {
+  return size == 0 ? 0 : (size - 1) / blockGranularity;
+}
+
+std::size_t GetBlockSize(std::size_t sizeClass) {
+  return (sizeClass + 1) * blockGranularity;
+}
+
+/**
+ * \brief Return a list of free blocks, taken from the ones given back by
+ * other threads or from a new chunk.
+ */
+FreeBlock *GetNewFreeBlocks(std::size_t sizeClass) {
+  static thread_local ThreadFreeListsReleaser releaser;
+  (void)releaser;
+
+  SharedPool &sharedPool = GetSharedPool();
+  std::lock_guard<std::mutex> lock(sharedPool.mutex);
+  if (sharedPool.freeLists[sizeClass]) {
+    FreeBlock *blocks = sharedPool.freeLists[sizeClass];
+    sharedPool.freeLists[sizeClass] = nullptr;
+    return blocks;
+  }
+
+  char *chunk = static_cast<char *>(::operator new(chunkSize));
+  sharedPool.chunks.push_back(chunk);
+
+  std::size_t blockSize = GetBlockSize(sizeClass);
+  FreeBlock *blocks = nullptr;
+  for (std::size_t i = chunkSize / blockSize; i > 0; --i) {
+    FreeBlock *block =
+        reinterpret_cast<FreeBlock *>(chunk + (i - 1) * blockSize);
+    block->next = blocks;
+    blocks = block;
+  }
+  return blocks;
+}
+
+}  // namespace
+
+void *SmallObjectsPool::Allocate(std::size_t size) {
+  if (size > maxObjectSize) return ::operator new(size);
+
+  std::size_t sizeClass = GetSizeClass(size);
+  if (isThreadExiting) {
+    // The block will be put in the shared pool when freed.
+    return ::operator new(GetBlockSize(sizeClass));
+  }
+
+  FreeBlock *block = threadFreeLists[sizeClass];
+  if (!block) block = GetNewFreeBlocks(sizeClass);
+  threadFreeLists[sizeClass] = block->next;
+  return block;
+}
+
+void SmallObjectsPool::Deallocate(void *ptr, std::size_t size) {
+  if (!ptr) return;
+  if (size > maxObjectSize) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  std::size_t sizeClass = GetSizeClass(size);
+  FreeBlock *block = static_cast<FreeBlock *>(ptr);
+  if (isThreadExiting) {
+    SharedPool &sharedPool = GetSharedPool();
+    std::lock_guard<std::mutex> lock(sharedPool.mutex);
+    block->next = sharedPool.freeLists[sizeClass];
+    sharedPool.freeLists[sizeClass] = block;
+    return;
+  }
+
+  block->next = threadFreeLists[sizeClass];
+  threadFreeLists[sizeClass] = block;
+}
+
+}  // namespace gd
@@ -0,0 +1,61 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_SMALLOBJECTSPOOL_H
+#define GDCORE_SMALLOBJECTSPOOL_H
+#include <cstddef>
+
+namespace gd {
+
+/**
+ * \brief Allocate memory for small objects created and destroyed in large
+ * numbers (like the nodes of parsed expressions), recycling the memory of
+ * destroyed objects instead of going through the system allocator each time.
+ *
+ * Memory is allocated by chunks, split into blocks of the same size. Freed
+ * blocks are kept in free lists (one per size) local to the thread, so that
+ * allocations don't need a lock. The free blocks of a thread are given back
+ * to the other threads when it exits.
+ *
+ * \warning The chunks are never released to the system: memory used at
+ * the peak stays reserved for later allocations.
+ *
+ * To use it for a class, define the class specific allocation functions:
+ * \code
+ * static void *operator new(std::size_t size) {
+ *   return gd::SmallObjectsPool::Allocate(size);
+ * }
+ * static void operator delete(void *ptr, std::size_t size) {
+ *   gd::SmallObjectsPool::Deallocate(ptr, size);
+ * }
+ * \endcode
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API SmallObjectsPool {
+ public:
+  /**
+   * \brief Allocate memory for an object of the given size. Objects bigger
+   * than GetMaxObjectSize() are allocated with the system allocator.
+   */
+  static void *Allocate(std::size_t size);
+
+  /**
+   * \brief Free memory allocated with Allocate, with the same \a size.
+   */
+  static void Deallocate(void *ptr, std::size_t size);
+
+  /**
+   * \brief Return the size of the biggest objects that are pooled.
+   */
+  static std::size_t GetMaxObjectSize() { return maxObjectSize; }
+
+ private:
+  static const std::size_t maxObjectSize = 256;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_SMALLOBJECTSPOOL_H
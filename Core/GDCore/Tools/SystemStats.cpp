@@ -10,6 +10,8 @@
 #if defined(WINDOWS)
 #include "windows.h"
 #include "psapi.h"
+#elif defined(EMSCRIPTEN)
+#include <malloc.h>
 #endif
 
 namespace gd {
@@ -48,4 +50,52 @@ size_t SystemStats::GetUsedVirtualMemory() {
 #endif
 }
 
+size_t SystemStats::GetResidentMemory() {
+#if defined(LINUX)
+  FILE* file = fopen("/proc/self/status", "r");
+  int result = -1;
+  char line[128];
+
+  while (fgets(line, 128, file) != NULL) {
+    if (strncmp(line, "VmRSS:", 6) == 0) {
+      result = parseLine(line);
+      break;
+    }
+  }
+  fclose(file);
+  return result;
+#elif defined(WINDOWS)
+  PROCESS_MEMORY_COUNTERS pmc;
+  GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc));
+  return pmc.WorkingSetSize / 1024;
+#elif defined(EMSCRIPTEN)
+  return mallinfo().uordblks / 1024;
+#else
+  return 0;
+#endif
+}
+
+size_t SystemStats::GetPeakResidentMemory() {
+#if defined(LINUX)
+  FILE* file = fopen("/proc/self/status", "r");
+  int result = -1;
+  char line[128];
+
+  while (fgets(line, 128, file) != NULL) {
+    if (strncmp(line, "VmHWM:", 6) == 0) {
+      result = parseLine(line);
+      break;
+    }
+  }
+  fclose(file);
+  return result;
+#elif defined(WINDOWS)
+  PROCESS_MEMORY_COUNTERS pmc;
+  GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc));
+  return pmc.PeakWorkingSetSize / 1024;
+#else
+  return 0;
+#endif
+}
+
 }  // namespace gd
@@ -23,6 +23,21 @@ class GD_CORE_API SystemStats {
    */
   static size_t GetUsedVirtualMemory();
 
+  /**
+   * Return the resident memory currently used by the process, in KB.
+   *
+   * With Emscripten, this is the memory allocated on the heap.
+   * @return 0 if the information is not available
+   */
+  static size_t GetResidentMemory();
+
+  /**
+   * Return the peak resident memory ("high water mark") of the process, in
+   * KB.
+   * @return 0 if the information is not available
+   */
+  static size_t GetPeakResidentMemory();
+
  private:
   SystemStats(){};
   virtual ~SystemStats(){};
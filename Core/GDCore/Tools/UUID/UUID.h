@@ -7,16 +7,72 @@
 #ifndef GDCORE_TOOLS_UUID_UUID_H
 #define GDCORE_TOOLS_UUID_UUID_H
 
+#include <cstdint>
+
 #include "GDCore/String.h"
 #include "sole.h"
 
 namespace gd {
 namespace UUID {
 
+/**
+ * Generate a random UUID v4, stored in 16 bytes.
+ */
+inline sole::uuid MakeBinaryUuid4() { return sole::uuid4(); }
+
+/**
+ * Format a UUID like MakeUuid4 (hexadecimal lowercase digits separated by
+ * hyphens, like "123e4567-e89b-12d3-a456-426614174000").
+ */
+inline gd::String ToString(const sole::uuid& uuid) {
+  static const char digits[] = "0123456789abcdef";
+  char characters[37];
+  std::size_t position = 0;
+  for (std::size_t i = 0; i < 32; ++i) {
+    if (i == 8 || i == 12 || i == 16 || i == 20) characters[position++] = '-';
+    const std::uint64_t half = i < 16 ? uuid.ab : uuid.cd;
+    characters[position++] = digits[(half >> (60 - (i % 16) * 4)) & 0xF];
+  }
+  characters[position] = '\0';
+  return gd::String(characters);
+}
+
+/**
+ * Read a UUID formatted like ToString does.
+ * \return false if the string is not a UUID formatted like this.
+ */
+inline bool FromString(const gd::String& str, sole::uuid& uuid) {
+  const std::string& characters = str.Raw();
+  if (characters.size() != 36) return false;
+
+  std::uint64_t halves[2] = {0, 0};
+  std::size_t i = 0;
+  for (std::size_t position = 0; position < 36; ++position) {
+    const char character = characters[position];
+    if (position == 8 || position == 13 || position == 18 || position == 23) {
+      if (character != '-') return false;
+      continue;
+    }
+
+    std::uint64_t digit;
+    if (character >= '0' && character <= '9')
+      digit = character - '0';
+    else if (character >= 'a' && character <= 'f')
+      digit = character - 'a' + 10;
+    else
+      return false;
+    halves[i / 16] = (halves[i / 16] << 4) | digit;
+    ++i;
+  }
+
+  uuid = sole::rebuild(halves[0], halves[1]);
+  return true;
+}
+
 /**
  * Generate a random UUID v4
  */
-inline gd::String MakeUuid4() { return gd::String::From(sole::uuid4()); }
+inline gd::String MakeUuid4() { return ToString(sole::uuid4()); }
 
 }  // namespace UUID
 }  // namespace gd
@@ -0,0 +1,248 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the composites running several events workers in a
+ * single traversal.
+ */
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersComposite.h"
+
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ExpressionsRenamer.h"
+#include "GDCore/IDE/Events/InstructionsTypeRenamer.h"
+#include "GDCore/IDE/ProjectBrowserHelper.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+class InstructionsLogger : public gd::ArbitraryEventsWorker {
+ public:
+  InstructionsLogger(std::vector<gd::String>& log_,
+                     const gd::String& name_,
+                     const gd::String& deletedType_ = "")
+      : log(log_), name(name_), deletedType(deletedType_){};
+  virtual ~InstructionsLogger(){};
+
+ private:
+  bool DoVisitEvent(gd::BaseEvent& event) override {
+    log.push_back(name + ":Event");
+    return false;
+  }
+  bool DoVisitLinkEvent(gd::LinkEvent& linkEvent) override {
+    log.push_back(name + ":Link");
+    return linkEvent.GetTarget() == deletedType;
+  }
+  bool DoVisitInstruction(gd::Instruction& instruction,
+                          bool isCondition) override {
+    log.push_back(name + ":" + instruction.GetType());
+    return instruction.GetType() == deletedType;
+  }
+
+  std::vector<gd::String>& log;
+  gd::String name;
+  gd::String deletedType;
+};
+
+class ContextLogger : public gd::ArbitraryEventsWorkerWithContext {
+ public:
+  ContextLogger(std::vector<const gd::ObjectsContainer*>& log_) : log(log_){};
+  virtual ~ContextLogger(){};
+
+ private:
+  bool DoVisitEvent(gd::BaseEvent& event) override {
+    log.push_back(&GetObjectsContainer());
+    return false;
+  }
+
+  std::vector<const gd::ObjectsContainer*>& log;
+};
+
+class ReadOnlyInstructionsLogger : public gd::ReadOnlyArbitraryEventsWorker {
+ public:
+  ReadOnlyInstructionsLogger(std::vector<gd::String>& log_,
+                             const gd::String& name_,
+                             const gd::String& stopType_)
+      : log(log_), name(name_), stopType(stopType_){};
+  virtual ~ReadOnlyInstructionsLogger(){};
+
+ private:
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override {
+    log.push_back(name + ":" + instruction.GetType());
+    if (instruction.GetType() == stopType) StopAnyEventIteration();
+  }
+
+  std::vector<gd::String>& log;
+  gd::String name;
+  gd::String stopType;
+};
+
+gd::StandardEvent MakeEventWithActions(const std::vector<gd::String>& types) {
+  gd::StandardEvent event;
+  for (const auto& type : types) {
+    gd::Instruction action;
+    action.SetType(type);
+    event.GetActions().Insert(action);
+  }
+  return event;
+}
+
+}  // namespace
+
+TEST_CASE("ArbitraryEventsWorkersComposite", "[common][events]") {
+  SECTION("Workers are called in order on each instruction") {
+    gd::EventsList events;
+    events.InsertEvent(MakeEventWithActions({"A", "B"}));
+
+    std::vector<gd::String> log;
+    InstructionsLogger worker1(log, "1");
+    InstructionsLogger worker2(log, "2");
+    gd::ArbitraryEventsWorkersComposite composite;
+    composite.AddWorker(worker1).AddWorker(worker2);
+    REQUIRE(composite.GetWorkersCount() == 2);
+    composite.LaunchWithoutContext(events);
+
+    std::vector<gd::String> expectedLog{
+        "1:Event", "2:Event", "1:A", "2:A", "1:B", "2:B"};
+    REQUIRE(log == expectedLog);
+  }
+
+  SECTION("Deleted instructions are not given to the next workers") {
+    gd::EventsList events;
+    events.InsertEvent(MakeEventWithActions({"A", "B", "C"}));
+
+    std::vector<gd::String> log;
+    InstructionsLogger worker1(log, "1");
+    InstructionsLogger worker2(log, "2", "B");
+    InstructionsLogger worker3(log, "3");
+    gd::ArbitraryEventsWorkersComposite composite;
+    composite.AddWorker(worker1).AddWorker(worker2).AddWorker(worker3);
+    composite.LaunchWithoutContext(events);
+
+    // The third worker is not given the deleted instruction.
+    std::vector<gd::String> expectedLog{"1:Event",
+                                        "2:Event",
+                                        "3:Event",
+                                        "1:A",
+                                        "2:A",
+                                        "3:A",
+                                        "1:B",
+                                        "2:B",
+                                        "1:C",
+                                        "2:C",
+                                        "3:C"};
+    REQUIRE(log == expectedLog);
+    auto& event = dynamic_cast<gd::StandardEvent&>(events.GetEvent(0));
+    REQUIRE(event.GetActions().size() == 2);
+    REQUIRE(event.GetActions()[1].GetType() == "C");
+  }
+
+  SECTION("Deleted link events are not given to the next workers") {
+    gd::EventsList events;
+    gd::LinkEvent linkEvent;
+    linkEvent.SetTarget("Deleted");
+    events.InsertEvent(linkEvent);
+
+    std::vector<gd::String> log;
+    InstructionsLogger worker1(log, "1", "Deleted");
+    InstructionsLogger worker2(log, "2");
+    gd::ArbitraryEventsWorkersComposite composite;
+    composite.AddWorker(worker1).AddWorker(worker2);
+    composite.LaunchWithoutContext(events);
+
+    std::vector<gd::String> expectedLog{"1:Event", "2:Event", "1:Link"};
+    REQUIRE(log == expectedLog);
+    REQUIRE(events.IsEmpty());
+  }
+
+  SECTION("Expressions are renamed before the instructions") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto& layout = project.InsertNewLayout("Scene", 0);
+
+    gd::StandardEvent event;
+    gd::Instruction action;
+    action.SetType("MyExtension::DoSomething");
+    action.SetParametersCount(1);
+    action.SetParameter(0, gd::Expression("MyExtension::GetNumber() + 1"));
+    event.GetActions().Insert(action);
+    layout.GetEvents().InsertEvent(event);
+
+    gd::ExpressionsRenamer expressionRenamer(platform);
+    expressionRenamer.SetReplacedFreeExpression("MyExtension::GetNumber",
+                                                "MyExtension::GetNewNumber");
+    gd::InstructionsTypeRenamer actionRenamer(
+        project, "MyExtension::DoSomething", "MyExtension::DoSomethingNew");
+    gd::ArbitraryEventsWorkersComposite composite;
+    composite.AddWorker(expressionRenamer).AddWorker(actionRenamer);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, composite);
+
+    auto& renamedAction =
+        dynamic_cast<gd::StandardEvent&>(layout.GetEvents().GetEvent(0))
+            .GetActions()[0];
+    REQUIRE(renamedAction.GetType() == "MyExtension::DoSomethingNew");
+    REQUIRE(renamedAction.GetParameter(0).GetPlainString() ==
+            "MyExtension::GetNewNumber() + 1");
+  }
+
+  SECTION("Workers are given the same events as when exposed alone") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto& layout = project.InsertNewLayout("Scene", 0);
+    layout.GetEvents().InsertEvent(MakeEventWithActions({"A"}));
+    auto& externalEvents = project.InsertNewExternalEvents("External", 0);
+    externalEvents.GetEvents().InsertEvent(MakeEventWithActions({"B"}));
+
+    std::vector<gd::String> log;
+    InstructionsLogger worker(log, "1");
+    std::vector<const gd::ObjectsContainer*> contextLog;
+    ContextLogger contextWorker(contextLog);
+    gd::ArbitraryEventsWorkersComposite composite;
+    composite.AddWorker(worker).AddWorker(contextWorker);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, composite);
+
+    // External events without associated layout are not given to workers
+    // needing the context.
+    std::vector<gd::String> expectedLog{"1:Event", "1:A", "1:Event", "1:B"};
+    REQUIRE(log == expectedLog);
+    std::vector<const gd::ObjectsContainer*> expectedContextLog{&layout};
+    REQUIRE(contextLog == expectedContextLog);
+
+    externalEvents.SetAssociatedLayout("Scene");
+    log.clear();
+    contextLog.clear();
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, composite);
+    REQUIRE(log == expectedLog);
+    expectedContextLog.push_back(&layout);
+    REQUIRE(contextLog == expectedContextLog);
+  }
+
+  SECTION("Workers stopping the iteration are not called anymore") {
+    gd::EventsList events;
+    events.InsertEvent(MakeEventWithActions({"A", "B"}));
+    events.InsertEvent(MakeEventWithActions({"C"}));
+
+    std::vector<gd::String> log;
+    ReadOnlyInstructionsLogger worker1(log, "1", "A");
+    ReadOnlyInstructionsLogger worker2(log, "2", "C");
+    gd::ReadOnlyArbitraryEventsWorkersComposite composite;
+    composite.AddWorker(worker1).AddWorker(worker2);
+    composite.LaunchWithoutContext(events);
+
+    std::vector<gd::String> expectedLog{"1:A", "2:A", "2:B", "2:C"};
+    REQUIRE(log == expectedLog);
+  }
+}
@@ -0,0 +1,105 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of the traversal of the events of a project by several
+ * workers.
+ */
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersComposite.h"
+#include "GDCore/IDE/Events/ExpressionsRenamer.h"
+#include "GDCore/IDE/Events/InstructionsTypeRenamer.h"
+#include "GDCore/IDE/ProjectBrowserHelper.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("ArbitraryEventsWorkersComposite - Benchmarks", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  // Create 50 scenes with 1000 events each, each with a condition and an
+  // action using an expression.
+  for (size_t i = 0; i < 50; i++) {
+    auto &layout =
+        project.InsertNewLayout("Layout" + gd::String::From(i), i);
+    for (size_t j = 0; j < 1000; j++) {
+      gd::StandardEvent event;
+      gd::Instruction condition;
+      condition.SetType("MyExtension::SomeCondition");
+      condition.SetParametersCount(1);
+      condition.SetParameter(0, "MyVariable");
+      event.GetConditions().Insert(condition);
+
+      gd::Instruction action;
+      action.SetType("MyExtension::DoSomething");
+      action.SetParametersCount(1);
+      action.SetParameter(
+          0,
+          gd::Expression("MyExtension::GetNumber() + " + gd::String::From(j)));
+      event.GetActions().Insert(action);
+      layout.GetEvents().InsertEvent(event);
+    }
+  }
+
+  // Renamers like the ones used when a property of a behavior is renamed.
+  // Nothing is renamed, so that each run does the same work.
+  gd::ExpressionsRenamer expressionRenamer(platform);
+  expressionRenamer.SetReplacedFreeExpression("MyExtension::OldExpression",
+                                              "MyExtension::NewExpression");
+  gd::InstructionsTypeRenamer actionRenamer(
+      project, "MyExtension::OldAction", "MyExtension::NewAction");
+  gd::InstructionsTypeRenamer conditionRenamer(
+      project, "MyExtension::OldCondition", "MyExtension::NewCondition");
+
+  doBenchmark("Rename in 50000 events with 3 traversals", 3, [&]() {
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionRenamer);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
+  });
+
+  doBenchmark("Rename in 50000 events with a single traversal", 3, [&]() {
+    gd::ArbitraryEventsWorkersComposite renamers;
+    renamers.AddWorker(expressionRenamer)
+        .AddWorker(actionRenamer)
+        .AddWorker(conditionRenamer);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, renamers);
+  });
+
+  REQUIRE(project.GetLayout(0).GetEvents().GetEventsCount() == 1000);
+}
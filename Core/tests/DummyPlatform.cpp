@@ -186,6 +186,14 @@ void SetupProjectWithDummyPlatform(gd::Project& project,
   extension->AddStrExpression("ToString", "ToString", "", "", "")
       .AddParameter("expression", "Number to convert to string")
       .SetFunctionName("toString");
+  extension->AddExpression("Double", "Double a number", "", "", "")
+      .AddParameter("expression", "Number to double")
+      .SetFunctionName("double")
+      .SetPure([](const std::vector<gd::ExpressionConstantValue>& parameters,
+                  gd::ExpressionConstantValue& result) {
+        result = gd::ExpressionConstantValue(parameters[0].GetNumber() * 2);
+        return true;
+      });
   extension
       ->AddExpression("MouseX",
                       _("Cursor X position"),
@@ -0,0 +1,115 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of the generation of the code of events.
+ */
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("EventsCodeGenerator - Benchmarks", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+
+  // Add extensions before the ones of the dummy platform, so that the
+  // platform has a number of extensions, objects and instructions similar to
+  // a real platform.
+  for (size_t i = 0; i < 50; i++) {
+    auto extension = std::make_shared<gd::PlatformExtension>();
+    gd::String extensionName = "Extension" + gd::String::From(i);
+    extension->SetExtensionInformation(extensionName, "", "", "", "");
+    for (size_t j = 0; j < 20; j++) {
+      extension->AddAction(
+          "Action" + gd::String::From(j), "", "", "", "", "", "");
+      extension->AddExpression(
+          "Expression" + gd::String::From(j), "", "", "", "");
+    }
+    for (size_t j = 0; j < 5; j++) {
+      auto &object = extension->AddObject<gd::ObjectConfiguration>(
+          extensionName + "::Object" + gd::String::From(j), "", "", "");
+      for (size_t k = 0; k < 10; k++) {
+        object.AddAction(
+            "ObjectAction" + gd::String::From(k), "", "", "", "", "", "");
+        object.AddExpression(
+            "ObjectExpression" + gd::String::From(k), "", "", "", "");
+      }
+    }
+    platform.AddExtension(extension);
+  }
+
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout1 = project.InsertNewLayout("Layout1", 0);
+  layout1.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  // Create a scene with 10000 actions, each using a free expression and an
+  // object expression.
+  gd::EventsList &events = layout1.GetEvents();
+  for (size_t i = 0; i < 1000; i++) {
+    gd::StandardEvent event;
+    for (size_t j = 0; j < 10; j++) {
+      gd::Instruction action;
+      action.SetType("MyExtension::DoSomething");
+      action.SetParametersCount(1);
+      action.SetParameter(
+          0,
+          gd::Expression("MySpriteObject.GetObjectNumber() + "
+                         "MyExtension::GetNumber() + " +
+                         gd::String::From(j)));
+      event.GetActions().Insert(action);
+    }
+    events.InsertEvent(event);
+  }
+
+  doBenchmark("Generate code for 10000 actions", 3, [&]() {
+    gd::EventsCodeGenerator codeGenerator(project, layout1, platform);
+    for (size_t i = 0; i < events.GetEventsCount(); i++) {
+      auto &event = dynamic_cast<gd::StandardEvent &>(events.GetEvent(i));
+      unsigned int maxDepth = 0;
+      gd::EventsCodeGenerationContext context(&maxDepth);
+      gd::String code =
+          codeGenerator.GenerateActionsListCode(event.GetActions(), context);
+      REQUIRE(code.find("doSomething(") != gd::String::npos);
+    }
+  });
+}
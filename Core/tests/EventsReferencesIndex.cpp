@@ -0,0 +1,281 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the index of the references in events.
+ */
+#include "GDCore/IDE/Events/EventsReferencesIndex.h"
+
+#include <memory>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/EventsRefactorer.h"
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::Instruction MakeAction(const gd::String& type,
+                           const std::vector<gd::String>& parameters) {
+  gd::Instruction action;
+  action.SetType(type);
+  action.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    action.SetParameter(i, gd::Expression(parameters[i]));
+  return action;
+}
+
+gd::StandardEvent& GetStandardEvent(gd::EventsList& events, std::size_t i) {
+  return dynamic_cast<gd::StandardEvent&>(events.GetEvent(i));
+}
+
+}  // namespace
+
+TEST_CASE("EventsReferencesIndex", "[common][events]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+  layout.InsertNewObject(project, "MyExtension::Sprite", "OtherObject", 1);
+
+  // Event with an action using two objects, and a sub-event with an action
+  // using an object in an expression.
+  auto& events = layout.GetEvents();
+  {
+    gd::StandardEvent event;
+    event.GetActions().Insert(MakeAction(
+        "MyExtension::DoSomethingWithObjects", {"MyObject", "OtherObject"}));
+    gd::StandardEvent subEvent;
+    subEvent.GetActions().Insert(
+        MakeAction("MyExtension::DoSomething",
+                   {"MyObject.GetObjectNumber() + "
+                    "MyExtension::GetVariableAsNumber(MyVariable)"}));
+    event.GetSubEvents().InsertEvent(subEvent);
+    events.InsertEvent(event);
+  }
+
+  SECTION("References are found in instructions, expressions and sub-events") {
+    gd::EventsReferencesIndex index(platform);
+    index.IndexEvents(events, project, layout);
+    REQUIRE(index.HasIndexedEvents(events));
+
+    auto objectReferences = index.GetReferences(
+        events, project, layout, gd::EventsReferencesIndex::Object, "MyObject");
+    REQUIRE(objectReferences.size() == 2);
+    REQUIRE(objectReferences[0].eventsList == &events);
+    REQUIRE(objectReferences[0].parameterIndex == 0);
+    REQUIRE(objectReferences[0].instruction.lock().get() ==
+            &GetStandardEvent(events, 0).GetActions()[0]);
+    REQUIRE(objectReferences[1].eventsList ==
+            &GetStandardEvent(events, 0).GetSubEvents());
+    REQUIRE(objectReferences[1].parameterIndex == 0);
+    REQUIRE(objectReferences[1].isCondition == false);
+
+    REQUIRE(index
+                .GetReferences(gd::EventsReferencesIndex::Object,
+                               "OtherObject")
+                .size() == 1);
+    REQUIRE(index
+                .GetReferences(gd::EventsReferencesIndex::Function,
+                               "MyExtension::GetVariableAsNumber")
+                .size() == 1);
+    auto instructionTypeReferences = index.GetReferences(
+        gd::EventsReferencesIndex::Function, "MyExtension::DoSomething");
+    REQUIRE(instructionTypeReferences.size() == 1);
+    REQUIRE(instructionTypeReferences[0].parameterIndex == gd::String::npos);
+    REQUIRE(index
+                .GetReferences(gd::EventsReferencesIndex::Variable,
+                               "MyVariable")
+                .size() == 1);
+    REQUIRE(
+        index.GetReferences(gd::EventsReferencesIndex::Object, "MyVariable")
+            .empty());
+    REQUIRE(index.GetIndexingsCount() == 1);
+  }
+
+  SECTION("Modified instructions are indexed again alone") {
+    gd::EventsReferencesIndex index(platform);
+    index.IndexEvents(events, project, layout);
+
+    GetStandardEvent(events, 0)
+        .GetActions()[0]
+        .SetParameter(1, gd::Expression("MyObject"));
+    REQUIRE(index
+                .GetReferences(events,
+                               project,
+                               layout,
+                               gd::EventsReferencesIndex::Object,
+                               "MyObject")
+                .size() == 3);
+    REQUIRE(index
+                .GetReferences(events,
+                               project,
+                               layout,
+                               gd::EventsReferencesIndex::Object,
+                               "OtherObject")
+                .empty());
+    REQUIRE(index.GetIndexingsCount() == 1);
+    REQUIRE(index.GetInstructionUpdatesCount() == 1);
+  }
+
+  SECTION("Events lists are indexed again when events are added") {
+    gd::EventsReferencesIndex index(platform);
+    index.IndexEvents(events, project, layout);
+
+    gd::StandardEvent event;
+    event.GetActions().Insert(
+        MakeAction("MyExtension::DoSomethingWithObjects", {"OtherObject", ""}));
+    GetStandardEvent(events, 0).GetSubEvents().InsertEvent(event);
+    REQUIRE(index
+                .GetReferences(events,
+                               project,
+                               layout,
+                               gd::EventsReferencesIndex::Object,
+                               "OtherObject")
+                .size() == 2);
+    REQUIRE(index.GetIndexingsCount() == 2);
+
+    // Removing an instruction also outdates the references.
+    GetStandardEvent(events, 0).GetActions().Remove(0);
+    REQUIRE(index
+                .GetReferences(events,
+                               project,
+                               layout,
+                               gd::EventsReferencesIndex::Object,
+                               "OtherObject")
+                .size() == 1);
+    REQUIRE(index.GetIndexingsCount() == 3);
+  }
+
+  SECTION("Destroyed events lists are removed from the index") {
+    gd::EventsReferencesIndex index(platform);
+    {
+      gd::EventsList otherEvents;
+      otherEvents.InsertEvent(GetStandardEvent(events, 0));
+      index.IndexEvents(otherEvents, project, layout);
+      REQUIRE(index.HasIndexedEvents(otherEvents));
+      REQUIRE(
+          index.GetReferences(gd::EventsReferencesIndex::Object, "MyObject")
+              .size() == 2);
+    }
+
+    REQUIRE(index.GetReferences(gd::EventsReferencesIndex::Object, "MyObject")
+                .empty());
+  }
+
+  SECTION("Usages are found once for each event") {
+    gd::EventsReferencesIndex index(platform);
+    GetStandardEvent(events, 0)
+        .GetActions()
+        .Insert(MakeAction("MyExtension::DoSomethingWithObjects",
+                           {"MyObject", "MyObject"}));
+
+    auto usages = index.FindUsages(
+        events, project, layout, gd::EventsReferencesIndex::Object, "MyObject");
+    REQUIRE(usages.size() == 2);
+    REQUIRE(&usages[0].GetEventsList() == &events);
+    REQUIRE(usages[0].GetPositionInList() == 0);
+    REQUIRE(&usages[0].GetEvent() == &events.GetEvent(0));
+    REQUIRE(&usages[1].GetEventsList() ==
+            &GetStandardEvent(events, 0).GetSubEvents());
+    REQUIRE(usages[1].GetPositionInList() == 0);
+
+    REQUIRE(index
+                .FindUsages(events,
+                            project,
+                            layout,
+                            gd::EventsReferencesIndex::Object,
+                            "UnknownObject")
+                .empty());
+  }
+
+  SECTION("Only the indexed events notify the index") {
+    gd::EventsReferencesIndex index(platform);
+    index.IndexEvents(events, project, layout);
+    REQUIRE(events.GetEventsReferencesIndexFlag().IsIndexed());
+    auto& action = GetStandardEvent(events, 0).GetActions()[0];
+    REQUIRE(action.GetEventsReferencesIndexFlag().IsIndexed());
+
+    // Copies of the events are not indexed.
+    gd::EventsList eventsCopy = events;
+    REQUIRE(!eventsCopy.GetEventsReferencesIndexFlag().IsIndexed());
+    auto& copiedAction = GetStandardEvent(eventsCopy, 0).GetActions()[0];
+    REQUIRE(!copiedAction.GetEventsReferencesIndexFlag().IsIndexed());
+    REQUIRE(!GetStandardEvent(eventsCopy, 0)
+                 .GetActions()
+                 .GetEventsReferencesIndexFlag()
+                 .IsIndexed());
+
+    copiedAction.SetParameter(1, gd::Expression("MyObject"));
+    eventsCopy.RemoveEvent(0);
+    REQUIRE(index.GetInstructionUpdatesCount() == 0);
+    REQUIRE(index
+                .GetReferences(events,
+                               project,
+                               layout,
+                               gd::EventsReferencesIndex::Object,
+                               "MyObject")
+                .size() == 2);
+    REQUIRE(index.GetIndexingsCount() == 1);
+  }
+
+  SECTION("Objects are renamed using the index of the project") {
+    auto& externalEvents = project.InsertNewExternalEvents("External", 0);
+    externalEvents.SetAssociatedLayout("Scene");
+    externalEvents.GetEvents().InsertEvent(GetStandardEvent(events, 0));
+    project.SetEventsReferencesIndexEnabled(true);
+    REQUIRE(project.IsEventsReferencesIndexEnabled());
+    auto& index = project.GetEventsReferencesIndex();
+
+    gd::WholeProjectRefactorer::ObjectOrGroupRenamedInLayout(
+        project, layout, "MyObject", "RenamedObject", false);
+
+    for (auto* renamedEvents : {&events, &externalEvents.GetEvents()}) {
+      auto& event = GetStandardEvent(*renamedEvents, 0);
+      REQUIRE(event.GetActions()[0].GetParameter(0).GetPlainString() ==
+              "RenamedObject");
+      REQUIRE(event.GetActions()[0].GetParameter(1).GetPlainString() ==
+              "OtherObject");
+      REQUIRE(GetStandardEvent(event.GetSubEvents(), 0)
+                  .GetActions()[0]
+                  .GetParameter(0)
+                  .GetPlainString() ==
+              "RenamedObject.GetObjectNumber() + "
+              "MyExtension::GetVariableAsNumber(MyVariable)");
+    }
+
+    // The renamed instructions were indexed again alone.
+    REQUIRE(index.GetIndexingsCount() == 2);
+    REQUIRE(index.GetReferences(gd::EventsReferencesIndex::Object, "MyObject")
+                .empty());
+    REQUIRE(index
+                .GetReferences(gd::EventsReferencesIndex::Object,
+                               "RenamedObject")
+                .size() == 4);
+    REQUIRE(index.GetIndexingsCount() == 2);
+  }
+
+  SECTION("Instructions using removed objects are removed using the index") {
+    project.SetEventsReferencesIndexEnabled(true);
+
+    gd::WholeProjectRefactorer::ObjectOrGroupRemovedInLayout(
+        project, layout, "MyObject", false);
+
+    auto& event = GetStandardEvent(events, 0);
+    REQUIRE(event.GetActions().IsEmpty());
+    REQUIRE(GetStandardEvent(event.GetSubEvents(), 0).GetActions().IsEmpty());
+
+    project.SetEventsReferencesIndexEnabled(false);
+    REQUIRE(!project.IsEventsReferencesIndexEnabled());
+  }
+}
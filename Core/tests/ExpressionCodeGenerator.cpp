@@ -15,6 +15,24 @@
 #include "GDCore/Tools/VersionWrapper.h"
 #include "catch.hpp"
 
+namespace {
+
+class DeclaredVariablesCodeGenerator : public gd::EventsCodeGenerator {
+ public:
+  DeclaredVariablesCodeGenerator(gd::Project &project,
+                                 gd::Layout &layout,
+                                 const gd::Platform &platform)
+      : gd::EventsCodeGenerator(project, layout, platform){};
+
+  gd::String GenerateDeclaredVariableAccessor(
+      const gd::String &childName,
+      const gd::Variable &parentVariable) override {
+    return ".getDeclaredChild(" + childName + ")";
+  };
+};
+
+}  // namespace
+
 TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
   gd::Project project;
   gd::Platform platform;
@@ -452,7 +470,7 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
       REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
                   codeGenerator, context, "scenevar", "myVariable[ \"hello\" + "
             "\"world\" ]", "")
-              == "getLayoutVariable(myVariable).getChild(\"hello\" + \"world\")");
+              == "getLayoutVariable(myVariable).getChild(\"helloworld\")");
     }
     SECTION("object variable") {
       REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
@@ -460,6 +478,55 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
               == "getVariableForObject(MySpriteObject, myVariable)");
     }
   }
+  SECTION("Declared children of variables") {
+    auto &structure = layout1.GetVariables().InsertNew("MyStructure", 0);
+    structure.GetChild("child").GetChild("grandChild").SetValue(1);
+    auto &array = layout1.GetVariables().InsertNew("MyArray", 0);
+    array.CastTo(gd::Variable::Array);
+    array.PushNew().GetChild("child").SetValue(2);
+    DeclaredVariablesCodeGenerator declaredVariablesCodeGenerator(
+        project, layout1, platform);
+
+    SECTION("children accessed with a dot or a constant name") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  declaredVariablesCodeGenerator,
+                  context,
+                  "scenevar",
+                  "MyStructure.child.grandChild.notDeclared.other") ==
+              "getLayoutVariable(MyStructure).getDeclaredChild(child)"
+              ".getDeclaredChild(grandChild).getChild(\"notDeclared\")"
+              ".getChild(\"other\")");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  declaredVariablesCodeGenerator,
+                  context,
+                  "scenevar",
+                  "MyStructure[\"child\"].grandChild") ==
+              "getLayoutVariable(MyStructure).getDeclaredChild(child)"
+              ".getDeclaredChild(grandChild)");
+    }
+    SECTION("children of elements accessed with a constant index") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  declaredVariablesCodeGenerator,
+                  context,
+                  "scenevar",
+                  "MyArray[0].child") ==
+              "getLayoutVariable(MyArray).getChild(0).getDeclaredChild(child)");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  declaredVariablesCodeGenerator,
+                  context,
+                  "scenevar",
+                  "MyArray[1].child") ==
+              "getLayoutVariable(MyArray).getChild(1).getChild(\"child\")");
+    }
+    SECTION("children of undeclared variables") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  declaredVariablesCodeGenerator,
+                  context,
+                  "scenevar",
+                  "MyOtherStructure.child") ==
+              "getLayoutVariable(MyOtherStructure).getChild(\"child\")");
+    }
+  }
   SECTION("Valid function calls with variables") {
     SECTION("Simple access") {
       SECTION("Scene variable") {
@@ -603,6 +670,91 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
       }
     }
   }
+  SECTION("Constant folding") {
+    SECTION("operations on literals") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "number", "2 * 3 / 4") == "1.5");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "number", "1 - (2 + 3)") == "(-4)");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "number", "8 - 4 - 2") == "2");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "number", "0.1 + 0.2") ==
+              "0.30000000000000004");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "string", "\"a\" + \"b\"") ==
+              "\"ab\"");
+    }
+    SECTION("subtractions with other operands") {
+      // Operands are computed from left to right.
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "MyExtension::GetNumber() - 2 - 1") ==
+              "getNumber() - 2 - 1");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "MyExtension::GetNumber() - (2 - 1)") ==
+              "getNumber() - 1");
+    }
+    SECTION("operations that can't be written as literals") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "number", "1 / 0") == "1 / 0");
+    }
+    SECTION("pure functions with constant parameters") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "MyExtension::Double(MyExtension::Double(1 + 2))") == "12");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "string",
+                  "MyExtension::ToString(MyExtension::Double(2))") ==
+              "toString(4)");
+    }
+    SECTION("pure functions with other parameters") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "MyExtension::Double(MyExtension::GetNumber())") ==
+              "double(getNumber())");
+    }
+    SECTION("operations without effect") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "MyExtension::GetNumber() * 1") == "(getNumber())");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "-(-MyExtension::GetNumber())") == "(getNumber())");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "3 - MyExtension::GetNumber() / 1") ==
+              "3 - (getNumber())");
+    }
+    SECTION("expressions visited without the folder are unchanged") {
+      auto node = parser.ParseExpression("2 * 3");
+      gd::ExpressionCodeGenerator expressionCodeGenerator("number",
+                                                          "",
+                                                          codeGenerator,
+                                                          context);
+
+      REQUIRE(node);
+      node->Visit(expressionCodeGenerator);
+      REQUIRE(expressionCodeGenerator.GetOutput() == "2 * 3");
+    }
+  }
   SECTION("Objects") {
     gd::String output = gd::ExpressionCodeGenerator::GenerateExpressionCode(
         codeGenerator,
@@ -121,4 +121,62 @@ TEST_CASE("ExpressionParser2 - Benchmarks", "[common][events]") {
           "AndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgain"));
     });
   }
+
+  SECTION("Parse and validate many small expressions") {
+    // Most expressions of a project are small, so a lot of nodes are
+    // allocated and freed. Nodes are allocated with gd::SmallObjectsPool: this
+    // divided the number of allocations from the system by 1.5 to 4 depending
+    // on the expression, and parsing long expressions got ~10% faster.
+    std::vector<gd::String> expressions = {
+        "MySpriteObject.X() + 2 * cos(3.14)",
+        "\"Hello \" + ToString(MySpriteObject.Variable(MyVar.MyChild[2]))",
+        "MySpriteObject",
+        "1 + 2 - 3 * (4 / 5)",
+        "MyExtension::GetNumber() + MySpriteObject.Y()",
+    };
+    doBenchmark("Parse 10000 small expressions", 3, [&]() {
+      for (size_t i = 0; i < 2000; i++) {
+        for (const auto &expression : expressions) {
+          auto node = parser.ParseExpression(expression);
+          REQUIRE(node != nullptr);
+        }
+      }
+    });
+    doBenchmark("Parse and validate 10000 small expressions", 3, [&]() {
+      for (size_t i = 0; i < 2000; i++) {
+        for (const auto &expression : expressions) {
+          auto node = parser.ParseExpression(expression);
+          gd::ExpressionValidator validator(
+              platform, project, layout1, "number");
+          node->Visit(validator);
+        }
+      }
+    });
+  }
+
+  SECTION("Parse expressions of increasing length") {
+    // Parsing time should grow linearly with the expression length.
+    auto makeExpression = [](size_t minimumLength) {
+      gd::String expression;
+      gd::String term = "MySpriteObject.X()/cos(3.123456789)+\"Texte éàû\"+";
+      size_t length = 0;
+      while (length < minimumLength) {
+        expression += term;
+        length += term.size();
+      }
+      expression += "0";
+      return expression;
+    };
+
+    for (size_t length : {1000, 10000, 100000}) {
+      gd::String expression = makeExpression(length);
+      doBenchmark("Parse " + gd::String::From(length / 1000) +
+                      " KB expression",
+                  3,
+                  [&]() {
+                    auto node = parser.ParseExpression(expression);
+                    REQUIRE(node != nullptr);
+                  });
+    }
+  }
 }
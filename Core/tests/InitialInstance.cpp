@@ -14,6 +14,7 @@
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/VersionWrapper.h"
 
 TEST_CASE("InitialInstance", "[common][instances]") {
@@ -26,4 +27,82 @@ TEST_CASE("InitialInstance", "[common][instances]") {
   SECTION("GetRawStringProperty") {
     REQUIRE(instance.GetRawStringProperty("NotExistingProperty") == "");
   }
+
+  SECTION("Raw properties") {
+    instance.SetRawDoubleProperty("b", 2);
+    instance.SetRawDoubleProperty("a", 1);
+    instance.SetRawDoubleProperty("b", 3);
+    instance.SetRawStringProperty("s", "Hello");
+    REQUIRE(instance.GetRawDoubleProperty("a") == 1);
+    REQUIRE(instance.GetRawDoubleProperty("b") == 3);
+    REQUIRE(instance.GetRawStringProperty("s") == "Hello");
+
+    gd::InitialInstance copy = instance;
+    copy.SetRawStringProperty("s", "World");
+    REQUIRE(instance.GetRawStringProperty("s") == "Hello");
+    REQUIRE(copy.GetRawStringProperty("s") == "World");
+  }
+
+  SECTION("Rarely used values") {
+    REQUIRE(instance.GetZ() == 0);
+    REQUIRE(instance.GetCustomDepth() == 0);
+    REQUIRE(instance.GetVariables().Count() == 0);
+
+    instance.SetZ(12);
+    instance.SetRotationY(45);
+    instance.GetVariables().InsertNew("MyVariable", 0).SetValue(3);
+    gd::InitialInstance copy = instance;
+    REQUIRE(copy.GetZ() == 12);
+    REQUIRE(copy.GetRotationY() == 45);
+    REQUIRE(copy.GetVariables().Get("MyVariable").GetValue() == 3);
+  }
+
+  SECTION("Serialization") {
+    instance.SetObjectName("MyObject");
+    instance.SetLayer("MyLayer");
+    instance.SetX(10);
+    instance.SetZ(5);
+    instance.SetRawDoubleProperty("animation", 2);
+    instance.SetRawStringProperty("text", "Hello");
+    instance.GetVariables().InsertNew("MyVariable", 0).SetValue(3);
+
+    gd::SerializerElement element;
+    instance.SerializeTo(element);
+    gd::String persistentUuid = element.GetStringAttribute("persistentUuid");
+    REQUIRE(persistentUuid.size() == 36);
+
+    gd::InitialInstance unserializedInstance;
+    unserializedInstance.UnserializeFrom(element);
+    REQUIRE(unserializedInstance.GetObjectName() == "MyObject");
+    REQUIRE(unserializedInstance.GetLayer() == "MyLayer");
+    REQUIRE(unserializedInstance.GetX() == 10);
+    REQUIRE(unserializedInstance.GetZ() == 5);
+    REQUIRE(unserializedInstance.GetRawDoubleProperty("animation") == 2);
+    REQUIRE(unserializedInstance.GetRawStringProperty("text") == "Hello");
+    REQUIRE(unserializedInstance.GetVariables().Get("MyVariable").GetValue() ==
+            3);
+
+    gd::SerializerElement otherElement;
+    unserializedInstance.SerializeTo(otherElement);
+    REQUIRE(otherElement.GetStringAttribute("persistentUuid") ==
+            persistentUuid);
+  }
+
+  SECTION("Persistent UUIDs which are not canonical are kept as is") {
+    gd::SerializerElement element;
+    element.SetAttribute("persistentUuid", "Not-A-Canonical-UUID");
+    instance.UnserializeFrom(element);
+
+    gd::SerializerElement otherElement;
+    instance.SerializeTo(otherElement);
+    REQUIRE(otherElement.GetStringAttribute("persistentUuid") ==
+            "Not-A-Canonical-UUID");
+
+    instance.ResetPersistentUuid();
+    gd::SerializerElement resetElement;
+    instance.SerializeTo(resetElement);
+    REQUIRE(resetElement.GetStringAttribute("persistentUuid").size() == 36);
+    REQUIRE(resetElement.GetStringAttribute("persistentUuid") !=
+            "Not-A-Canonical-UUID");
+  }
 }
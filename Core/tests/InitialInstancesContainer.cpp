@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <initializer_list>
+#include <limits>
 #include <map>
 
 #include "GDCore/CommonTools.h"
@@ -226,3 +227,223 @@ TEST_CASE("InitialInstancesContainer", "[common][instances]") {
     REQUIRE(container.SomeInstancesAreOnLayer("layer5") == false);
   }
 }
+
+class InstancesPointersFunctor : public gd::InitialInstanceFunctor {
+ public:
+  void operator()(gd::InitialInstance &instance) {
+    instances.push_back(&instance);
+  }
+
+  std::vector<const gd::InitialInstance *> GetSortedInstances() {
+    std::sort(instances.begin(), instances.end());
+    return instances;
+  }
+
+ private:
+  std::vector<const gd::InitialInstance *> instances;
+};
+
+std::vector<const gd::InitialInstance *> GetInstancesInRegion(
+    gd::InitialInstancesContainer &container,
+    const gd::String &layer,
+    double left,
+    double top,
+    double right,
+    double bottom) {
+  InstancesPointersFunctor func;
+  container.IterateOverInstancesInRegion(func, layer, left, top, right, bottom);
+  return func.GetSortedInstances();
+}
+
+std::vector<const gd::InitialInstance *> GetInstancesAtPoint(
+    gd::InitialInstancesContainer &container,
+    const gd::String &layer,
+    double x,
+    double y) {
+  InstancesPointersFunctor func;
+  container.IterateOverInstancesAtPoint(func, layer, x, y);
+  return func.GetSortedInstances();
+}
+
+struct SpatialQueriesInstances {
+  gd::InitialInstance *tile;
+  gd::InitialInstance *player;
+  gd::InitialInstance *background;
+};
+
+SpatialQueriesInstances InsertSpatialQueriesInstances(
+    gd::InitialInstancesContainer &container) {
+  auto &tile = container.InsertNewInitialInstance();
+  tile.SetObjectName("Tile");
+  tile.SetX(100);
+  tile.SetY(100);
+  tile.SetHasCustomSize(true);
+  tile.SetCustomWidth(32);
+  tile.SetCustomHeight(32);
+  auto &player = container.InsertNewInitialInstance();
+  player.SetObjectName("Player");
+  player.SetX(500);
+  player.SetY(-300);
+  auto &background = container.InsertNewInitialInstance();
+  background.SetObjectName("Background");
+  background.SetLayer("Background");
+  background.SetHasCustomSize(true);
+  background.SetCustomWidth(100000);
+  background.SetCustomHeight(100000);
+
+  return SpatialQueriesInstances{&tile, &player, &background};
+}
+
+TEST_CASE("InitialInstancesContainer spatial queries", "[common][instances]") {
+  std::vector<const gd::InitialInstance *> expectedNone;
+
+  SECTION("Instances are found by their bounding box") {
+    for (bool isIndexEnabled : {false, true}) {
+      gd::InitialInstancesContainer container;
+      container.SetSpatialIndexEnabled(isIndexEnabled);
+      REQUIRE(container.IsSpatialIndexEnabled() == isIndexEnabled);
+      auto instances = InsertSpatialQueriesInstances(container);
+
+      std::vector<const gd::InitialInstance *> expectedTile{instances.tile};
+      std::vector<const gd::InitialInstance *> expectedPlayer{
+          instances.player};
+      std::vector<const gd::InitialInstance *> expectedBackground{
+          instances.background};
+      REQUIRE(GetInstancesAtPoint(container, "", 110, 120) == expectedTile);
+      REQUIRE(GetInstancesAtPoint(container, "", 132, 132) == expectedTile);
+      REQUIRE(GetInstancesAtPoint(container, "", 133, 120) == expectedNone);
+      REQUIRE(GetInstancesInRegion(container, "", 0, 0, 100, 100) ==
+              expectedTile);
+      REQUIRE(GetInstancesInRegion(container, "", 0, 0, 99, 100) ==
+              expectedNone);
+      REQUIRE(GetInstancesInRegion(container, "", 400, -400, 600, -200) ==
+              expectedPlayer);
+      REQUIRE(GetInstancesAtPoint(container, "Background", 55000, 70000) ==
+              expectedBackground);
+      REQUIRE(GetInstancesAtPoint(container, "Other", 110, 120) ==
+              expectedNone);
+
+      // Instances without custom size have the default size of their object.
+      REQUIRE(GetInstancesAtPoint(container, "", 510, -290) == expectedNone);
+      container.SetObjectDefaultSize("Player", 20, 20);
+      REQUIRE(GetInstancesAtPoint(container, "", 510, -290) ==
+              expectedPlayer);
+    }
+  }
+
+  SECTION("Moved, resized and removed instances are updated") {
+    for (bool isIndexEnabled : {false, true}) {
+      gd::InitialInstancesContainer container;
+      container.SetSpatialIndexEnabled(isIndexEnabled);
+      auto &tile = *InsertSpatialQueriesInstances(container).tile;
+
+      std::vector<const gd::InitialInstance *> expectedTile{&tile};
+      tile.SetX(-1000);
+      REQUIRE(GetInstancesAtPoint(container, "", 110, 120) == expectedNone);
+      REQUIRE(GetInstancesAtPoint(container, "", -990, 120) == expectedTile);
+
+      tile.SetCustomWidth(2000);
+      REQUIRE(GetInstancesAtPoint(container, "", 110, 120) == expectedTile);
+
+      tile.SetLayer("Other");
+      REQUIRE(GetInstancesAtPoint(container, "", 110, 120) == expectedNone);
+      REQUIRE(GetInstancesAtPoint(container, "Other", 110, 120) ==
+              expectedTile);
+
+      // An instance assigned from another one is also updated.
+      gd::InitialInstance otherTile;
+      otherTile.SetX(5000);
+      otherTile.SetY(5000);
+      tile = otherTile;
+      REQUIRE(GetInstancesAtPoint(container, "", 5000, 5000) == expectedTile);
+
+      container.RemoveInstance(tile);
+      REQUIRE(GetInstancesAtPoint(container, "", 5000, 5000) == expectedNone);
+    }
+  }
+
+  SECTION("Copies of the container have their own index") {
+    for (bool isIndexEnabled : {false, true}) {
+      gd::InitialInstancesContainer container;
+      container.SetSpatialIndexEnabled(isIndexEnabled);
+      auto &tile = *InsertSpatialQueriesInstances(container).tile;
+
+      gd::InitialInstancesContainer copy(container);
+      REQUIRE(copy.IsSpatialIndexEnabled() == isIndexEnabled);
+      auto copyInstances = GetInstancesAtPoint(copy, "", 110, 120);
+      REQUIRE(copyInstances.size() == 1);
+      REQUIRE(copyInstances[0] != &tile);
+
+      tile.SetX(-1000);
+      REQUIRE(GetInstancesAtPoint(copy, "", 110, 120) == copyInstances);
+
+      copy = container;
+      REQUIRE(GetInstancesAtPoint(copy, "", 110, 120) == expectedNone);
+      REQUIRE(GetInstancesAtPoint(copy, "", -990, 120).size() == 1);
+    }
+  }
+
+  SECTION("Regions without bounds give all the instances of the layer") {
+    const double infinity = std::numeric_limits<double>::infinity();
+    for (bool isIndexEnabled : {false, true}) {
+      gd::InitialInstancesContainer container;
+      container.SetSpatialIndexEnabled(isIndexEnabled);
+      auto instances = InsertSpatialQueriesInstances(container);
+      container.SetObjectDefaultSize("Player", 20, 20);
+
+      std::vector<const gd::InitialInstance *> expectedTileAndPlayer{
+          instances.tile, instances.player};
+      std::sort(expectedTileAndPlayer.begin(), expectedTileAndPlayer.end());
+      REQUIRE(GetInstancesInRegion(
+                  container, "", -infinity, -infinity, infinity, infinity) ==
+              expectedTileAndPlayer);
+      REQUIRE(GetInstancesInRegion(container, "", -1e300, -1e300, 1e300, 1e300) ==
+              expectedTileAndPlayer);
+
+      // Instances without bounds are found too.
+      auto &infiniteTile = *instances.tile;
+      infiniteTile.SetCustomWidth(infinity);
+      infiniteTile.SetCustomHeight(infinity);
+      std::vector<const gd::InitialInstance *> expectedTile{&infiniteTile};
+      REQUIRE(GetInstancesAtPoint(container, "", 1e200, 1e200) ==
+              expectedTile);
+      REQUIRE(GetInstancesInRegion(
+                  container, "", -infinity, -infinity, infinity, infinity) ==
+              expectedTileAndPlayer);
+    }
+  }
+
+  SECTION("Index gives the same instances as iterating over all instances") {
+    // Random instances of various sizes, some spanning many cells.
+    gd::InitialInstancesContainer randomContainer;
+    unsigned int seed = 42;
+    auto random = [&seed](int max) {
+      seed = seed * 1103515245 + 12345;
+      return static_cast<double>((seed >> 8) % max);
+    };
+    for (std::size_t i = 0; i < 2000; ++i) {
+      auto &instance = randomContainer.InsertNewInitialInstance();
+      instance.SetX(random(20000) - 10000);
+      instance.SetY(random(20000) - 10000);
+      instance.SetLayer(i % 3 == 0 ? "Other" : "");
+      instance.SetHasCustomSize(true);
+      instance.SetCustomWidth(i % 50 == 0 ? random(20000) : random(300));
+      instance.SetCustomHeight(i % 50 == 0 ? random(20000) : random(300));
+    }
+
+    for (std::size_t i = 0; i < 200; ++i) {
+      double left = random(24000) - 12000;
+      double top = random(24000) - 12000;
+      double right = left + random(i % 10 == 0 ? 24000 : 1000);
+      double bottom = top + random(i % 10 == 0 ? 24000 : 1000);
+
+      randomContainer.SetSpatialIndexEnabled(false);
+      auto expectedInstances =
+          GetInstancesInRegion(randomContainer, "", left, top, right, bottom);
+      randomContainer.SetSpatialIndexEnabled(true);
+      REQUIRE(GetInstancesInRegion(
+                  randomContainer, "", left, top, right, bottom) ==
+              expectedInstances);
+    }
+  }
+}
@@ -0,0 +1,106 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of the spatial queries on the initial instances.
+ */
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "catch.hpp"
+
+namespace {
+
+class InstancesCounter : public gd::InitialInstanceFunctor {
+ public:
+  InstancesCounter() : count(0){};
+  void operator()(gd::InitialInstance &instance) override { count++; }
+
+  std::size_t count;
+};
+
+}  // namespace
+
+TEST_CASE("InitialInstancesContainer - Benchmarks", "[common][instances]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  // A tile map of 1000x1000 tiles of 32x32 pixels.
+  gd::InitialInstancesContainer container;
+  std::vector<gd::InitialInstance *> instances;
+  for (size_t x = 0; x < 1000; x++) {
+    for (size_t y = 0; y < 1000; y++) {
+      auto &instance = container.InsertNewInitialInstance();
+      instance.SetObjectName("Tile");
+      instance.SetX(x * 32);
+      instance.SetY(y * 32);
+      instances.push_back(&instance);
+    }
+  }
+  container.SetObjectDefaultSize("Tile", 32, 32);
+
+  // Regions of the size of a screen (about 1000 tiles).
+  InstancesCounter counter;
+  auto queryScreens = [&](size_t regionsCount) {
+    counter.count = 0;
+    for (size_t i = 0; i < regionsCount; i++) {
+      double left = (i * 311) % 30000;
+      double top = (i * 173) % 30000;
+      container.IterateOverInstancesInRegion(
+          counter, "", left, top, left + 1280, top + 720);
+    }
+  };
+
+  doBenchmark("Query 10 regions in 1000000 instances without index", 1, [&]() {
+    queryScreens(10);
+  });
+  const std::size_t countWithoutIndex = counter.count;
+
+  doBenchmark("Enable the index of 1000000 instances", 1, [&]() {
+    container.SetSpatialIndexEnabled(true);
+  });
+
+  doBenchmark("Query 10 regions in 1000000 instances with index", 1, [&]() {
+    queryScreens(10);
+  });
+  REQUIRE(counter.count == countWithoutIndex);
+
+  doBenchmark("Query 1000 regions in 1000000 instances with index", 3, [&]() {
+    queryScreens(1000);
+  });
+
+  doBenchmark("Move 10000 of 1000000 indexed instances", 3, [&]() {
+    for (size_t i = 0; i < 10000; i++) {
+      auto &instance = *instances[(i * 97) % instances.size()];
+      instance.SetX(instance.GetX() + 1);
+    }
+  });
+
+  REQUIRE(container.GetInstancesCount() == 1000000);
+}
@@ -0,0 +1,92 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the interned strings and their use as keys.
+ */
+#include "GDCore/Tools/InternedString.h"
+
+#include <unordered_map>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("InternedString", "[common][tools]") {
+  SECTION("Equal strings are interned once") {
+    gd::InternedString a("MyExtension::DoSomething");
+    gd::InternedString b(gd::String("MyExtension::") + "DoSomething");
+    gd::InternedString c("MyExtension::DoSomethingElse");
+    REQUIRE(a == b);
+    REQUIRE(a != c);
+    REQUIRE(a.GetId() == b.GetId());
+    REQUIRE(a.GetId() != c.GetId());
+    REQUIRE(a.GetHash() == std::hash<gd::String>()("MyExtension::DoSomething"));
+    REQUIRE(&a.GetString() == &b.GetString());
+    REQUIRE(c.GetString() == "MyExtension::DoSomethingElse");
+
+    std::size_t internedStringsCount =
+        gd::InternedString::GetInternedStringsCount();
+    gd::InternedString d("MyExtension::DoSomething");
+    REQUIRE(gd::InternedString::GetInternedStringsCount() ==
+            internedStringsCount);
+  }
+
+  SECTION("Empty string") {
+    gd::InternedString empty;
+    REQUIRE(empty.empty());
+    REQUIRE(empty.GetId() == 0);
+    REQUIRE(empty == gd::InternedString(""));
+    REQUIRE(empty.GetString() == "");
+  }
+
+  SECTION("Interned strings as keys") {
+    std::unordered_map<gd::InternedString, int> map;
+    map[gd::InternedString("A")] = 1;
+    map[gd::InternedString("B")] = 2;
+    REQUIRE(map[gd::InternedString("A")] == 1);
+    REQUIRE(map.find(gd::InternedString("C")) == map.end());
+  }
+
+  SECTION("Instructions and behaviors types are interned") {
+    gd::Instruction instruction("MyExtension::DoSomething");
+    REQUIRE(instruction.GetInternedType() ==
+            gd::InternedString("MyExtension::DoSomething"));
+    instruction.SetType("MyExtension::DoSomethingElse");
+    REQUIRE(instruction.GetType() == "MyExtension::DoSomethingElse");
+    REQUIRE(instruction.GetInternedType() ==
+            gd::InternedString("MyExtension::DoSomethingElse"));
+
+    gd::Behavior behavior("MyBehavior", "MyExtension::MyBehavior");
+    REQUIRE(behavior.GetInternedTypeName() ==
+            gd::InternedString("MyExtension::MyBehavior"));
+  }
+
+  SECTION("Metadata are found from interned types") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    gd::Instruction action("MyExtension::DoSomething");
+    REQUIRE(&gd::MetadataProvider::GetActionMetadata(
+                platform, action.GetInternedType()) ==
+            &gd::MetadataProvider::GetActionMetadata(platform,
+                                                     action.GetType()));
+    REQUIRE(!gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                action.GetInternedType())));
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetConditionMetadata(
+            platform, gd::InternedString("MyExtension::NotExisting"))));
+    REQUIRE(!gd::MetadataProvider::IsBadBehaviorMetadata(
+        gd::MetadataProvider::GetBehaviorMetadata(
+            platform, gd::InternedString("MyExtension::MyBehavior"))));
+  }
+}
@@ -7,6 +7,14 @@
  * @file Tests covering common features of GDevelop Core.
  */
 #include "GDCore/IDE/NewNameGenerator.h"
+
+#include <unordered_set>
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
 #include "GDCore/String.h"
 #include "catch.hpp"
 
@@ -29,4 +37,86 @@ TEST_CASE("NewNameGenerator", "[common]") {
                          name == "abcTest2";
                 }) == "abcTest3");
   }
+
+  SECTION("Batch generation gives the same names as sequential generation") {
+    std::vector<gd::String> existingNames{"Enemy", "CopyOfEnemy3", "Player"};
+    std::vector<gd::String> names;
+    for (std::size_t i = 0; i < 500; ++i) {
+      names.push_back("Enemy");
+      names.push_back("Player");
+      names.push_back("Enemy");
+    }
+    names.push_back("Bullet");
+
+    std::unordered_set<gd::String> usedNames(existingNames.begin(),
+                                             existingNames.end());
+    std::vector<gd::String> expectedNames;
+    for (const auto &name : names) {
+      gd::String newName = gd::NewNameGenerator::Generate(
+          name, "CopyOf", [&usedNames](const gd::String &name) {
+            return usedNames.find(name) != usedNames.end();
+          });
+      usedNames.insert(newName);
+      expectedNames.push_back(newName);
+    }
+
+    auto newNames =
+        gd::NewNameGenerator::GenerateAll(names, "CopyOf", existingNames);
+    REQUIRE(newNames == expectedNames);
+    REQUIRE(newNames[0] == "CopyOfEnemy");
+    REQUIRE(newNames[1] == "CopyOfPlayer");
+    REQUIRE(newNames[2] == "CopyOfEnemy2");
+    REQUIRE(newNames[3] == "CopyOfEnemy4");
+    REQUIRE(newNames.back() == "Bullet");
+  }
+
+  SECTION("Batch generation increments the number ending the names") {
+    std::vector<gd::String> expectedNames{
+        "Enemy3", "Enemy4", "Enemy008", "Enemy009", "Enemy5"};
+    REQUIRE(gd::NewNameGenerator::GenerateAll(
+                {"Enemy2", "Enemy2", "Enemy007", "Enemy007", "Enemy"},
+                "",
+                {"Enemy", "Enemy2", "Enemy007"}) == expectedNames);
+
+    std::vector<gd::String> expectedNamesWithPrefix{"CopyOfEnemy3"};
+    REQUIRE(gd::NewNameGenerator::GenerateAll(
+                {"Enemy2"}, "CopyOf", {"Enemy2", "CopyOfEnemy2"}) ==
+            expectedNamesWithPrefix);
+  }
+
+  SECTION("Names of containers elements") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    project.InsertNewObject(project, "MyExtension::Sprite", "GlobalObject", 0);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+    layout.GetObjectGroups().InsertNew("MyGroup", 0);
+    layout.InsertNewLayer("MyLayer", 0);
+    layout.GetVariables().InsertNew("MyVariable", 0);
+
+    std::vector<gd::String> expectedObjectNames{
+        "GlobalObject2", "MyObject2", "MyGroup2", "MyObject3", "Other"};
+    REQUIRE(gd::NewNameGenerator::GenerateAllObjectNames(
+                {"GlobalObject", "MyObject", "MyGroup", "MyObject", "Other"},
+                "",
+                project,
+                layout) == expectedObjectNames);
+
+    std::vector<gd::String> expectedLayerNames{"MyLayer2", "MyLayer3"};
+    REQUIRE(gd::NewNameGenerator::GenerateAllLayerNames(
+                {"MyLayer", "MyLayer"}, "", layout) == expectedLayerNames);
+
+    std::vector<gd::String> expectedVariableNames{"MyVariable2",
+                                                  "OtherVariable"};
+    REQUIRE(gd::NewNameGenerator::GenerateAllVariableNames(
+                {"MyVariable", "OtherVariable"},
+                "",
+                layout.GetVariables()) == expectedVariableNames);
+
+    std::vector<gd::String> expectedResourceNames{"image.png"};
+    REQUIRE(gd::NewNameGenerator::GenerateAllResourceNames(
+                {"image.png"}, "", project.GetResourcesManager()) ==
+            expectedResourceNames);
+  }
 }
@@ -0,0 +1,133 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the lookup of objects and groups by name.
+ */
+#include "GDCore/Project/ObjectsContainer.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("ObjectsContainer", "[common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  SECTION("Objects lookup") {
+    gd::ObjectsContainer container;
+    for (std::size_t i = 0; i < 100; ++i) {
+      container.InsertNewObject(
+          project, "MyExtension::Sprite", "Object" + gd::String::From(i), -1);
+    }
+    container.InsertNewObject(project, "MyExtension::Sprite", "First", 0);
+
+    REQUIRE(container.HasObjectNamed("First"));
+    REQUIRE(container.HasObjectNamed("Object99"));
+    REQUIRE_FALSE(container.HasObjectNamed("Object100"));
+    REQUIRE(container.GetObjectPosition("First") == 0);
+    REQUIRE(container.GetObjectPosition("Object0") == 1);
+    REQUIRE(container.GetObjectPosition("Object99") == 100);
+    REQUIRE(container.GetObjectPosition("Object100") == gd::String::npos);
+    REQUIRE(container.GetObject("Object42").GetName() == "Object42");
+
+    // Rename objects
+    container.GetObject("Object42").SetName("Renamed");
+    REQUIRE_FALSE(container.HasObjectNamed("Object42"));
+    REQUIRE(container.GetObjectPosition("Renamed") == 43);
+
+    // Move and swap objects
+    container.MoveObject(0, 100);
+    REQUIRE(container.GetObjectPosition("First") == 100);
+    REQUIRE(container.GetObjectPosition("Object0") == 0);
+    container.SwapObjects(0, 1);
+    REQUIRE(container.GetObjectPosition("Object0") == 1);
+    REQUIRE(container.GetObjectPosition("Object1") == 0);
+
+    // Remove objects
+    container.RemoveObject("Object1");
+    REQUIRE_FALSE(container.HasObjectNamed("Object1"));
+    REQUIRE(container.GetObjectPosition("Object0") == 0);
+    REQUIRE(container.GetObjectPosition("First") == 99);
+
+    // Move objects to another container
+    gd::ObjectsContainer otherContainer;
+    otherContainer.InsertNewObject(
+        project, "MyExtension::Sprite", "OtherObject", 0);
+    REQUIRE(otherContainer.HasObjectNamed("OtherObject"));
+    container.MoveObjectToAnotherContainer("Object0", otherContainer, 0);
+    REQUIRE_FALSE(container.HasObjectNamed("Object0"));
+    REQUIRE(container.GetObjectPosition("Object2") == 0);
+    REQUIRE(otherContainer.GetObjectPosition("Object0") == 0);
+    REQUIRE(otherContainer.GetObjectPosition("OtherObject") == 1);
+
+    // Modify the objects directly
+    container.GetObjects().clear();
+    REQUIRE_FALSE(container.HasObjectNamed("Object2"));
+  }
+
+  SECTION("Copied objects lookup") {
+    gd::Layout layout;
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+    REQUIRE(layout.HasObjectNamed("MyObject"));
+
+    gd::Layout otherLayout;
+    otherLayout.InsertNewObject(project, "MyExtension::Sprite", "Other", 0);
+    REQUIRE(otherLayout.HasObjectNamed("Other"));
+    otherLayout = layout;
+    REQUIRE(otherLayout.HasObjectNamed("MyObject"));
+    REQUIRE_FALSE(otherLayout.HasObjectNamed("Other"));
+
+    gd::Layout copiedLayout(layout);
+    REQUIRE(copiedLayout.HasObjectNamed("MyObject"));
+  }
+
+  SECTION("Groups lookup") {
+    gd::ObjectGroupsContainer groups;
+    for (std::size_t i = 0; i < 100; ++i) {
+      groups.InsertNew("Group" + gd::String::From(i), -1);
+    }
+
+    REQUIRE(groups.Has("Group0"));
+    REQUIRE(groups.Has("Group99"));
+    REQUIRE_FALSE(groups.Has("Group100"));
+    REQUIRE(groups.GetPosition("Group42") == 42);
+    REQUIRE(groups.Get("Group42").GetName() == "Group42");
+
+    // Rename groups
+    REQUIRE(groups.Rename("Group42", "Renamed"));
+    REQUIRE_FALSE(groups.Has("Group42"));
+    REQUIRE(groups.GetPosition("Renamed") == 42);
+    groups.Get("Renamed").SetName("RenamedAgain");
+    REQUIRE(groups.GetPosition("RenamedAgain") == 42);
+
+    // Move and remove groups
+    groups.Move(0, 99);
+    REQUIRE(groups.GetPosition("Group0") == 99);
+    REQUIRE(groups.GetPosition("Group1") == 0);
+    groups.Remove("Group1");
+    REQUIRE_FALSE(groups.Has("Group1"));
+    REQUIRE(groups.GetPosition("Group0") == 98);
+
+    // Insert groups
+    gd::ObjectGroup group;
+    group.SetName("Inserted");
+    groups.Insert(group, 0);
+    REQUIRE(groups.GetPosition("Inserted") == 0);
+    REQUIRE(groups.GetPosition("Group0") == 99);
+
+    gd::ObjectGroupsContainer copiedGroups(groups);
+    REQUIRE(copiedGroups.GetPosition("Group0") == 99);
+
+    groups.Clear();
+    REQUIRE_FALSE(groups.Has("Group0"));
+  }
+}
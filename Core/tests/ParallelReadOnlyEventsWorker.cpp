@@ -0,0 +1,135 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the events workers run in parallel on the events of a
+ * project.
+ */
+#include "GDCore/IDE/Events/ParallelReadOnlyEventsWorker.h"
+
+#include <memory>
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/InstructionsCountEvaluator.h"
+#include "GDCore/IDE/ProjectBrowserHelper.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+class InstructionsTypesLister : public gd::ParallelReadOnlyEventsWorker {
+ public:
+  InstructionsTypesLister(){};
+  virtual ~InstructionsTypesLister(){};
+
+  std::unique_ptr<gd::ParallelReadOnlyEventsWorker> Clone() const override {
+    return std::unique_ptr<gd::ParallelReadOnlyEventsWorker>(
+        new InstructionsTypesLister());
+  }
+
+  void Reduce(const gd::ParallelReadOnlyEventsWorker& clone) override {
+    const auto& cloneTypes =
+        static_cast<const InstructionsTypesLister&>(clone).types;
+    types.insert(types.end(), cloneTypes.begin(), cloneTypes.end());
+  }
+
+  std::vector<gd::String> types;
+
+ private:
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override {
+    // Check that the objects containers are given to the clones.
+    if (GetObjectsContainer().HasObjectNamed("Object") ||
+        GetGlobalObjectsContainer().HasObjectNamed("Object"))
+      types.push_back(instruction.GetType() + "(Object)");
+    else
+      types.push_back(instruction.GetType());
+  }
+};
+
+gd::StandardEvent MakeEventWithActions(const std::vector<gd::String>& types) {
+  gd::StandardEvent event;
+  for (const auto& type : types) {
+    gd::Instruction action;
+    action.SetType(type);
+    event.GetActions().Insert(action);
+  }
+  return event;
+}
+
+}  // namespace
+
+TEST_CASE("ParallelReadOnlyEventsWorker", "[common][events]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  for (std::size_t i = 0; i < 20; ++i) {
+    auto& layout = project.InsertNewLayout("Scene" + gd::String::From(i), i);
+    layout.GetEvents().InsertEvent(
+        MakeEventWithActions({"Layout" + gd::String::From(i), "Other"}));
+  }
+  project.GetLayout(0).InsertNewObject(
+      project, "MyExtension::Sprite", "Object", 0);
+  auto& externalEvents = project.InsertNewExternalEvents("External", 0);
+  externalEvents.SetAssociatedLayout("Scene0");
+  externalEvents.GetEvents().InsertEvent(MakeEventWithActions({"External"}));
+  auto& freeExternalEvents = project.InsertNewExternalEvents("FreeExternal", 1);
+  freeExternalEvents.GetEvents().InsertEvent(
+      MakeEventWithActions({"FreeExternal"}));
+
+  auto& extension =
+      project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+  extension.InsertNewEventsFunction("MyFunction", 0)
+      .GetEvents()
+      .InsertEvent(MakeEventWithActions({"Function"}));
+  extension.GetEventsBasedBehaviors()
+      .InsertNew("MyBehavior", 0)
+      .GetEventsFunctions()
+      .InsertNewEventsFunction("MyBehaviorFunction", 0)
+      .GetEvents()
+      .InsertEvent(MakeEventWithActions({"BehaviorFunction"}));
+
+  std::vector<gd::String> expectedTypes{"Layout0(Object)", "Other(Object)"};
+  for (std::size_t i = 1; i < 20; ++i) {
+    expectedTypes.push_back("Layout" + gd::String::From(i));
+    expectedTypes.push_back("Other");
+  }
+  expectedTypes.push_back("External(Object)");
+
+  SECTION("Results are reduced in the order of the events") {
+    for (std::size_t threadsCount : {1, 4, 0}) {
+      InstructionsTypesLister worker;
+      gd::ProjectBrowserHelper::ExposeProjectEventsInParallel(
+          project, worker, threadsCount);
+
+      auto expectedProjectTypes = expectedTypes;
+      expectedProjectTypes.push_back("Function");
+      expectedProjectTypes.push_back("BehaviorFunction");
+      REQUIRE(worker.types == expectedProjectTypes);
+    }
+  }
+
+  SECTION("External events without layout are given without extensions") {
+    for (std::size_t threadsCount : {1, 4}) {
+      InstructionsTypesLister worker;
+      gd::ProjectBrowserHelper::ExposeProjectEventsWithoutExtensionsInParallel(
+          project, worker, threadsCount);
+
+      auto expectedProjectTypes = expectedTypes;
+      expectedProjectTypes.push_back("FreeExternal");
+      REQUIRE(worker.types == expectedProjectTypes);
+    }
+
+    REQUIRE(gd::InstructionsCountEvaluator::ScanProject(project) == 42);
+  }
+}
@@ -0,0 +1,158 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the cache of parsed expressions.
+ */
+#include "GDCore/Events/Parsers/ParsedExpressionsCache.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("ParsedExpressionsCache", "[common][events]") {
+  SECTION("Nodes are shared between identical expressions") {
+    gd::ParsedExpressionsCache cache;
+    gd::Expression expression1("MyObject.X() + 1");
+    gd::Expression expression2("MyObject.X() + 1");
+    gd::Expression expression3("MyObject.Y() + 1");
+
+    auto node1 = expression1.GetRootNode(cache);
+    auto node2 = expression2.GetRootNode(cache);
+    auto node3 = expression3.GetRootNode(cache);
+    REQUIRE(node1 != nullptr);
+    REQUIRE(node1 == node2);
+    REQUIRE(node1 != node3);
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*node1) ==
+            "MyObject.X() + 1");
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*node3) ==
+            "MyObject.Y() + 1");
+
+    REQUIRE(cache.GetSize() == 2);
+    REQUIRE(cache.GetMissesCount() == 2);
+    REQUIRE(cache.GetHitsCount() == 1);
+
+    // Nodes are kept by expressions, even copied.
+    REQUIRE(expression1.GetRootNode(cache) == node1);
+    gd::Expression copiedExpression(expression1);
+    REQUIRE(copiedExpression.GetRootNode(cache) == node1);
+    REQUIRE(cache.GetHitsCount() == 1);
+
+    cache.ResetCounters();
+    REQUIRE(cache.GetMissesCount() == 0);
+    REQUIRE(cache.GetHitsCount() == 0);
+  }
+
+  SECTION("Nodes that can be modified are not shared") {
+    gd::ParsedExpressionsCache cache;
+    gd::Expression expression1("MyObject.X() + 1");
+    gd::Expression expression2("MyObject.X() + 1");
+
+    auto sharedNode = expression1.GetRootNode(cache);
+    auto node = expression1.GetRootNode();
+    REQUIRE(node != nullptr);
+    REQUIRE(node != sharedNode);
+
+    // The node can be modified without changing the shared one.
+    auto& operatorNode = dynamic_cast<gd::OperatorNode&>(*node);
+    dynamic_cast<gd::FunctionCallNode&>(*operatorNode.leftHandSide)
+        .objectName = "MyOtherObject";
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*node) ==
+            "MyOtherObject.X() + 1");
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(
+                *expression2.GetRootNode(cache)) == "MyObject.X() + 1");
+  }
+
+  SECTION("The cache is bounded") {
+    gd::ParsedExpressionsCache cache(2);
+    auto node1 = cache.GetRootNode("1");
+    cache.GetRootNode("2");
+    REQUIRE(cache.GetRootNode("1") == node1);
+    cache.GetRootNode("3");
+
+    // "2" was the least recently used expression.
+    REQUIRE(cache.GetSize() == 2);
+    REQUIRE(cache.GetRootNode("1") == node1);
+    REQUIRE(cache.GetMissesCount() == 3);
+    REQUIRE(cache.GetHitsCount() == 2);
+    cache.GetRootNode("2");
+    REQUIRE(cache.GetMissesCount() == 4);
+
+    cache.SetMaximumSize(1);
+    REQUIRE(cache.GetSize() == 1);
+    cache.Clear();
+    REQUIRE(cache.GetSize() == 0);
+  }
+
+  SECTION("Code generation parses each distinct expression once") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto& layout = project.InsertNewLayout("Scene", 0);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+    gd::StandardEvent event;
+    for (std::size_t i = 0; i < 100; i++) {
+      gd::Instruction action;
+      action.SetType("MyExtension::DoSomething");
+      action.SetParametersCount(1);
+      action.SetParameter(
+          0,
+          gd::Expression("MySpriteObject.GetObjectNumber() + " +
+                         gd::String::From(i % 10)));
+      event.GetActions().Insert(action);
+    }
+
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+    REQUIRE(codeGenerator.GetParsedExpressionsCache() ==
+            &project.GetParsedExpressionsCache());
+    unsigned int maxDepth = 0;
+    gd::EventsCodeGenerationContext context(&maxDepth);
+    gd::String code =
+        codeGenerator.GenerateActionsListCode(event.GetActions(), context);
+    REQUIRE(code.find("doSomething(") != gd::String::npos);
+
+    REQUIRE(project.GetParsedExpressionsCache().GetMissesCount() == 10);
+    REQUIRE(project.GetParsedExpressionsCache().GetHitsCount() == 90);
+  }
+
+  SECTION("Validation parses each distinct expression once") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto& layout = project.InsertNewLayout("Scene", 0);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+    gd::ParsedExpressionsCache cache;
+    for (std::size_t i = 0; i < 10; i++) {
+      REQUIRE(gd::ExpressionValidator::HasNoErrors(
+          platform,
+          project,
+          layout,
+          "number",
+          gd::Expression("MySpriteObject.GetObjectNumber() + 1"),
+          cache));
+      REQUIRE_FALSE(gd::ExpressionValidator::HasNoErrors(
+          platform,
+          project,
+          layout,
+          "number",
+          gd::Expression("MyUnknownObject.GetObjectNumber() + 1"),
+          cache));
+    }
+
+    REQUIRE(cache.GetMissesCount() == 2);
+    REQUIRE(cache.GetHitsCount() == 18);
+  }
+}
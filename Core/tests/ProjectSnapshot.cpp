@@ -0,0 +1,128 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the snapshots of projects sharing their content.
+ */
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
+#include "GDCore/IDE/ProjectStripper.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+class AudioRenamerWorker : public gd::ArbitraryResourceWorker {
+ public:
+  virtual void ExposeFile(gd::String& file){};
+  virtual void ExposeAudio(gd::String& audioName) {
+    if (audioName == "legacy.wav") audioName = "renamed.wav";
+  };
+};
+
+gd::StandardEvent MakeEventUsingAudio(const gd::String& audioName) {
+  gd::StandardEvent event;
+  gd::Instruction instruction;
+  instruction.SetType("MyExtension::DoSomethingWithResources");
+  instruction.SetParametersCount(3);
+  instruction.SetParameter(0, "");
+  instruction.SetParameter(1, "");
+  instruction.SetParameter(2, audioName);
+  event.GetActions().Insert(instruction);
+  return event;
+}
+
+const gd::String& GetAudioParameter(const gd::Layout& layout) {
+  const auto& event =
+      dynamic_cast<const gd::StandardEvent&>(layout.GetEvents().GetEvent(0));
+  return event.GetActions()[0].GetParameter(2).GetPlainString();
+}
+
+}  // namespace
+
+TEST_CASE("ProjectSnapshot", "[common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  project.GetResourcesManager().AddResource("Audio", "audio.wav", "audio");
+
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  layout.GetEvents().InsertEvent(MakeEventUsingAudio("Audio"));
+  layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+      "MyObject");
+
+  SECTION("Content is shared until modified") {
+    gd::Project snapshot;
+    snapshot.InitAsSnapshotOf(project);
+    const gd::Project& constSnapshot = snapshot;
+    const gd::Layout& snapshotLayout = constSnapshot.GetLayout("Scene");
+
+    REQUIRE(&snapshotLayout != &layout);
+    REQUIRE(snapshotLayout.HasSharedEvents());
+    REQUIRE(&snapshotLayout.GetEvents() == &layout.GetEvents());
+    REQUIRE(&snapshotLayout.GetInitialInstances() ==
+            &layout.GetInitialInstances());
+    REQUIRE(&constSnapshot.GetResourcesManager() ==
+            &project.GetResourcesManager());
+
+    // Modify the snapshot: the original project is unchanged.
+    snapshot.GetLayout("Scene").GetEvents().InsertEvent(
+        MakeEventUsingAudio("Audio"));
+    snapshot.GetLayout("Scene").GetInitialInstances().RemoveAllInstancesOnLayer(
+        "");
+    snapshot.GetResourcesManager().RemoveResource("Audio");
+    REQUIRE_FALSE(snapshotLayout.HasSharedEvents());
+    REQUIRE(snapshotLayout.GetEvents().GetEventsCount() == 2);
+    REQUIRE(snapshotLayout.GetInitialInstances().GetInstancesCount() == 0);
+    REQUIRE_FALSE(snapshot.GetResourcesManager().HasResource("Audio"));
+
+    REQUIRE(layout.GetEvents().GetEventsCount() == 1);
+    REQUIRE(layout.GetInitialInstances().GetInstancesCount() == 1);
+    REQUIRE(project.GetResourcesManager().HasResource("Audio"));
+  }
+
+  SECTION("Copies of a snapshot are independent") {
+    gd::Project snapshot;
+    snapshot.InitAsSnapshotOf(project);
+    gd::Project copy(snapshot);
+    const gd::Project& constCopy = copy;
+    REQUIRE_FALSE(constCopy.GetLayout("Scene").HasSharedEvents());
+    REQUIRE(&constCopy.GetLayout("Scene").GetEvents() != &layout.GetEvents());
+    REQUIRE(constCopy.GetLayout("Scene").GetEvents().GetEventsCount() == 1);
+  }
+
+  SECTION("Exposing resources only copies the events using renamed files") {
+    auto& legacyLayout = project.InsertNewLayout("Legacy scene", 1);
+    legacyLayout.GetEvents().InsertEvent(MakeEventUsingAudio("legacy.wav"));
+
+    gd::Project snapshot;
+    snapshot.InitAsSnapshotOf(project);
+    AudioRenamerWorker worker;
+    snapshot.ExposeResources(worker);
+
+    const gd::Project& constSnapshot = snapshot;
+    REQUIRE(constSnapshot.GetLayout("Scene").HasSharedEvents());
+    REQUIRE_FALSE(constSnapshot.GetLayout("Legacy scene").HasSharedEvents());
+    REQUIRE(GetAudioParameter(constSnapshot.GetLayout("Legacy scene")) ==
+            "renamed.wav");
+    REQUIRE(GetAudioParameter(legacyLayout) == "legacy.wav");
+  }
+
+  SECTION("Stripping a snapshot does not change the original project") {
+    gd::Project snapshot;
+    snapshot.InitAsSnapshotOf(project);
+    gd::ProjectStripper::StripProjectForExport(snapshot);
+
+    const gd::Project& constSnapshot = snapshot;
+    REQUIRE(constSnapshot.GetLayout("Scene").GetEvents().IsEmpty());
+    REQUIRE(&constSnapshot.GetLayout("Scene").GetInitialInstances() ==
+            &layout.GetInitialInstances());
+    REQUIRE(layout.GetEvents().GetEventsCount() == 1);
+  }
+}
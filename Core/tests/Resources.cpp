@@ -32,4 +32,53 @@ TEST_CASE("Resources", "[common][resources]") {
     image.SetFile("Lots\\\\Of\\\\\\..\\Backslashs");
     REQUIRE(image.GetFile() == "Lots//Of///../Backslashs");
   }
+  SECTION("Resources lookup") {
+    gd::ResourcesManager resourcesManager;
+    for (std::size_t i = 0; i < 100; ++i) {
+      resourcesManager.AddResource(
+          "Resource" + gd::String::From(i), "file.png", "image");
+    }
+
+    REQUIRE(resourcesManager.HasResource("Resource0"));
+    REQUIRE(resourcesManager.HasResource("Resource99"));
+    REQUIRE_FALSE(resourcesManager.HasResource("Resource100"));
+    REQUIRE(resourcesManager.GetResourcePosition("Resource42") == 42);
+    REQUIRE(resourcesManager.GetResource("Resource42").GetName() ==
+            "Resource42");
+    REQUIRE(resourcesManager.GetResourceSPtr("Resource100") == nullptr);
+
+    gd::ImageResource image;
+    image.SetName("Resource0");
+    REQUIRE_FALSE(resourcesManager.AddResource(image));
+    image.SetName("NewResource");
+    REQUIRE(resourcesManager.AddResource(image));
+    REQUIRE(resourcesManager.GetResourcePosition("NewResource") == 100);
+
+    // Rename resources
+    resourcesManager.RenameResource("Resource42", "Renamed");
+    REQUIRE_FALSE(resourcesManager.HasResource("Resource42"));
+    REQUIRE(resourcesManager.GetResourcePosition("Renamed") == 42);
+    resourcesManager.GetResource("Renamed").SetName("RenamedAgain");
+    REQUIRE_FALSE(resourcesManager.HasResource("Renamed"));
+    REQUIRE(resourcesManager.GetResourcePosition("RenamedAgain") == 42);
+
+    // Renaming a copy of a resource does not change the original one
+    gd::ResourcesManager otherResourcesManager = resourcesManager;
+    otherResourcesManager.GetResource("RenamedAgain").SetName("Other");
+    REQUIRE(otherResourcesManager.HasResource("Other"));
+    REQUIRE(resourcesManager.GetResourcePosition("RenamedAgain") == 42);
+    REQUIRE_FALSE(resourcesManager.HasResource("Other"));
+    resourcesManager.GetResource("RenamedAgain").SetName("Renamed");
+
+    // Move and remove resources
+    REQUIRE(resourcesManager.MoveResourceUpInList("Resource1"));
+    REQUIRE(resourcesManager.GetResourcePosition("Resource1") == 0);
+    REQUIRE(resourcesManager.GetResourcePosition("Resource0") == 1);
+    resourcesManager.MoveResource(0, 100);
+    REQUIRE(resourcesManager.GetResourcePosition("Resource1") == 100);
+    resourcesManager.RemoveResource("Resource0");
+    REQUIRE_FALSE(resourcesManager.HasResource("Resource0"));
+    REQUIRE(resourcesManager.GetResourcePosition("Resource2") == 0);
+    REQUIRE(resourcesManager.GetResourcePosition("Resource1") == 99);
+  }
 }
@@ -0,0 +1,80 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of the resources lookup by name.
+ */
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "GDCore/Project/ResourcesManager.h"
+#include "catch.hpp"
+
+TEST_CASE("ResourcesManager - Benchmarks", "[common][resources]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  const std::size_t resourcesCount = 8000;
+
+  doBenchmark("Add 8000 resources one by one", 3, [&]() {
+    gd::ResourcesManager resourcesManager;
+    for (std::size_t i = 0; i < resourcesCount; i++) {
+      resourcesManager.AddResource(
+          "Resource" + gd::String::From(i), "file.png", "image");
+    }
+    REQUIRE(resourcesManager.GetAllResourceNames().size() == resourcesCount);
+  });
+
+  // Resources are often created, named and then added (for example when
+  // importing them), which must not invalidate the index of other containers.
+  doBenchmark("Name and add 8000 resources one by one", 3, [&]() {
+    gd::ResourcesManager resourcesManager;
+    for (std::size_t i = 0; i < resourcesCount; i++) {
+      gd::ImageResource image;
+      image.SetName("Resource" + gd::String::From(i));
+      image.SetFile("file.png");
+      resourcesManager.AddResource(image);
+    }
+    REQUIRE(resourcesManager.GetAllResourceNames().size() == resourcesCount);
+  });
+
+  gd::ResourcesManager resourcesManager;
+  for (std::size_t i = 0; i < resourcesCount; i++) {
+    resourcesManager.AddResource(
+        "Resource" + gd::String::From(i), "file.png", "image");
+  }
+  // Each rename rebuilds the index of the container of the renamed resource
+  // (and only this one) at the next lookup.
+  doBenchmark("Rename 100 of 8000 resources", 3, [&]() {
+    for (std::size_t i = 0; i < 100; i++) {
+      const gd::String name = "Resource" + gd::String::From(i * 7);
+      resourcesManager.GetResource(name).SetName(name + "Renamed");
+      resourcesManager.GetResource(name + "Renamed").SetName(name);
+    }
+    REQUIRE(resourcesManager.HasResource("Resource693"));
+  });
+}
@@ -7,11 +7,19 @@
  * @file Tests covering serialization to JSON.
  */
 #include "GDCore/Serialization/Serializer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+#include "DummyPlatform.h"
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/Events/Serialization.h"
+#include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/Variable.h"
@@ -81,6 +89,60 @@ TEST_CASE("SerializerElement", "[common]") {
     REQUIRE(element.GetChild(2).GetDoubleValue() == 45.6);
   }
 
+  SECTION("Accessing children of elements with a lot of children") {
+    SerializerElement element;
+    for (std::size_t i = 0; i < 100; ++i) {
+      element.AddChild("child" + gd::String::From(i)).SetIntValue(i);
+    }
+    element.AddChild("child10").SetIntValue(1010);
+    element.AddChild("deprecatedChild").SetIntValue(-1);
+
+    REQUIRE(element.GetAllChildren().size() == 101);
+    REQUIRE(element.HasChild("child0"));
+    REQUIRE(element.HasChild("child99"));
+    REQUIRE_FALSE(element.HasChild("child100"));
+    REQUIRE(element.HasChild("child100", "deprecatedChild"));
+    REQUIRE(element.GetChild("child10").GetIntValue() == 1010);
+    REQUIRE(element.GetChild("child50").GetIntValue() == 50);
+    REQUIRE(element.GetChild("child100", 0, "deprecatedChild").GetIntValue() ==
+            -1);
+    REQUIRE(element.GetIntAttribute("child42") == 42);
+
+    // Removed children are not found anymore, and order is preserved.
+    element.RemoveChild("child50");
+    REQUIRE_FALSE(element.HasChild("child50"));
+    REQUIRE(element.GetChild("child51").GetIntValue() == 51);
+    REQUIRE(element.GetAllChildren()[50].first == "child51");
+    REQUIRE(element.GetAllChildren()[99].first == "deprecatedChild");
+
+    SerializerElement copiedElement = element;
+    REQUIRE(copiedElement.GetChild("child99").GetIntValue() == 99);
+    REQUIRE_FALSE(copiedElement.HasChild("child50"));
+  }
+
+  SECTION("Accessing children of large arrays") {
+    SerializerElement element;
+    element.ConsiderAsArrayOf("namedElement");
+    for (std::size_t i = 0; i < 100; ++i) {
+      element.AddChild("namedElement").SetIntValue(i);
+    }
+
+    REQUIRE(element.GetChildrenCount() == 100);
+    REQUIRE(element.GetChildrenCount("namedElement") == 100);
+    REQUIRE(element.GetChildrenCount("otherElement") == 0);
+    REQUIRE(element.GetChild(0).GetIntValue() == 0);
+    REQUIRE(element.GetChild(99).GetIntValue() == 99);
+    REQUIRE(element.GetChild("namedElement", 42).GetIntValue() == 42);
+    REQUIRE(&element.GetChild(100) == &SerializerElement::nullElement);
+
+    // Arrays loaded from XML can have children with other names.
+    element.ConsiderAsArrayOf("otherElement");
+    REQUIRE(element.GetChildrenCount() == 0);
+    element.ConsiderAsArrayOf("otherElement", "namedElement");
+    REQUIRE(element.GetChildrenCount() == 100);
+    REQUIRE(element.GetChild(99).GetIntValue() == 99);
+  }
+
   SECTION("Multiline strings") {
     SerializerElement element;
 
@@ -206,6 +268,37 @@ TEST_CASE("Serializer", "[common]") {
     }
   }
 
+  SECTION("JSON appended to an existing string") {
+    SerializerElement element =
+        Serializer::FromJSON(u8"{\"hello\":\"wörld\",\"a\":[1,2.5,true]}");
+
+    gd::String output = u8"gdjs.data = ";
+    Serializer::ToJSON(element, output);
+    output += ";";
+    REQUIRE(output ==
+            u8"gdjs.data = {\"hello\":\"wörld\",\"a\":[1,2.5,true]};");
+    REQUIRE(output.size() == 47);
+  }
+
+  SECTION("Invalid JSON") {
+    SerializerElement element =
+        Serializer::FromJSON("{\"hello\":\"world\",\"a\":[1,2");
+    REQUIRE(element.IsValueUndefined());
+    REQUIRE(element.GetAllChildren().size() == 0);
+    REQUIRE(Serializer::ToJSON(element) == "{}");
+  }
+
+  SECTION("Children loaded from JSON can outlive their parent") {
+    std::shared_ptr<SerializerElement> child;
+    {
+      SerializerElement element = Serializer::FromJSON(
+          "{\"a\":{\"b\":[1,{\"c\":\"d\"}]},\"e\":null}");
+      REQUIRE(element.HasChild("e"));
+      child = element.GetAllChildren()[0].second;
+    }
+    REQUIRE(Serializer::ToJSON(*child) == "{\"b\":[1,{\"c\":\"d\"}]}");
+  }
+
   SECTION("(Deprecated) attributes") {
     gd::String originalJSON = "{\"ok\":true,\"hello\":\"world\"}";
     SerializerElement element = Serializer::FromJSON(originalJSON);
@@ -227,4 +320,218 @@ TEST_CASE("Serializer", "[common]") {
     gd::String json = Serializer::ToJSON(element);
     REQUIRE(json == "{\"hello\":\"world1\",\"ok\":true,\"hello2\":\"world2\"}");
   }
+
+  SECTION("Binary basics") {
+    gd::String originalJSON =
+        u8"{\"hello\":{\"world\":[{},[],3,\"4\",-5,6.25,true,false],"
+        u8"\"wörld\":[-1,\"-2\",{\"-3\":[-4]}],\"官话\":\"官话\"},"
+        u8"\"empty\":\"\",\"big\":-2147483648}";
+    SerializerElement element = Serializer::FromJSON(originalJSON);
+
+    std::string binary = Serializer::ToBinary(element);
+    REQUIRE(Serializer::IsBinary(binary.data(), binary.size()));
+
+    SerializerElement binaryElement =
+        Serializer::FromBinary(binary.data(), binary.size());
+    REQUIRE(Serializer::ToJSON(binaryElement) == originalJSON);
+    REQUIRE(binaryElement.GetChild("big").GetIntValue() == -2147483648);
+    REQUIRE(binaryElement.GetChild("hello")
+                .GetChild(u8"官话")
+                .GetStringValue() == u8"官话");
+  }
+
+  SECTION("Binary keeps the attributes and the types of values") {
+    SerializerElement element;
+    element.SetAttribute("bool", true);
+    element.SetAttribute("int", 42);
+    element.SetAttribute("double", 4.5);
+    element.SetAttribute("string", "hello");
+    element.AddChild("unknown").SetValue(SerializerValue());
+    element.AddChild("string").SetStringValue("123");
+    element.AddChild("double").SetDoubleValue(2);
+    element.AddChild("array").ConsiderAsArrayOf("item");
+    element.GetChild("array").AddChild("item").SetIntValue(1);
+    element.GetChild("array").AddChild("item").SetIntValue(2);
+
+    std::string binary = Serializer::ToBinary(element);
+    SerializerElement binaryElement =
+        Serializer::FromBinary(binary.data(), binary.size());
+    REQUIRE(binaryElement.GetAllAttributes().size() == 4);
+    REQUIRE(binaryElement.GetBoolAttribute("bool") == true);
+    REQUIRE(binaryElement.GetIntAttribute("int") == 42);
+    REQUIRE(binaryElement.GetDoubleAttribute("double") == 4.5);
+    REQUIRE(binaryElement.GetStringAttribute("string") == "hello");
+    REQUIRE(!binaryElement.GetChild("unknown").IsValueUndefined());
+    REQUIRE(binaryElement.GetChild("string").GetValue().IsString());
+    REQUIRE(binaryElement.GetChild("double").GetValue().IsDouble());
+    REQUIRE(binaryElement.GetChild("array").ConsideredAsArray());
+    binaryElement.GetChild("array").ConsiderAsArrayOf("item");
+    REQUIRE(binaryElement.GetChild("array").GetChildrenCount("item") == 2);
+    REQUIRE(binaryElement.GetChild("array").GetChild(1).GetIntValue() == 2);
+    REQUIRE(Serializer::ToJSON(binaryElement) == Serializer::ToJSON(element));
+  }
+
+  SECTION("Invalid binary data") {
+    SerializerElement element =
+        Serializer::FromJSON("{\"hello\":\"world\",\"a\":[1,2.5,{}]}");
+    std::string binary = Serializer::ToBinary(element);
+
+    // Truncated data is detected, whatever the place where it's cut.
+    for (std::size_t size = 0; size < binary.size(); ++size) {
+      SerializerElement truncatedElement =
+          Serializer::FromBinary(binary.data(), size);
+      REQUIRE(truncatedElement.IsValueUndefined());
+      REQUIRE(truncatedElement.GetAllChildren().size() == 0);
+    }
+
+    REQUIRE(!Serializer::IsBinary("{}", 2));
+    REQUIRE(Serializer::FromBinary("{}", 2).GetAllChildren().size() == 0);
+  }
+
+  SECTION("Binary or JSON") {
+    gd::String originalJSON = "{\"hello\":\"world\",\"a\":[1,2.5,{}]}";
+    SerializerElement element = Serializer::FromJSON(originalJSON);
+    std::string binary = Serializer::ToBinary(element);
+
+    REQUIRE(Serializer::ToJSON(Serializer::FromBinaryOrJSON(
+                binary.data(), binary.size())) == originalJSON);
+    // The JSON is read without needing a null character at the end.
+    gd::String paddedJSON = originalJSON + "abc";
+    REQUIRE(Serializer::ToJSON(Serializer::FromBinaryOrJSON(
+                paddedJSON.c_str(), originalJSON.Raw().size())) ==
+            originalJSON);
+  }
+
+  SECTION("Files in binary or JSON") {
+    SerializerElement element =
+        Serializer::FromJSON("{\"hello\":\"world\",\"a\":[1,2.5,{}]}");
+    const gd::String filename = "SerializerTestsFile.bin";
+    {
+      std::ofstream file(filename.ToLocale(), std::ios::binary);
+      file << Serializer::ToBinary(element);
+    }
+    REQUIRE(Serializer::ToJSON(Serializer::FromFile(filename)) ==
+            Serializer::ToJSON(element));
+    {
+      std::ofstream file(filename.ToLocale(), std::ios::binary);
+      file << Serializer::ToJSON(element);
+    }
+    REQUIRE(Serializer::ToJSON(Serializer::FromFile(filename)) ==
+            Serializer::ToJSON(element));
+    std::remove(filename.ToLocale().c_str());
+
+    REQUIRE(Serializer::FromFile("SerializerTestsMissingFile.bin")
+                .GetAllChildren()
+                .empty());
+  }
+
+  SECTION("Projects loaded from binary") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+    layout.GetVariables().InsertNew("MyVariable", 0).SetValue(42);
+    auto &instance = layout.GetInitialInstances().InsertNewInitialInstance();
+    instance.SetObjectName("MyObject");
+    instance.SetX(12.5);
+
+    SerializerElement element;
+    project.SerializeTo(element);
+    std::string binary = Serializer::ToBinary(element);
+
+    gd::Project loadedProject;
+    loadedProject.AddPlatform(platform);
+    loadedProject.UnserializeFrom(
+        Serializer::FromBinaryOrJSON(binary.data(), binary.size()));
+    SerializerElement loadedElement;
+    loadedProject.SerializeTo(loadedElement);
+    REQUIRE(Serializer::ToJSON(loadedElement) == Serializer::ToJSON(element));
+  }
+}
+
+TEST_CASE("Serializer - Benchmarks", "[common]") {
+  auto makeLargeJSON = [](size_t layoutsCount) {
+    gd::String json = "{\"layouts\":[";
+    for (size_t i = 0; i < layoutsCount; i++) {
+      if (i != 0) json += ",";
+      json += "{\"name\":\"Layout" + gd::String::From(i) +
+              "\",\"r\":209,\"v\":209,\"b\":209,\"instances\":[";
+      for (size_t j = 0; j < 100; j++) {
+        if (j != 0) json += ",";
+        json +=
+            "{\"angle\":0,\"customSize\":false,\"height\":0,\"layer\":\"\","
+            "\"name\":\"MySpriteObject\",\"persistentUuid\":"
+            "\"9b1a8e2c-5d4f-4e67-8c39-0e2f1b7a6d58\",\"width\":0,"
+            "\"x\":" +
+            gd::String::From(j * 32) + ",\"y\":" + gd::String::From(i) +
+            ".5,\"zOrder\":1,\"numberProperties\":[],"
+            "\"stringProperties\":[],\"initialVariables\":[]}";
+      }
+      json += "]}";
+    }
+    json += "]}";
+    return json;
+  };
+
+  const gd::String json = makeLargeJSON(200);
+  std::cout << "JSON size: " << json.Raw().size() / 1024 << " KB" << std::endl;
+
+  // The peak resident memory of the process was already raised by the
+  // previous tests: measure the resident memory used by each loaded element.
+  auto getResidentMemoryIncrease = [](size_t residentMemoryBefore) {
+    return static_cast<long long>(gd::SystemStats::GetResidentMemory()) -
+           static_cast<long long>(residentMemoryBefore);
+  };
+
+  size_t residentMemoryBefore = gd::SystemStats::GetResidentMemory();
+  auto start = std::chrono::steady_clock::now();
+  SerializerElement element = Serializer::FromJSON(json);
+  auto end = std::chrono::steady_clock::now();
+  std::cout << "Serializer::FromJSON took "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end -
+                                                                     start)
+                   .count()
+            << "ms. Resident memory increase: "
+            << getResidentMemoryIncrease(residentMemoryBefore) << " KB."
+            << std::endl;
+
+  REQUIRE(element.GetChild("layouts").GetChildrenCount() == 200);
+
+  start = std::chrono::steady_clock::now();
+  gd::String outputJson = Serializer::ToJSON(element);
+  end = std::chrono::steady_clock::now();
+  std::cout << "Serializer::ToJSON took "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end -
+                                                                     start)
+                   .count()
+            << "ms." << std::endl;
+
+  REQUIRE(outputJson == json);
+
+  start = std::chrono::steady_clock::now();
+  std::string binary = Serializer::ToBinary(element);
+  end = std::chrono::steady_clock::now();
+  std::cout << "Serializer::ToBinary took "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end -
+                                                                     start)
+                   .count()
+            << "ms. Binary size: " << binary.size() / 1024 << " KB."
+            << std::endl;
+
+  residentMemoryBefore = gd::SystemStats::GetResidentMemory();
+  start = std::chrono::steady_clock::now();
+  SerializerElement binaryElement =
+      Serializer::FromBinary(binary.data(), binary.size());
+  end = std::chrono::steady_clock::now();
+  std::cout << "Serializer::FromBinary took "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end -
+                                                                     start)
+                   .count()
+            << "ms. Resident memory increase: "
+            << getResidentMemoryIncrease(residentMemoryBefore) << " KB."
+            << std::endl;
+
+  REQUIRE(binary.size() < json.Raw().size() / 2);
+  REQUIRE(Serializer::ToJSON(binaryElement) == json);
 }
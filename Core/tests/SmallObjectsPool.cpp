@@ -0,0 +1,64 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the pool used to allocate small objects.
+ */
+#include "GDCore/Tools/SmallObjectsPool.h"
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <vector>
+
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Tools/ForEachInParallel.h"
+#include "catch.hpp"
+
+TEST_CASE("SmallObjectsPool", "[common][tools]") {
+  SECTION("Blocks are distinct, aligned and recycled") {
+    std::vector<void*> blocks;
+    std::set<void*> distinctBlocks;
+    for (std::size_t i = 0; i < 10000; ++i) {
+      void* block = gd::SmallObjectsPool::Allocate(40);
+      std::memset(block, 0xAB, 40);
+      REQUIRE((reinterpret_cast<std::uintptr_t>(block) % 16) == 0);
+      blocks.push_back(block);
+      distinctBlocks.insert(block);
+    }
+    REQUIRE(distinctBlocks.size() == blocks.size());
+
+    void* lastBlock = blocks.back();
+    for (void* block : blocks) gd::SmallObjectsPool::Deallocate(block, 40);
+    REQUIRE(gd::SmallObjectsPool::Allocate(40) == lastBlock);
+    gd::SmallObjectsPool::Deallocate(lastBlock, 40);
+  }
+
+  SECTION("Big objects are not pooled") {
+    std::size_t size = gd::SmallObjectsPool::GetMaxObjectSize() + 1;
+    void* block = gd::SmallObjectsPool::Allocate(size);
+    std::memset(block, 0xAB, size);
+    gd::SmallObjectsPool::Deallocate(block, size);
+  }
+
+  SECTION("Blocks can be freed by other threads") {
+    // Nodes are parsed by threads which exit, and destroyed by this thread.
+    std::vector<std::unique_ptr<gd::ExpressionNode>> nodes(100);
+    gd::ForEachInParallel(nodes.size(), 4, [&](std::size_t i) {
+      gd::ExpressionParser2 parser;
+      nodes[i] = parser.ParseExpression("1 + 2 * MyObject.X()");
+    });
+    for (const auto& node : nodes) REQUIRE(node != nullptr);
+    nodes.clear();
+
+    // And the other way around.
+    gd::ExpressionParser2 parser;
+    for (std::size_t i = 0; i < 100; ++i)
+      nodes.push_back(parser.ParseExpression("1 + 2 * MyObject.X()"));
+    gd::ForEachInParallel(
+        nodes.size(), 4, [&](std::size_t i) { nodes[i].reset(); });
+    for (const auto& node : nodes) REQUIRE(node == nullptr);
+  }
+}
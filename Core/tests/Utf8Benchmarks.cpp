@@ -0,0 +1,102 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of the position based methods of gd::String.
+ */
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+namespace {
+// Count the words by position.
+size_t countWords(const gd::String &str) {
+  size_t count = 0;
+  size_t pos = 0;
+  while ((pos = str.find(u8"été", pos)) != gd::String::npos) {
+    REQUIRE(str.substr(pos, 3) == u8"été");
+    pos++;
+    count++;
+  }
+  return count;
+}
+}  // namespace
+
+TEST_CASE("Utf8 String - Benchmarks", "[common][utf8]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  const size_t termsCount = 200;
+  gd::String longString;
+  for (size_t i = 0; i < termsCount; i++) {
+    longString += u8"MySpriteObject.Variable(Score) a été testé, ";
+  }
+
+  SECTION("Indexed loop") {
+    doBenchmark("Indexed loop", 3, [&]() {
+      size_t count = 0;
+      for (size_t i = 0; i < longString.size(); ++i) {
+        if (longString[i] == U'é') count++;
+      }
+      REQUIRE(count == termsCount * 3);
+    });
+  }
+
+  SECTION("find/substr loop") {
+    doBenchmark("find/substr loop", 3, [&]() {
+      REQUIRE(countWords(longString) == termsCount);
+    });
+  }
+
+  SECTION("FindAndReplace") {
+    doBenchmark("FindAndReplace", 10, [&]() {
+      REQUIRE(longString.FindAndReplace(u8"été", u8"était").size() ==
+              longString.size() + termsCount * 2);
+    });
+  }
+
+  SECTION("Split") {
+    doBenchmark("Split", 10, [&]() {
+      REQUIRE(longString.Split(U',').size() == termsCount + 1);
+    });
+  }
+
+  SECTION("FindCaseInsensitive") {
+    gd::String str;
+    for (size_t i = 0; i < 20; i++) {
+      str += u8"MySpriteObject.Variable(Score) a été testé, ";
+    }
+    str += u8"Heiße";
+
+    doBenchmark("FindCaseInsensitive", 3, [&]() {
+      REQUIRE(str.FindCaseInsensitive(u8"HEISSE") == 880);
+    });
+  }
+}
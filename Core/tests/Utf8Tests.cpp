@@ -293,6 +293,11 @@ TEST_CASE("Utf8 String", "[common][utf8]") {
 
     gd::String str6 = u8"ßßß";
     REQUIRE(str6.FindAndReplace(u8"ßß", u8"ß") == u8"ßß");
+
+    gd::String str7 = u8"été";
+    REQUIRE(str7.FindAndReplace("", "x", false) == u8"xété");
+    REQUIRE(str7.FindAndReplace("", "x") == u8"xété");
+    REQUIRE(gd::String("").FindAndReplace("", "x") == "x");
   }
 
   SECTION("trimming") {
@@ -6,15 +6,20 @@
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 
 #include <algorithm>
+#include <iterator>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/EventMetadata.h"
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
+#include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/EventsFunctionTools.h"
 #include "GDCore/IDE/SceneNameMangler.h"
 #include "GDCore/Project/Behavior.h"
@@ -26,11 +31,99 @@
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
 #include "GDJS/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
 
 using namespace std;
 
+namespace {
+
+/**
+ * \brief Go through the nodes of an expression and check if a function is
+ * called or if an object (or a group) is used.
+ *
+ * Both generate code reading the objects lists (for example, the variable of
+ * the first picked instance), so they can't be evaluated while a list is being
+ * filtered.
+ */
+class ExpressionFunctionCallsOrObjectsFinder
+    : public gd::ExpressionParser2NodeWorker {
+ public:
+  ExpressionFunctionCallsOrObjectsFinder(
+      const gd::ObjectsContainer& globalObjectsContainer_,
+      const gd::ObjectsContainer& objectsContainer_)
+      : globalObjectsContainer(globalObjectsContainer_),
+        objectsContainer(objectsContainer_),
+        hasFunctionCallsOrObjects(false){};
+  virtual ~ExpressionFunctionCallsOrObjectsFinder(){};
+
+  static bool HasFunctionCallsOrObjects(
+      const gd::ObjectsContainer& globalObjectsContainer,
+      const gd::ObjectsContainer& objectsContainer,
+      const gd::Expression& expression) {
+    gd::ExpressionNode* node = expression.GetRootNode();
+    if (!node) return false;
+
+    ExpressionFunctionCallsOrObjectsFinder finder(globalObjectsContainer,
+                                                  objectsContainer);
+    node->Visit(finder);
+    return finder.hasFunctionCallsOrObjects;
+  }
+
+ protected:
+  void OnVisitSubExpressionNode(gd::SubExpressionNode& node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(gd::OperatorNode& node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(gd::UnaryOperatorNode& node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(gd::NumberNode& node) override {}
+  void OnVisitTextNode(gd::TextNode& node) override {}
+  void OnVisitVariableNode(gd::VariableNode& node) override {
+    if (IsObjectOrGroup(node.name)) hasFunctionCallsOrObjects = true;
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(gd::VariableAccessorNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      gd::VariableBracketAccessorNode& node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(gd::IdentifierNode& node) override {
+    if (IsObjectOrGroup(node.identifierName))
+      hasFunctionCallsOrObjects = true;
+  }
+  void OnVisitObjectFunctionNameNode(
+      gd::ObjectFunctionNameNode& node) override {
+    hasFunctionCallsOrObjects = true;
+  }
+  void OnVisitFunctionCallNode(gd::FunctionCallNode& node) override {
+    hasFunctionCallsOrObjects = true;
+  }
+  void OnVisitEmptyNode(gd::EmptyNode& node) override {}
+
+ private:
+  bool IsObjectOrGroup(const gd::String& name) {
+    return objectsContainer.HasObjectNamed(name) ||
+           globalObjectsContainer.HasObjectNamed(name) ||
+           objectsContainer.GetObjectGroups().Has(name) ||
+           globalObjectsContainer.GetObjectGroups().Has(name);
+  }
+
+  const gd::ObjectsContainer& globalObjectsContainer;
+  const gd::ObjectsContainer& objectsContainer;
+  bool hasFunctionCallsOrObjects;
+};
+
+}  // namespace
+
 namespace gdjs {
 
 gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
@@ -128,6 +221,7 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionCode(
   EventsCodeGenerator codeGenerator(globalObjectsAndGroups, objectsAndGroups);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetParsedExpressionsCache(&project.GetParsedExpressionsCache());
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
       codeGenerator,
@@ -169,6 +263,7 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionCode(
   EventsCodeGenerator codeGenerator(globalObjectsAndGroups, objectsAndGroups);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetParsedExpressionsCache(&project.GetParsedExpressionsCache());
 
   // Generate the code setting up the context of the function.
   gd::String fullPreludeCode =
@@ -237,6 +332,7 @@ gd::String EventsCodeGenerator::GenerateObjectEventsFunctionCode(
   EventsCodeGenerator codeGenerator(globalObjectsAndGroups, objectsAndGroups);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetParsedExpressionsCache(&project.GetParsedExpressionsCache());
 
   // Generate the code setting up the context of the function.
   gd::String fullPreludeCode =
@@ -739,20 +835,14 @@ gd::String EventsCodeGenerator::GenerateObjectCondition(
   }
   if (conditionInverted) predicate = GenerateNegatedPredicate(predicate);
 
+  if (fusedConditionsPredicates) {
+    fusedConditionsPredicates->push_back(predicate);
+    return "";
+  }
+
   // Generate whole condition code
-  conditionCode +=
-      "for (var i = 0, k = 0, l = " + GetObjectListName(objectName, context) +
-      ".length;i<l;++i) {\n";
-  conditionCode += "    if ( " + predicate + " ) {\n";
-  conditionCode += "        " +
-                   GenerateBooleanFullName(returnBoolean, context) +
-                   " = true;\n";
-  conditionCode += "        " + GetObjectListName(objectName, context) +
-                   "[k] = " + GetObjectListName(objectName, context) + "[i];\n";
-  conditionCode += "        ++k;\n";
-  conditionCode += "    }\n";
-  conditionCode += "}\n";
-  conditionCode += GetObjectListName(objectName, context) + ".length = k;\n";
+  conditionCode += GenerateObjectsListFilterCode(
+      objectName, predicate, returnBoolean, context);
 
   return conditionCode;
 }
@@ -794,26 +884,39 @@ gd::String EventsCodeGenerator::GenerateBehaviorCondition(
     cout << "Error: bad behavior \"" << behaviorName
          << "\" requested for object \'" << objectName
          << "\" (condition: " << instrInfos.GetFullName() << ")." << endl;
+  } else if (fusedConditionsPredicates) {
+    fusedConditionsPredicates->push_back(predicate);
   } else {
-    conditionCode +=
-        "for (var i = 0, k = 0, l = " + GetObjectListName(objectName, context) +
-        ".length;i<l;++i) {\n";
-    conditionCode += "    if ( " + predicate + " ) {\n";
-    conditionCode += "        " +
-                     GenerateBooleanFullName(returnBoolean, context) +
-                     " = true;\n";
-    conditionCode += "        " + GetObjectListName(objectName, context) +
-                     "[k] = " + GetObjectListName(objectName, context) +
-                     "[i];\n";
-    conditionCode += "        ++k;\n";
-    conditionCode += "    }\n";
-    conditionCode += "}\n";
-    conditionCode += GetObjectListName(objectName, context) + ".length = k;\n";
+    conditionCode += GenerateObjectsListFilterCode(
+        objectName, predicate, returnBoolean, context);
   }
 
   return conditionCode;
 }
 
+gd::String EventsCodeGenerator::GenerateObjectsListFilterCode(
+    const gd::String& objectName,
+    const gd::String& predicate,
+    const gd::String& returnBoolean,
+    gd::EventsCodeGenerationContext& context) {
+  gd::String filterCode;
+  filterCode +=
+      "for (var i = 0, k = 0, l = " + GetObjectListName(objectName, context) +
+      ".length;i<l;++i) {\n";
+  filterCode += "    if ( " + predicate + " ) {\n";
+  filterCode += "        " +
+                GenerateBooleanFullName(returnBoolean, context) +
+                " = true;\n";
+  filterCode += "        " + GetObjectListName(objectName, context) +
+                "[k] = " + GetObjectListName(objectName, context) + "[i];\n";
+  filterCode += "        ++k;\n";
+  filterCode += "    }\n";
+  filterCode += "}\n";
+  filterCode += GetObjectListName(objectName, context) + ".length = k;\n";
+
+  return filterCode;
+}
+
 gd::String EventsCodeGenerator::GenerateObjectAction(
     const gd::String& objectName,
     const gd::ObjectMetadata& objInfo,
@@ -1079,32 +1182,143 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(
     outputCode += GenerateBooleanInitializationToFalse(
         "isConditionTrue", context);
 
-  for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
+  std::size_t nestedIfsCount = 0;
+  for (std::size_t cId = 0; cId < conditions.size();) {
     if (cId != 0) {
       outputCode += "if (" +
                     GenerateBooleanFullName("isConditionTrue", context) +
                     ") {\n";
+      nestedIfsCount++;
+    }
+
+    // Adjacent conditions filtering the same object are checked in a single
+    // loop on the objects list, instead of one loop per condition.
+    std::size_t fusedConditionsCount = 1;
+    gd::String fusedObjectName =
+        GetFusableConditionObjectName(conditions[cId], context);
+    if (!fusedObjectName.empty()) {
+      while (cId + fusedConditionsCount < conditions.size() &&
+             GetFusableConditionObjectName(
+                 conditions[cId + fusedConditionsCount], context) ==
+                 fusedObjectName)
+        fusedConditionsCount++;
     }
     gd::String conditionCode =
-        GenerateConditionCode(conditions[cId],
-                              "isConditionTrue",
-                              context);
+        fusedConditionsCount > 1
+            ? GenerateFusedConditionsCode(conditions,
+                                          cId,
+                                          fusedConditionsCount,
+                                          fusedObjectName,
+                                          "isConditionTrue",
+                                          context)
+            : "";
+    if (conditionCode.empty()) {
+      fusedConditionsCount = 1;
+      conditionCode =
+          GenerateConditionCode(conditions[cId], "isConditionTrue", context);
+    }
+
     if (!conditions[cId].GetType().empty()) {
       outputCode +=
           GenerateBooleanFullName("isConditionTrue", context) + " = false;\n";
       outputCode += conditionCode;
     }
+    cId += fusedConditionsCount;
   }
   // Close nested "if".
-  for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
-    if (cId != 0) outputCode += "}\n";
-  }
+  for (std::size_t i = 0; i < nestedIfsCount; ++i) outputCode += "}\n";
 
   maxConditionsListsSize = std::max(maxConditionsListsSize, conditions.size());
 
   return outputCode;
 }
 
+gd::String EventsCodeGenerator::GetFusableConditionObjectName(
+    gd::Instruction& condition, gd::EventsCodeGenerationContext& context) {
+  if (condition.GetType().empty() ||
+      !condition.GetSubInstructions().empty() ||
+      condition.GetParametersCount() == 0)
+    return "";
+
+  const gd::InstructionMetadata& instrInfos =
+      gd::MetadataProvider::GetConditionMetadata(platform,
+                                                 condition.GetInternedType());
+  if (gd::MetadataProvider::IsBadInstructionMetadata(instrInfos) ||
+      instrInfos.HasCustomCodeGenerator() ||
+      (!instrInfos.IsObjectInstruction() &&
+       !instrInfos.IsBehaviorInstruction()))
+    return "";
+
+  // Conditions declared by events functions (including the ones of
+  // events-based behaviors and objects) run arbitrary events, which can have
+  // side effects or depend on the other picked objects.
+  const gd::String& type = condition.GetType();
+  const size_t separatorPosition =
+      type.find(gd::PlatformExtension::GetNamespaceSeparator());
+  if (separatorPosition != gd::String::npos &&
+      GetProject().HasEventsFunctionsExtensionNamed(
+          type.substr(0, separatorPosition)))
+    return "";
+
+  const gd::String& objectName = condition.GetParameter(0).GetPlainString();
+  if (objectName.empty() || ExpandObjectsName(objectName, context).size() != 1)
+    return "";
+
+  std::size_t firstArgumentIndex = instrInfos.IsBehaviorInstruction() ? 2 : 1;
+  for (std::size_t pNb = firstArgumentIndex; pNb < instrInfos.parameters.size();
+       ++pNb) {
+    const gd::String& type = instrInfos.parameters[pNb].GetType();
+    if (gd::ParameterMetadata::IsObject(type) || type == "currentScene" ||
+        type == "objectsContext" || type == "eventsFunctionContext")
+      return "";
+
+    if (pNb < condition.GetParametersCount() &&
+        (gd::ParameterMetadata::IsExpression("number", type) ||
+         gd::ParameterMetadata::IsExpression("string", type) ||
+         gd::ParameterMetadata::IsExpression("variable", type)) &&
+        ExpressionFunctionCallsOrObjectsFinder::HasFunctionCallsOrObjects(
+            GetGlobalObjectsAndGroups(),
+            GetObjectsAndGroups(),
+            condition.GetParameter(pNb)))
+      return "";
+  }
+
+  return objectName;
+}
+
+gd::String EventsCodeGenerator::GenerateFusedConditionsCode(
+    gd::InstructionsList& conditions,
+    std::size_t firstConditionIndex,
+    std::size_t conditionsCount,
+    const gd::String& objectName,
+    const gd::String& returnBoolean,
+    gd::EventsCodeGenerationContext& context) {
+  std::vector<gd::String> predicates;
+  bool hasUnexpectedCode = false;
+  fusedConditionsPredicates = &predicates;
+  for (std::size_t i = 0; i < conditionsCount && !hasUnexpectedCode; ++i) {
+    hasUnexpectedCode = !GenerateConditionCode(
+                             conditions[firstConditionIndex + i],
+                             returnBoolean,
+                             context)
+                             .empty();
+  }
+  fusedConditionsPredicates = nullptr;
+
+  // Conditions that could not be generated (unknown objects, unsupported
+  // capabilities...) are generated again without being fused.
+  if (hasUnexpectedCode || predicates.size() != conditionsCount) return "";
+
+  gd::String fusedPredicate;
+  for (const auto& predicate : predicates) {
+    if (!fusedPredicate.empty()) fusedPredicate += " && ";
+    fusedPredicate += "(" + predicate + ")";
+  }
+
+  return GenerateObjectsListFilterCode(
+      objectName, fusedPredicate, returnBoolean, context);
+}
+
 gd::String EventsCodeGenerator::GenerateParameterCodes(
     const gd::Expression& parameter,
     const gd::ParameterMetadata& metadata,
@@ -1177,9 +1391,12 @@ gd::String EventsCodeGenerator::GenerateObject(
           mapDeclaration += "\"" + ConvertToString(objectName) + "\": []";
         }
 
-        // TODO: this should be de-duplicated.
-        AddCustomCodeOutsideMain(objectsMapName + " = Hashtable.newFrom({" +
-                                 mapDeclaration + "});\n");
+        // Declare each map only once, as the same objects lists are usually
+        // given to many instructions.
+        gd::String declaration = objectsMapName + " = Hashtable.newFrom({" +
+                                 mapDeclaration + "});\n";
+        if (declaredObjectsMaps.insert(declaration).second)
+          AddCustomCodeOutsideMain(declaration);
         return objectsMapName;
       };
 
@@ -1250,19 +1467,10 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
     gd::EventsCodeGenerationContext& context,
     const gd::String& objectName) {
   gd::String output;
-  const gd::VariablesContainer* variables = NULL;
   if (scope == LAYOUT_VARIABLE) {
     output = "runtimeScene.getScene().getVariables()";
-
-    if (HasProjectAndLayout()) {
-      variables = &GetLayout().GetVariables();
-    }
   } else if (scope == PROJECT_VARIABLE) {
     output = "runtimeScene.getGame().getVariables()";
-
-    if (HasProjectAndLayout()) {
-      variables = &GetProject().GetVariables();
-    }
   } else {
     std::vector<gd::String> realObjects =
         ExpandObjectsName(objectName, context);
@@ -1282,17 +1490,11 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
                  GetObjectListName(realObjects[i], context) +
                  "[0].getVariables())";
     }
-
-    if (HasProjectAndLayout()) {
-      if (GetLayout().HasObjectNamed(
-              objectName))  // We check first layout's objects' list.
-        variables = &GetLayout().GetObject(objectName).GetVariables();
-      else if (GetProject().HasObjectNamed(
-                   objectName))  // Then the global objects list.
-        variables = &GetProject().GetObject(objectName).GetVariables();
-    }
   }
 
+  const gd::VariablesContainer* variables =
+      GetDeclaredVariables(scope, objectName);
+
   // Optimize the lookup of the variable when the variable is declared.
   //(In this case, it is stored in an array at runtime and we know its
   // position.)
@@ -1308,6 +1510,21 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
   return output;
 }
 
+gd::String EventsCodeGenerator::GenerateDeclaredVariableAccessor(
+    const gd::String& childName, const gd::Variable& parentVariable) {
+  // Children of declared structures are given a slot at runtime, so that they
+  // are found without a lookup by name after the first access.
+  const auto& children = parentVariable.GetAllChildren();
+  auto it = children.find(childName);
+  if (parentVariable.GetType() != gd::Variable::Structure ||
+      it == children.end())
+    return GenerateVariableAccessor(childName);
+
+  return ".getChildFromIndex(" +
+         gd::String::From(std::distance(children.begin(), it)) + ", " +
+         ConvertToStringExplicit(childName) + ")";
+}
+
 gd::String EventsCodeGenerator::GenerateUpperScopeBooleanFullName(
     const gd::String& boolName,
     const gd::EventsCodeGenerationContext& context) {
@@ -1350,13 +1567,15 @@ gd::String EventsCodeGenerator::GenerateProfilerSectionEnd(
 
 EventsCodeGenerator::EventsCodeGenerator(const gd::Project& project,
                                          const gd::Layout& layout)
-    : gd::EventsCodeGenerator(project, layout, JsPlatform::Get()) {}
+    : gd::EventsCodeGenerator(project, layout, JsPlatform::Get()),
+      fusedConditionsPredicates(nullptr) {}
 
 EventsCodeGenerator::EventsCodeGenerator(
     gd::ObjectsContainer& globalObjectsAndGroups,
     const gd::ObjectsContainer& objectsAndGroups)
     : gd::EventsCodeGenerator(
-          JsPlatform::Get(), globalObjectsAndGroups, objectsAndGroups) {}
+          JsPlatform::Get(), globalObjectsAndGroups, objectsAndGroups),
+      fusedConditionsPredicates(nullptr) {}
 
 EventsCodeGenerator::~EventsCodeGenerator() {}
 
@@ -304,6 +304,9 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
     return ".getChild(" + ConvertToStringExplicit(childName) + ")";
   };
 
+  virtual gd::String GenerateDeclaredVariableAccessor(
+      const gd::String& childName, const gd::Variable& parentVariable);
+
   virtual gd::String GenerateVariableBracketAccessor(
       gd::String expressionCode) {
     return ".getChild(" + expressionCode + ")";
@@ -409,6 +412,46 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
   gd::String GenerateEventsFunctionReturn(
       const gd::EventsFunction& eventFunction);
 
+  /**
+   * \brief Return the name of the object filtered by the condition if the
+   * condition can be fused with the adjacent conditions filtering the same
+   * object, or an empty string otherwise.
+   *
+   * Only object and behavior conditions on a single object, without
+   * parameters giving access to other objects or to the scene, and without
+   * function calls or objects (like the variable of an object) in their
+   * expressions (which could have side effects or depend on the picked
+   * objects) can be fused. Conditions declared by events functions are never
+   * fused, as their events can have any side effect.
+   */
+  gd::String GetFusableConditionObjectName(
+      gd::Instruction& condition, gd::EventsCodeGenerationContext& context);
+
+  /**
+   * \brief Generate the code of conditions filtering the same object as a
+   * single loop on the objects list, checking the conditions for each object.
+   *
+   * \return The code, or an empty string if the conditions can't be fused.
+   * \see GetFusableConditionObjectName
+   */
+  gd::String GenerateFusedConditionsCode(
+      gd::InstructionsList& conditions,
+      std::size_t firstConditionIndex,
+      std::size_t conditionsCount,
+      const gd::String& objectName,
+      const gd::String& returnBoolean,
+      gd::EventsCodeGenerationContext& context);
+
+  /**
+   * \brief Generate the loop keeping the objects of the list for which the
+   * predicate is true.
+   */
+  gd::String GenerateObjectsListFilterCode(
+      const gd::String& objectName,
+      const gd::String& predicate,
+      const gd::String& returnBoolean,
+      gd::EventsCodeGenerationContext& context);
+
   /**
    * \brief Construct a code generator for the specified project and layout.
    */
@@ -423,6 +466,13 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
 
   gd::String codeNamespace;  ///< Optional namespace for the generated code,
                              ///< used when generating events function.
+  std::vector<gd::String>*
+      fusedConditionsPredicates;  ///< If not null, object and behavior
+                                  ///< conditions add their predicate to it
+                                  ///< instead of generating their code.
+  std::set<gd::String>
+      declaredObjectsMaps;  ///< The declarations of the maps of objects lists
+                            ///< already added outside main.
  private:
   /**
    * \brief Generate the "eventsFunctionContext" object that allow a function
@@ -4,9 +4,14 @@
  * reserved. This project is released under the MIT License.
  */
 #include "CommonConversionsExtension.h"
+
+#include <cmath>
+#include <vector>
+
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDCore/Extensions/Builtin/AllBuiltinExtensions.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
 #include "GDCore/Tools/Localization.h"
 
@@ -24,6 +29,41 @@ CommonConversionsExtension::CommonConversionsExtension() {
   GetAllExpressions()["ToRad"].SetFunctionName("gdjs.toRad");
   GetAllExpressions()["ToDeg"].SetFunctionName("gdjs.toDegrees");
 
+  const double pi = 3.14159265358979323846;
+  GetAllStrExpressions()["ToString"].SetPure(
+      [](const std::vector<gd::ExpressionConstantValue>& parameters,
+         gd::ExpressionConstantValue& result) {
+        // Only integers are converted, as JavaScript and C++ don't write
+        // other numbers the same way.
+        if (parameters.size() != 1 || parameters[0].IsString()) return false;
+        double number = parameters[0].GetNumber();
+        if (number != std::floor(number) ||
+            std::fabs(number) >= 9007199254740992.0)
+          return false;
+
+        result = gd::ExpressionConstantValue(
+            gd::String::From(static_cast<long long>(number)));
+        return true;
+      });
+  GetAllExpressions()["ToRad"].SetPure(
+      [pi](const std::vector<gd::ExpressionConstantValue>& parameters,
+           gd::ExpressionConstantValue& result) {
+        if (parameters.size() != 1 || parameters[0].IsString()) return false;
+
+        result = gd::ExpressionConstantValue(
+            (parameters[0].GetNumber() / 180) * pi);
+        return true;
+      });
+  GetAllExpressions()["ToDeg"].SetPure(
+      [pi](const std::vector<gd::ExpressionConstantValue>& parameters,
+           gd::ExpressionConstantValue& result) {
+        if (parameters.size() != 1 || parameters[0].IsString()) return false;
+
+        result = gd::ExpressionConstantValue(
+            (parameters[0].GetNumber() * 180) / pi);
+        return true;
+      });
+
   GetAllActions()["JSONToVariableStructure"].SetFunctionName(
       "gdjs.evtTools.network.jsonToVariableStructure");
   GetAllActions()["JSONToGlobalVariableStructure"].SetFunctionName(
@@ -4,10 +4,62 @@
  * reserved. This project is released under the MIT License.
  */
 #include "MathematicalToolsExtension.h"
+
+#include <cmath>
+#include <functional>
+#include <vector>
+
 #include "GDCore/Extensions/Builtin/AllBuiltinExtensions.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Tools/Localization.h"
 
+namespace {
+
+/**
+ * \brief Make the evaluator of a pure expression taking and returning
+ * numbers. The function must give the same results as the JavaScript one.
+ */
+std::function<bool(const std::vector<gd::ExpressionConstantValue>&,
+                   gd::ExpressionConstantValue&)>
+PureNumberFunction(std::function<double(const std::vector<double>&)> function) {
+  return [function](const std::vector<gd::ExpressionConstantValue>& parameters,
+                    gd::ExpressionConstantValue& result) {
+    std::vector<double> numbers;
+    for (auto& parameter : parameters) {
+      if (parameter.IsString()) return false;
+      numbers.push_back(parameter.GetNumber());
+    }
+
+    result = gd::ExpressionConstantValue(function(numbers));
+    return true;
+  };
+}
+
+// Math.min and Math.max consider that -0 is smaller than 0.
+double JsMin(double a, double b) {
+  if (a == b) return std::signbit(a) ? a : b;
+  return a < b ? a : b;
+}
+
+double JsMax(double a, double b) {
+  if (a == b) return std::signbit(a) ? b : a;
+  return a > b ? a : b;
+}
+
+double JsRound(double x) {
+  // Numbers this large are already integers (and adding 0.5 could round them).
+  if (std::fabs(x) >= 4503599627370496.0) return x;
+
+  double rounded = std::floor(x + 0.5);
+  if (rounded - x > 0.5) rounded -= 1;  // x + 0.5 was rounded up.
+  return rounded == 0 && std::signbit(x) ? -0.0 : rounded;
+}
+
+const double pi = 3.14159265358979323846;
+
+}  // namespace
+
 namespace gdjs {
 
 MathematicalToolsExtension::MathematicalToolsExtension() {
@@ -73,6 +125,70 @@ MathematicalToolsExtension::MathematicalToolsExtension() {
   GetAllExpressions()["Pi"].SetFunctionName("gdjs.evtTools.common.pi");
   GetAllExpressions()["lerpAngle"].SetFunctionName("gdjs.evtTools.common.lerpAngle");
 
+  GetAllExpressions()["cos"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::cos(x[0]); }));
+  GetAllExpressions()["sin"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::sin(x[0]); }));
+  GetAllExpressions()["tan"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::tan(x[0]); }));
+  GetAllExpressions()["acos"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::acos(x[0]); }));
+  GetAllExpressions()["asin"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::asin(x[0]); }));
+  GetAllExpressions()["atan"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::atan(x[0]); }));
+  GetAllExpressions()["atan2"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::atan2(x[0], x[1]); }));
+  GetAllExpressions()["abs"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::fabs(x[0]); }));
+  GetAllExpressions()["min"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return JsMin(x[0], x[1]); }));
+  GetAllExpressions()["max"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return JsMax(x[0], x[1]); }));
+  GetAllExpressions()["clamp"].SetPure(
+      PureNumberFunction([](const std::vector<double>& x) {
+        return JsMin(JsMax(x[0], x[1]), x[2]);
+      }));
+  GetAllExpressions()["sqrt"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::sqrt(x[0]); }));
+  GetAllExpressions()["ceil"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::ceil(x[0]); }));
+  GetAllExpressions()["floor"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::floor(x[0]); }));
+  GetAllExpressions()["exp"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::exp(x[0]); }));
+  GetAllExpressions()["log"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::log(x[0]); }));
+  GetAllExpressions()["pow"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return std::pow(x[0], x[1]); }));
+  GetAllExpressions()["sign"].SetPure(
+      PureNumberFunction([](const std::vector<double>& x) {
+        return x[0] == 0 ? 0.0 : (x[0] > 0 ? 1.0 : -1.0);
+      }));
+  GetAllExpressions()["mod"].SetPure(
+      PureNumberFunction([](const std::vector<double>& x) {
+        return x[0] - x[1] * std::floor(x[0] / x[1]);
+      }));
+  GetAllExpressions()["int"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return JsRound(x[0]); }));
+  GetAllExpressions()["rint"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return JsRound(x[0]); }));
+  GetAllExpressions()["round"].SetPure(PureNumberFunction(
+      [](const std::vector<double>& x) { return JsRound(x[0]); }));
+  GetAllExpressions()["trunc"].SetPure(
+      PureNumberFunction([](const std::vector<double>& x) {
+        // x | 0 only truncates numbers fitting in 32 bits integers.
+        return std::fabs(x[0]) < 2147483648.0 ? static_cast<double>(
+                                                    static_cast<int>(x[0]))
+                                              : NAN;
+      }));
+  GetAllExpressions()["lerp"].SetPure(
+      PureNumberFunction([](const std::vector<double>& x) {
+        return x[0] + (x[1] - x[0]) * x[2];
+      }));
+  GetAllExpressions()["Pi"].SetPure(
+      PureNumberFunction([](const std::vector<double>& x) { return pi; }));
+
   StripUnimplementedInstructionsAndExpressions();
 }
 
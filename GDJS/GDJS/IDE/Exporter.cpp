@@ -47,11 +47,13 @@ Exporter::~Exporter() {}
 bool Exporter::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
+  helper.SetEventsCodeCacheDirectory(eventsCodeCacheDir);
   return helper.ExportProjectForPixiPreview(options);
 }
 
 bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
+  helper.SetEventsCodeCacheDirectory(eventsCodeCacheDir);
   gd::Project exportedProject = options.project;
 
   auto usedExtensionsResult =
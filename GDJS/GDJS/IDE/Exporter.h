@@ -64,6 +64,20 @@ class Exporter {
     codeOutputDir = codeOutputDir_;
   }
 
+  /**
+   * \brief Change the directory where the generated events code is kept
+   * between exports, so that only the code of the modified layouts is
+   * generated again.
+   *
+   * By default, this is empty and the code of all layouts is generated at each
+   * export.
+   *
+   * \see ExporterHelper::SetEventsCodeCacheDirectory
+   */
+  void SetEventsCodeCacheDirectory(gd::String eventsCodeCacheDir_) {
+    eventsCodeCacheDir = eventsCodeCacheDir_;
+  }
+
  private:
   gd::AbstractFileSystem&
       fs;  ///< The abstract file system to be used for exportation.
@@ -72,6 +86,8 @@ class Exporter {
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
                              ///< be then copied to the final output directory.
+  gd::String eventsCodeCacheDir;  ///< The directory where the events code is
+                                  ///< cached (empty to disable the cache).
 };
 
 }  // namespace gdjs
@@ -10,14 +10,18 @@
 #endif
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <sstream>
 #include <streambuf>
 #include <string>
+#include <unordered_set>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/EffectsCodeGenerator.h"
+#include "GDCore/Events/Serialization.h"
+#include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/DependencyMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
@@ -33,13 +37,16 @@
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/ExternalLayout.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/PropertyDescriptor.h"
 #include "GDCore/Project/SourceFile.h"
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/TinyXml/tinyxml.h"
+#include "GDCore/Tools/ForEachInParallel.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/VersionWrapper.h"
 #include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
 #undef CopyFile  // Disable an annoying macro
@@ -60,6 +67,130 @@ double LogTimeSpent(const gd::String &name, double previousTime) {
   std::cout << std::endl;
   return GetTimeNow();
 }
+
+/**
+ * \brief Update a 64-bit FNV-1a hash with the given string.
+ */
+std::uint64_t UpdateHash(std::uint64_t hash, const gd::String &str) {
+  for (unsigned char byte : str.Raw()) {
+    hash ^= byte;
+    hash *= 1099511628211ULL;
+  }
+  // Separate the strings, so that "ab" + "c" is not hashed like "a" + "bc".
+  hash ^= 0xFF;
+  hash *= 1099511628211ULL;
+  return hash;
+}
+
+std::uint64_t UpdateHash(std::uint64_t hash,
+                         const gd::SerializerElement &element) {
+  return UpdateHash(hash, gd::Serializer::ToJSON(element));
+}
+
+gd::String HashToString(std::uint64_t hash) {
+  static const char *digits = "0123456789abcdef";
+  std::string str(16, '0');
+  for (std::size_t i = 0; i < 16; ++i) {
+    str[15 - i] = digits[hash & 0xF];
+    hash >>= 4;
+  }
+  return gd::String::FromUTF8(str);
+}
+
+/**
+ * \brief Update the hash with what the events code depends on in the objects:
+ * their names, types, variables and behaviors. The configuration of the objects
+ * is not used by the code generation, so is not hashed (this also avoids
+ * serializing the objects, which is as costly as generating the code).
+ */
+std::uint64_t UpdateHashWithObjects(std::uint64_t hash,
+                                    const gd::ObjectsContainer &objects) {
+  for (std::size_t i = 0; i < objects.GetObjectsCount(); ++i) {
+    const gd::Object &object = objects.GetObject(i);
+    hash = UpdateHash(hash, object.GetName());
+    hash = UpdateHash(hash, object.GetType());
+    for (const auto &behaviorName : object.GetAllBehaviorNames()) {
+      hash = UpdateHash(hash, behaviorName);
+      hash = UpdateHash(hash, object.GetBehavior(behaviorName).GetTypeName());
+    }
+
+    gd::SerializerElement variablesElement;
+    object.GetVariables().SerializeTo(variablesElement);
+    hash = UpdateHash(hash, variablesElement);
+  }
+  return hash;
+}
+
+void RemoveEventsChildren(gd::SerializerElement &element) {
+  while (element.HasChild("events")) element.RemoveChild("events");
+  for (const auto &child : element.GetAllChildren())
+    RemoveEventsChildren(*child.second);
+}
+
+/**
+ * \brief Compute a hash of everything, except the layout itself, that the
+ * events code of a layout depends on.
+ *
+ * The events of the events functions extensions are excluded: layouts only
+ * depend on the declaration of the functions, behaviors and objects.
+ */
+std::uint64_t ComputeProjectEventsCodeHash(const gd::Project &project,
+                                           bool exportForPreview) {
+  std::uint64_t hash = 14695981039346656037ULL;
+  hash = UpdateHash(hash, gd::VersionWrapper::FullString());
+  hash = UpdateHash(hash, exportForPreview ? "preview" : "export");
+
+  hash = UpdateHashWithObjects(hash, project);
+
+  gd::SerializerElement globalGroupsElement;
+  project.GetObjectGroups().SerializeTo(globalGroupsElement);
+  hash = UpdateHash(hash, globalGroupsElement);
+
+  gd::SerializerElement globalVariablesElement;
+  project.GetVariables().SerializeTo(globalVariablesElement);
+  hash = UpdateHash(hash, globalVariablesElement);
+
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i) {
+    gd::SerializerElement externalEventsElement;
+    project.GetExternalEvents(i).SerializeTo(externalEventsElement);
+    hash = UpdateHash(hash, externalEventsElement);
+  }
+
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    gd::SerializerElement extensionElement;
+    project.GetEventsFunctionsExtension(i).SerializeTo(extensionElement);
+    RemoveEventsChildren(extensionElement);
+    hash = UpdateHash(hash, extensionElement);
+  }
+
+  return hash;
+}
+
+/**
+ * \brief Compute the hash under which the events code of a layout is cached.
+ */
+gd::String ComputeLayoutEventsCodeHash(const gd::Layout &layout,
+                                       std::uint64_t projectHash) {
+  std::uint64_t hash = UpdateHash(projectHash, layout.GetName());
+
+  gd::SerializerElement eventsElement;
+  gd::EventsListSerialization::SerializeEventsTo(layout.GetEvents(),
+                                                 eventsElement);
+  hash = UpdateHash(hash, eventsElement);
+
+  hash = UpdateHashWithObjects(hash, layout);
+
+  gd::SerializerElement groupsElement;
+  layout.GetObjectGroups().SerializeTo(groupsElement);
+  hash = UpdateHash(hash, groupsElement);
+
+  gd::SerializerElement variablesElement;
+  layout.GetVariables().SerializeTo(variablesElement);
+  hash = UpdateHash(hash, variablesElement);
+
+  return HashToString(hash);
+}
 }  // namespace
 
 namespace gdjs {
@@ -95,7 +226,10 @@ static gd::String CleanProjectName(gd::String projectName) {
 ExporterHelper::ExporterHelper(gd::AbstractFileSystem &fileSystem,
                                gd::String gdjsRoot_,
                                gd::String codeOutputDir_)
-    : fs(fileSystem), gdjsRoot(gdjsRoot_), codeOutputDir(codeOutputDir_){};
+    : fs(fileSystem),
+      gdjsRoot(gdjsRoot_),
+      codeOutputDir(codeOutputDir_),
+      eventsCodeGenerationThreadsCount(0){};
 
 bool ExporterHelper::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
@@ -105,9 +239,11 @@ bool ExporterHelper::ExportProjectForPixiPreview(
   std::vector<gd::String> includesFiles;
   std::vector<gd::String> resourcesFiles;
 
-  // TODO Try to remove side effects to avoid the copy
-  // that destroys the AST in cache.
-  gd::Project exportedProject = options.project;
+  // Export a snapshot of the project: only the parts modified by the export
+  // (resources, properties...) are copied, the events and initial instances
+  // of the layouts are shared with the original project.
+  gd::Project exportedProject;
+  exportedProject.InitAsSnapshotOf(options.project);
   const gd::Project &immutableProject = exportedProject;
 
   if (options.fullLoadingScreen) {
@@ -143,8 +279,10 @@ bool ExporterHelper::ExportProjectForPixiPreview(
       fs, exportedProject.GetResourcesManager(), options.exportPath);
   // end of compatibility code
 
+  // Scan the original project, as the scan does not modify the events but
+  // would access them for modification, copying them in the snapshot.
   auto usedExtensionsResult =
-      gd::UsedExtensionsFinder::ScanProject(exportedProject);
+      gd::UsedExtensionsFinder::ScanProject(options.project);
 
   bool isUsingScene3DExtension =
       usedExtensionsResult.GetUsedExtensions().find("Scene3D") !=
@@ -271,10 +409,12 @@ gd::String ExporterHelper::ExportProjectData(
   // Save the project to JSON
   gd::SerializerElement rootElement;
   project.SerializeTo(rootElement);
-  gd::String output =
-      "gdjs.projectData = " + gd::Serializer::ToJSON(rootElement) + ";\n" +
-      "gdjs.runtimeGameOptions = " +
-      gd::Serializer::ToJSON(runtimeGameOptions) + ";\n";
+  // The JSON is directly appended to the output to avoid copying it.
+  gd::String output = "gdjs.projectData = ";
+  gd::Serializer::ToJSON(rootElement, output);
+  output += ";\ngdjs.runtimeGameOptions = ";
+  gd::Serializer::ToJSON(runtimeGameOptions, output);
+  output += ";\n";
 
   if (!fs.WriteToFile(filename, output)) return "Unable to write " + filename;
 
@@ -746,24 +886,94 @@ bool ExporterHelper::ExportEventsCode(const gd::Project &project,
                                       bool exportForPreview) {
   fs.MkDir(outputDir);
 
-  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
-    std::set<gd::String> eventsIncludes;
-    const gd::Layout &layout = project.GetLayout(i);
-    LayoutCodeGenerator layoutCodeGenerator(project);
-    gd::String eventsOutput = layoutCodeGenerator.GenerateLayoutCompleteCode(
-        layout, eventsIncludes, !exportForPreview);
+  // The project is only read by the code generation, but make sure the
+  // singletons are created before being used by the threads.
+  gd::SceneNameMangler::Get();
+  EventsCodeNameMangler::Get();
+
+  const std::size_t layoutsCount = project.GetLayoutsCount();
+  const bool useCache = !eventsCodeCacheDir.empty();
+  std::vector<gd::String> cacheHashes(layoutsCount);
+  std::vector<bool> isCached(layoutsCount, false);
+  std::vector<gd::String> eventsOutputs(layoutsCount);
+  std::vector<std::set<gd::String>> eventsIncludes(layoutsCount);
+
+  auto getCacheFilename = [&](std::size_t i, const gd::String &extension) {
+    return eventsCodeCacheDir + "/" + cacheHashes[i] + extension;
+  };
+
+  if (useCache) {
+    const std::uint64_t projectHash =
+        ComputeProjectEventsCodeHash(project, exportForPreview);
+    gd::ForEachInParallel(
+        layoutsCount, eventsCodeGenerationThreadsCount, [&](std::size_t i) {
+          cacheHashes[i] =
+              ComputeLayoutEventsCodeHash(project.GetLayout(i), projectHash);
+        });
+
+    // Each change of a layout adds files to the cache: start again from an
+    // empty cache when it is getting too large.
+    fs.MkDir(eventsCodeCacheDir);
+    const std::size_t maxCachedLayoutsCount =
+        std::max<std::size_t>(256, 4 * layoutsCount);
+    if (fs.ReadDir(eventsCodeCacheDir, ".js").size() > maxCachedLayoutsCount)
+      fs.ClearDir(eventsCodeCacheDir);
+
+    // The includes file is written after the code, so the code is known to be
+    // complete if the includes file exists.
+    for (std::size_t i = 0; i < layoutsCount; ++i) {
+      gd::String includesFilename = getCacheFilename(i, ".includes");
+      if (!fs.FileExists(includesFilename) ||
+          !fs.FileExists(getCacheFilename(i, ".js")))
+        continue;
+
+      isCached[i] = true;
+      for (const auto &include :
+           fs.ReadFile(includesFilename).Split(U'\n')) {
+        if (!include.empty()) eventsIncludes[i].insert(include);
+      }
+    }
+  }
+
+  gd::ForEachInParallel(
+      layoutsCount, eventsCodeGenerationThreadsCount, [&](std::size_t i) {
+        if (isCached[i]) return;
+
+        LayoutCodeGenerator layoutCodeGenerator(project);
+        eventsOutputs[i] = layoutCodeGenerator.GenerateLayoutCompleteCode(
+            project.GetLayout(i), eventsIncludes[i], !exportForPreview);
+      });
+
+  // Write the code and add the includes in the order of the layouts, so that
+  // the result does not depend on the order in which layouts were generated.
+  std::unordered_set<gd::String> alreadyIncludedFiles(includesFiles.begin(),
+                                                      includesFiles.end());
+  auto insertUnique = [&](const gd::String &file) {
+    if (alreadyIncludedFiles.insert(file).second) includesFiles.push_back(file);
+  };
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
     gd::String filename =
         outputDir + "/" + "code" + gd::String::From(i) + ".js";
 
     // Export the code
-    if (fs.WriteToFile(filename, eventsOutput)) {
-      for (auto &include : eventsIncludes) InsertUnique(includesFiles, include);
+    bool written = isCached[i]
+                       ? fs.CopyFile(getCacheFilename(i, ".js"), filename)
+                       : fs.WriteToFile(filename, eventsOutputs[i]);
+    if (written) {
+      for (auto &include : eventsIncludes[i]) insertUnique(include);
 
-      InsertUnique(includesFiles, filename);
+      insertUnique(filename);
     } else {
       lastError = _("Unable to write ") + filename;
       return false;
     }
+
+    if (useCache && !isCached[i]) {
+      gd::String cachedIncludes;
+      for (auto &include : eventsIncludes[i]) cachedIncludes += include + "\n";
+      if (fs.WriteToFile(getCacheFilename(i, ".js"), eventsOutputs[i]))
+        fs.WriteToFile(getCacheFilename(i, ".includes"), cachedIncludes);
+    }
   }
 
   return true;
@@ -318,10 +318,18 @@ class ExporterHelper {
    * \brief Generate the events JS code, and save them to the export directory.
    *
    * Files are named "codeX.js", X being the number of the layout in the
-   * project. \param project The project with resources to be exported. \param
-   * outputDir The directory where the events code must be generated. \param
-   * includesFiles A reference to a vector that will be filled with JS files to
-   * be exported along with the project. ( including "codeX.js" files ).
+   * project. On native builds, the code of the layouts is generated in
+   * parallel (see SetEventsCodeGenerationThreadsCount), the output being the
+   * same as when generated serially.
+   *
+   * If a cache directory is set (see SetEventsCodeCacheDirectory), the code of
+   * a layout is only generated if the layout, or something its code depends
+   * on, was changed since the code was put in the cache.
+   *
+   * \param project The project with resources to be exported.
+   * \param outputDir The directory where the events code must be generated.
+   * \param includesFiles A reference to a vector that will be filled with JS
+   * files to be exported along with the project. ( including "codeX.js" files ).
    */
   bool ExportEventsCode(const gd::Project &project,
                         gd::String outputDir,
@@ -461,6 +469,34 @@ class ExporterHelper {
     codeOutputDir = codeOutputDir_;
   }
 
+  /**
+   * \brief Change the number of threads used to generate the events code of
+   * the layouts. 0 (the default) means one thread per hardware thread, 1
+   * means that layouts are generated one after another.
+   *
+   * \note This has no effect when compiled with Emscripten: layouts are
+   * always generated one after another.
+   */
+  void SetEventsCodeGenerationThreadsCount(std::size_t threadsCount) {
+    eventsCodeGenerationThreadsCount = threadsCount;
+  }
+
+  /**
+   * \brief Set the directory where the generated events code of the layouts
+   * is kept between exports, so that the code of the layouts that were not
+   * changed is not generated again. An empty string (the default) disables
+   * the cache.
+   *
+   * The code of a layout is stored under a hash computed from its name,
+   * events, objects (names, types, behaviors and variables), groups and
+   * variables, from the global objects, groups and variables, the external
+   * events, the declarations of the events functions extensions and the
+   * version of GDevelop.
+   */
+  void SetEventsCodeCacheDirectory(const gd::String &cacheDirectory) {
+    eventsCodeCacheDir = cacheDirectory;
+  }
+
   static void AddDeprecatedFontFilesToFontResources(
       gd::AbstractFileSystem &fs,
       gd::ResourcesManager &resourcesManager,
@@ -474,6 +510,11 @@ class ExporterHelper {
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
                              ///< be then copied to the final output directory.
+  std::size_t eventsCodeGenerationThreadsCount;  ///< The number of threads
+                                                 ///< used to generate events
+                                                 ///< code (0 for automatic).
+  gd::String eventsCodeCacheDir;  ///< The directory where the events code is
+                                  ///< cached (empty to disable the cache).
 };
 
 }  // namespace gdjs
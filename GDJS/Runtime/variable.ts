@@ -23,6 +23,10 @@ namespace gdjs {
     _children: Children = {};
     _childrenArray: gdjs.Variable[] = [];
     _undefinedInContainer: boolean = false;
+    /** The children already accessed with `getChildFromIndex`, by index. */
+    _childrenSlots: gdjs.Variable[] | null = null;
+    /** The names of the children stored in `_childrenSlots`. */
+    _childrenSlotsNames: string[] | null = null;
 
     /**
      * @param [varData] The optional initial content of the variable.
@@ -39,6 +43,7 @@ namespace gdjs {
       this._children = {};
       this._childrenArray = [];
       this._undefinedInContainer = false;
+      this._clearChildrenSlots();
 
       if (varData !== undefined) {
         this._type = varData.type || 'number';
@@ -248,6 +253,7 @@ namespace gdjs {
         if (this._type === 'structure') return;
         this._children = this.getAllChildren();
         this._type = 'structure';
+        this._clearChildrenSlots();
       } else if (newType === 'array') {
         if (this._type === 'array') return;
         this._childrenArray = this.getAllChildrenArray();
@@ -277,6 +283,45 @@ namespace gdjs {
       return this._children[childName];
     }
 
+    /**
+     * Get the child with the specified name, using an index given by the
+     * events generated code to the declared children of a structure.
+     *
+     * After the first access, the child is found without a lookup by name
+     * (unless the children were modified).
+     * @param index The index of the child, unique among the children.
+     * @param childName The name of the child
+     * @returns The child variable
+     */
+    getChildFromIndex(index: integer, childName: string): gdjs.Variable {
+      if (
+        this._type === 'structure' &&
+        this._childrenSlotsNames !== null &&
+        this._childrenSlotsNames[index] === childName
+      )
+        return (this._childrenSlots as gdjs.Variable[])[index];
+
+      const child = this.getChild(childName);
+      if (this._type === 'structure') {
+        if (this._childrenSlotsNames === null) {
+          this._childrenSlotsNames = [];
+          this._childrenSlots = [];
+        }
+        this._childrenSlotsNames[index] = childName;
+        (this._childrenSlots as gdjs.Variable[])[index] = child;
+      }
+      return child;
+    }
+
+    /**
+     * Forget the children stored in slots, to be called when children
+     * of the structure are removed or replaced.
+     */
+    _clearChildrenSlots() {
+      this._childrenSlots = null;
+      this._childrenSlotsNames = null;
+    }
+
     /**
      * Add a child variable with the specified name.
      *
@@ -289,6 +334,7 @@ namespace gdjs {
       // Make sure this is a structure
       this.castTo('structure');
       this._children[childName] = childVariable;
+      this._clearChildrenSlots();
       return this;
     }
 
@@ -313,6 +359,7 @@ namespace gdjs {
     removeChild(childName: string) {
       if (this._type !== 'structure') return;
       delete this._children[childName];
+      this._clearChildrenSlots();
     }
 
     /**
@@ -321,6 +368,7 @@ namespace gdjs {
     clearChildren() {
       this._children = {};
       this._childrenArray = [];
+      this._clearChildrenSlots();
     }
 
     /**
@@ -330,6 +378,7 @@ namespace gdjs {
     replaceChildren(newChildren: Children) {
       this._type = 'structure';
       this._children = newChildren;
+      this._clearChildrenSlots();
     }
 
     /**
@@ -223,6 +223,8 @@ namespace gdjs {
       _str: '',
       _undefinedInContainer: true,
       _value: 0,
+      _childrenSlots: null,
+      _childrenSlotsNames: null,
       fromJSON: () => gdjs.VariablesContainer.badVariable,
       toJSObject: () => 0,
       fromJSObject: () => gdjs.VariablesContainer.badVariable,
@@ -243,6 +245,8 @@ namespace gdjs {
       setValue: () => {},
       getValue: () => 0,
       getChild: () => gdjs.VariablesContainer.badVariable,
+      getChildFromIndex: () => gdjs.VariablesContainer.badVariable,
+      _clearChildrenSlots: () => {},
       getChildAt: () => gdjs.VariablesContainer.badVariable,
       hasChild: function () {
         return false;
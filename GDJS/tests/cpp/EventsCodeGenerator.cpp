@@ -0,0 +1,183 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDJS/Events/CodeGeneration/EventsCodeGenerator.h"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "GDCore/Events/Builtin/ForEachEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/MultipleInstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDJS/Events/CodeGeneration/MetadataDeclarationHelper.h"
+#include "GDJS/Extensions/JsPlatform.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::Instruction MakeInstruction(const gd::String& type,
+                                const std::vector<gd::String>& parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+
+  return instruction;
+}
+
+std::size_t CountFilterLoops(const gd::String& code) {
+  std::size_t count = 0;
+  for (std::size_t pos = code.find(".length = k;"); pos != gd::String::npos;
+       pos = code.find(".length = k;", pos + 1))
+    ++count;
+
+  return count;
+}
+
+}  // namespace
+
+TEST_CASE("EventsCodeGenerator", "[gdjs]") {
+  SECTION("Conditions of events-based behaviors are not fused") {
+    gd::Project project;
+    project.AddPlatform(gdjs::JsPlatform::Get());
+
+    auto& eventsFunctionsExtension =
+        project.InsertNewEventsFunctionsExtension("MyExtension", 0);
+    auto& eventsBasedBehavior =
+        eventsFunctionsExtension.GetEventsBasedBehaviors().InsertNew(
+            "MyBehavior", 0);
+    auto& eventsFunction =
+        eventsBasedBehavior.GetEventsFunctions().InsertNewEventsFunction(
+            "IsActive", 0);
+    eventsFunction.SetFunctionType(gd::EventsFunction::Condition);
+    gd::ParameterMetadata objectParameter;
+    objectParameter.SetType("object").SetName("Object");
+    eventsFunction.GetParameters().push_back(objectParameter);
+    gd::ParameterMetadata behaviorParameter;
+    behaviorParameter.SetType("behavior")
+        .SetName("Behavior")
+        .SetExtraInfo("MyExtension::MyBehavior");
+    eventsFunction.GetParameters().push_back(behaviorParameter);
+
+    auto extension = std::make_shared<gd::PlatformExtension>();
+    gdjs::MetadataDeclarationHelper::DeclareExtension(
+        *extension, eventsFunctionsExtension);
+    std::map<gd::String, gd::String> behaviorMethodMangledNames;
+    gdjs::MetadataDeclarationHelper::GenerateBehaviorMetadata(
+        project, *extension, eventsFunctionsExtension, eventsBasedBehavior,
+        behaviorMethodMangledNames);
+    gdjs::JsPlatform::Get().AddExtension(extension);
+
+    auto& layout = project.InsertNewLayout("Scene", 0);
+    auto& player = layout.InsertNewObject(project, "Sprite", "Player", 0);
+    player.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+
+    auto generateCode = [&](const std::vector<gd::Instruction>& conditions) {
+      gd::StandardEvent event;
+      event.SetType("BuiltinCommonInstructions::Standard");
+      for (const auto& condition : conditions)
+        event.GetConditions().Insert(condition);
+      event.GetActions().Insert(MakeInstruction("Delete", {"Player", ""}));
+      layout.GetEvents().Clear();
+      layout.GetEvents().InsertEvent(event);
+
+      std::set<gd::String> includeFiles;
+      return gdjs::EventsCodeGenerator::GenerateLayoutCode(
+          project, layout, "gdjs.SceneCode", includeFiles, true);
+    };
+
+    // Builtin object conditions are fused in a single loop...
+    REQUIRE(CountFilterLoops(generateCode(
+                {MakeInstruction("PosX", {"Player", ">", "0"}),
+                 MakeInstruction("PosX", {"Player", "<", "100"})})) == 1);
+
+    // ...but a condition running the events of a behavior function splits
+    // them: each one is filtered in its own loop.
+    gd::String code = generateCode(
+        {MakeInstruction("PosX", {"Player", ">", "0"}),
+         MakeInstruction("MyExtension::MyBehavior::IsActive",
+                         {"Player", "MyBehavior"}),
+         MakeInstruction("PosX", {"Player", "<", "100"})});
+    REQUIRE(code.find(".getBehavior(\"MyBehavior\").IsActive(") !=
+            gd::String::npos);
+    REQUIRE(CountFilterLoops(code) == 3);
+
+    gdjs::JsPlatform::Get().RemoveExtension("MyExtension");
+  }
+
+  SECTION(
+      "Objects lists needed in the async callback of an event are copied by "
+      "the previous events") {
+    gd::Project project;
+    project.AddPlatform(gdjs::JsPlatform::Get());
+    auto& layout = project.InsertNewLayout("Scene", 0);
+    layout.InsertNewObject(project, "Sprite", "Player", 0);
+    layout.InsertNewObject(project, "Sprite", "Enemy", 1);
+
+    // A "For each" event (emptying an objects list for each picked object),
+    // followed by an event waiting before using objects picked by the parent
+    // event.
+    auto generateCode = [&](const gd::String& objectUsedAfterWait) {
+      gd::StandardEvent event;
+      event.SetType("BuiltinCommonInstructions::Standard");
+      event.GetConditions().Insert(
+          MakeInstruction("PosX", {"Player", ">", "0"}));
+
+      gd::ForEachEvent forEachEvent;
+      forEachEvent.SetType("BuiltinCommonInstructions::ForEach");
+      forEachEvent.SetObjectToPick("Player");
+      forEachEvent.GetConditions().Insert(
+          MakeInstruction("PosX", {"Player", "<", "100"}));
+      forEachEvent.GetActions().Insert(
+          MakeInstruction("MettreX", {"Player", "=", "1"}));
+      event.GetSubEvents().InsertEvent(forEachEvent);
+
+      gd::StandardEvent asyncEvent;
+      asyncEvent.SetType("BuiltinCommonInstructions::Standard");
+      asyncEvent.GetActions().Insert(MakeInstruction("Wait", {"1.5"}));
+      asyncEvent.GetActions().Insert(
+          MakeInstruction("MettreX", {objectUsedAfterWait, "+", "1"}));
+      event.GetSubEvents().InsertEvent(asyncEvent);
+
+      layout.GetEvents().Clear();
+      layout.GetEvents().InsertEvent(event);
+
+      std::set<gd::String> includeFiles;
+      return gdjs::EventsCodeGenerator::GenerateLayoutCode(
+          project, layout, "gdjs.SceneCode", includeFiles, true);
+    };
+
+    // The callback uses the objects picked by the parent, so the "For each"
+    // event must work on a copy of them...
+    gd::String code = generateCode("Player");
+    REQUIRE(code.find("gdjs.copyArray(gdjs.SceneCode.GDPlayerObjects1, "
+                      "gdjs.SceneCode.GDPlayerObjects2);") !=
+            gd::String::npos);
+    REQUIRE(code.find("for (const obj of gdjs.SceneCode.GDPlayerObjects1) "
+                      "asyncObjectsList.addObject(\"Player\", obj);") !=
+            gd::String::npos);
+
+    // ...but can use them directly if the callback doesn't use them.
+    code = generateCode("Enemy");
+    REQUIRE(code.find("gdjs.copyArray(gdjs.SceneCode.GDPlayerObjects1, "
+                      "gdjs.SceneCode.GDPlayerObjects2);") ==
+            gd::String::npos);
+    REQUIRE(code.find("asyncObjectsList.addObject(\"Player\"") ==
+            gd::String::npos);
+  }
+}
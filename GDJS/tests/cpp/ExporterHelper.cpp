@@ -0,0 +1,171 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDJS/IDE/ExporterHelper.h"
+
+#include <map>
+#include <vector>
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "GDJS/Extensions/JsPlatform.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * \brief A file system keeping the written files in memory.
+ */
+class InMemoryFileSystem : public gd::AbstractFileSystem {
+ public:
+  virtual void MkDir(const gd::String& path){};
+  virtual bool DirExists(const gd::String& path) { return true; };
+  virtual bool FileExists(const gd::String& path) {
+    return files.find(path) != files.end();
+  };
+  virtual gd::String FileNameFrom(const gd::String& file) {
+    size_t pos = file.find_last_of("/");
+    return pos != gd::String::npos ? file.substr(pos + 1) : file;
+  };
+  virtual gd::String DirNameFrom(const gd::String& file) {
+    size_t pos = file.find_last_of("/");
+    return pos != gd::String::npos ? file.substr(0, pos) : "";
+  };
+  virtual bool MakeAbsolute(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (!IsAbsolute(filename)) filename = baseDirectory + "/" + filename;
+    return true;
+  };
+  virtual bool MakeRelative(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (filename.find(baseDirectory) == 0)
+      filename = filename.substr(baseDirectory.size());
+    return true;
+  };
+  virtual bool IsAbsolute(const gd::String& filename) {
+    return !filename.empty() && filename[0] == '/';
+  }
+  virtual bool CopyFile(const gd::String& file, const gd::String& destination) {
+    if (!FileExists(file)) return false;
+    files[destination] = files[file];
+    return true;
+  }
+  virtual bool ClearDir(const gd::String& directory) { return true; }
+  virtual bool WriteToFile(const gd::String& file, const gd::String& content) {
+    files[file] = content;
+    return true;
+  }
+  virtual gd::String ReadFile(const gd::String& file) { return files[file]; }
+  virtual gd::String GetTempDir() { return "/tmp"; }
+  virtual std::vector<gd::String> ReadDir(const gd::String& path,
+                                          const gd::String& extension = "") {
+    return {};
+  }
+
+  /**
+   * \brief Return the files written in \a directory, by name.
+   */
+  std::map<gd::String, gd::String> GetFilesIn(const gd::String& directory) {
+    std::map<gd::String, gd::String> filesInDirectory;
+    for (const auto& file : files) {
+      if (DirNameFrom(file.first) == directory)
+        filesInDirectory[FileNameFrom(file.first)] = file.second;
+    }
+    return filesInDirectory;
+  }
+
+  std::map<gd::String, gd::String> files;
+};
+
+gd::Instruction MakeInstruction(const gd::String& type,
+                                const std::vector<gd::String>& parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+
+  return instruction;
+}
+
+/**
+ * \brief Fill the project with layouts having different objects, variables
+ * and events.
+ */
+void SetupProjectWithLayouts(gd::Project& project, std::size_t layoutsCount) {
+  project.AddPlatform(gdjs::JsPlatform::Get());
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
+    const gd::String suffix = gd::String::From(i);
+    auto& layout =
+        project.InsertNewLayout("Layout" + suffix, project.GetLayoutsCount());
+    layout.InsertNewObject(project, "Sprite", "Player", 0);
+    layout.InsertNewObject(project, "Sprite", "Enemy" + suffix, 1);
+    layout.GetVariables().InsertNew("Score" + suffix, 0).SetValue(i);
+
+    for (std::size_t j = 0; j < 10; ++j) {
+      const gd::String value = gd::String::From(j * 10 + i);
+      gd::StandardEvent event;
+      event.SetType("BuiltinCommonInstructions::Standard");
+      event.GetConditions().Insert(
+          MakeInstruction("PosX", {"Player", ">", value}));
+      event.GetActions().Insert(MakeInstruction(
+          "MettreX", {"Enemy" + suffix, "+", "Player.X() + " + value}));
+
+      gd::StandardEvent subEvent;
+      subEvent.SetType("BuiltinCommonInstructions::Standard");
+      subEvent.GetConditions().Insert(
+          MakeInstruction("PosX", {"Enemy" + suffix, "<", value}));
+      subEvent.GetActions().Insert(
+          MakeInstruction("Delete", {"Player", ""}));
+      event.GetSubEvents().InsertEvent(subEvent);
+
+      layout.GetEvents().InsertEvent(event);
+    }
+  }
+}
+
+}  // namespace
+
+TEST_CASE("ExporterHelper", "[gdjs]") {
+  SECTION("Events code generated in parallel is the same as in serial") {
+    gd::Project project;
+    SetupProjectWithLayouts(project, 24);
+
+    InMemoryFileSystem fs;
+    auto exportEventsCode = [&](std::size_t threadsCount,
+                                const gd::String& outputDir) {
+      gdjs::ExporterHelper helper(fs, "/gdjs-root", "/code-output");
+      helper.SetEventsCodeGenerationThreadsCount(threadsCount);
+      std::vector<gd::String> includesFiles;
+      REQUIRE(helper.ExportEventsCode(project, outputDir, includesFiles, true));
+      return includesFiles;
+    };
+
+    std::vector<gd::String> serialIncludesFiles =
+        exportEventsCode(1, "/serial");
+    std::vector<gd::String> parallelIncludesFiles =
+        exportEventsCode(8, "/parallel");
+
+    auto serialFiles = fs.GetFilesIn("/serial");
+    auto parallelFiles = fs.GetFilesIn("/parallel");
+    REQUIRE(serialFiles.size() == 24);
+    REQUIRE(serialFiles == parallelFiles);
+    REQUIRE(serialFiles["code23.js"].find(
+                "GDEnemy23Objects1[i].getX() < 113") != gd::String::npos);
+
+    // Includes are the same, in the same order, except for the directory of
+    // the code files.
+    REQUIRE(serialIncludesFiles.size() == parallelIncludesFiles.size());
+    for (std::size_t i = 0; i < serialIncludesFiles.size(); ++i) {
+      REQUIRE(serialIncludesFiles[i].FindAndReplace("/serial/", "/") ==
+              parallelIncludesFiles[i].FindAndReplace("/parallel/", "/"));
+    }
+  }
+}
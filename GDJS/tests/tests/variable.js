@@ -124,6 +124,42 @@ describe('gdjs.Variable', function () {
     expect(structure.getAllChildrenArray()[0].getAsString()).to.be('Hello');
   });
 
+  it('can get children from an index', function () {
+    const structure = new gdjs.Variable({
+      type: 'structure',
+      children: [
+        { name: 'foo', value: 'Hello', type: 'string' },
+        { name: 'bar', value: 'World', type: 'string' },
+      ],
+    });
+
+    const foo = structure.getChildFromIndex(1, 'foo');
+    expect(foo.getAsString()).to.be('Hello');
+    expect(structure.getChildFromIndex(1, 'foo')).to.be(foo);
+    expect(structure.getChildFromIndex(0, 'bar').getAsString()).to.be('World');
+
+    // Missing children are added, like with getChild.
+    structure.getChildFromIndex(2, 'baz').setNumber(3);
+    expect(structure.getChild('baz').getAsNumber()).to.be(3);
+
+    // Replaced or removed children are not given anymore.
+    const newFoo = new gdjs.Variable({ value: 'Hi', type: 'string' });
+    structure.addChild('foo', newFoo);
+    expect(structure.getChildFromIndex(1, 'foo')).to.be(newFoo);
+    structure.removeChild('foo');
+    expect(structure.getChildFromIndex(1, 'foo').getAsString()).to.be('0');
+    structure.setNumber(5);
+    expect(structure.getChildFromIndex(0, 'bar').getAsString()).to.be('0');
+    expect(structure.getType()).to.be('structure');
+
+    // Arrays are accessed like with getChild.
+    const array = new gdjs.Variable({
+      type: 'array',
+      children: [{ value: 'Hello', type: 'string' }],
+    });
+    expect(array.getChildFromIndex(3, '0').getAsString()).to.be('Hello');
+  });
+
   it('can be serialized to JSON', function () {
     var structure = new gdjs.Variable({ value: '0' });
 
@@ -31,6 +31,7 @@
 #include <GDCore/IDE/Events/EventsLeaderboardsRenamer.h>
 #include <GDCore/IDE/Events/EventsPositionFinder.h>
 #include <GDCore/IDE/Events/EventsRefactorer.h>
+#include <GDCore/IDE/Events/EventsReferencesIndex.h>
 #include <GDCore/IDE/Events/EventsRemover.h>
 #include <GDCore/IDE/Events/EventsTypesLister.h>
 #include <GDCore/IDE/Events/ExpressionCompletionFinder.h>
@@ -53,6 +54,7 @@
 #include <GDCore/IDE/Project/ResourcesMergingHelper.h>
 #include <GDCore/IDE/Project/ResourcesRenamer.h>
 #include <GDCore/IDE/PropertyFunctionGenerator.h>
+#include <GDCore/IDE/NewNameGenerator.h>
 #include <GDCore/IDE/ProjectBrowserHelper.h>
 #include <GDCore/IDE/WholeProjectRefactorer.h>
 #include <GDCore/IDE/UnfilledRequiredBehaviorPropertyProblem.h>
@@ -80,6 +82,7 @@
 #include <GDCore/Project/VariablesContainer.h>
 #include <GDCore/Serialization/Serializer.h>
 #include <GDCore/Serialization/SerializerElement.h>
+#include <GDCore/Tools/SystemStats.h>
 #include <GDJS/Events/Builtin/JsCodeEvent.h>
 #include <GDJS/Events/CodeGeneration/BehaviorCodeGenerator.h>
 #include <GDJS/Events/CodeGeneration/ObjectCodeGenerator.h>
@@ -425,6 +428,8 @@ typedef std::vector<gd::EventsFunction> VectorEventsFunction;
 typedef gd::Object gdObject;  // To avoid clashing javascript Object in glue.js
 typedef ParticleEmitterObject::RendererType ParticleEmitterObject_RendererType;
 typedef EventsFunction::FunctionType EventsFunction_FunctionType;
+typedef EventsReferencesIndex::ReferenceType
+    EventsReferencesIndex_ReferenceType;
 typedef std::unique_ptr<gd::Object> UniquePtrObject;
 typedef std::unique_ptr<gd::ObjectConfiguration> UniquePtrObjectConfiguration;
 typedef std::unique_ptr<ExpressionNode> UniquePtrExpressionNode;
@@ -447,6 +452,7 @@ typedef std::map<gd::String, gd::SerializerValue> MapStringSerializerValue;
 typedef std::vector<std::pair<gd::String, std::shared_ptr<SerializerElement>>>
     VectorPairStringSharedPtrSerializerElement;
 typedef std::shared_ptr<SerializerElement> SharedPtrSerializerElement;
+typedef std::string BinaryBuffer;
 typedef std::vector<UnfilledRequiredBehaviorPropertyProblem> VectorUnfilledRequiredBehaviorPropertyProblem;
 
 typedef ExtensionAndMetadata<BehaviorMetadata> ExtensionAndBehaviorMetadata;
@@ -479,6 +485,7 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define WRAPPED_SetInt(v) SetValue(v)
 #define WRAPPED_SetDouble(v) SetValue(v)
 #define WRAPPED_SetChild(name, child) GetChild(name) = child
+#define WRAPPED_GetDataPointer() empty() ? nullptr : &self->operator[](0)
 
 // Wrappers to avoid dealing with shared_ptr in the methods interface:
 #define WRAPPED_AddBehavior(name,                      \
@@ -519,6 +526,11 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define STATIC_ValidateName ValidateName
 #define STATIC_ToJSON ToJSON
 #define STATIC_FromJSON(x) FromJSON(x)
+#define STATIC_ToBinaryBuffer(element, output) ToBinary(element, output)
+#define STATIC_FromBinaryOrJSONBuffer(data, size) \
+  FromBinaryOrJSON(static_cast<const char *>(data), size)
+#define STATIC_GetResidentMemory GetResidentMemory
+#define STATIC_GetPeakResidentMemory GetPeakResidentMemory
 #define STATIC_IsObject IsObject
 #define STATIC_IsBehavior IsBehavior
 #define STATIC_IsExpression IsExpression
@@ -526,6 +538,7 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define STATIC_IsTypeBehavior IsTypeBehavior
 #define STATIC_IsTypeExpression IsTypeExpression
 #define STATIC_GetExpressionValueType GetExpressionValueType
+#define STATIC_HasNoErrors HasNoErrors
 #define STATIC_GetPrimitiveValueType GetPrimitiveValueType
 #define STATIC_ConvertPropertyTypeToValueType ConvertPropertyTypeToValueType
 #define STATIC_Get Get
@@ -641,6 +654,12 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define STATIC_GetObjectParameterIndexFor GetObjectParameterIndexFor
 
 #define STATIC_GetNamespaceSeparator GetNamespaceSeparator
+
+#define STATIC_GenerateAllObjectNames GenerateAllObjectNames
+#define STATIC_GenerateAllLayerNames GenerateAllLayerNames
+#define STATIC_GenerateAllVariableNames GenerateAllVariableNames
+#define STATIC_GenerateAllResourceNames GenerateAllResourceNames
+
 #define STATIC_RenameEventsFunctionsExtension RenameEventsFunctionsExtension
 #define STATIC_UpdateExtensionNameInEventsBasedBehavior UpdateExtensionNameInEventsBasedBehavior
 #define STATIC_RenameEventsFunction RenameEventsFunction
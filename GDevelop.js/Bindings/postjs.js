@@ -266,6 +266,30 @@ var adaptNamingConventions = function (gd) {
     return null;
   };
 
+  // Add gd.Serializer.toBinary and gd.Serializer.fromBinaryOrJSON, copying the
+  // data of the binary format (see gd::Serializer::ToBinary) from/to the
+  // Emscripten heap.
+  gd.Serializer.toBinary = function (element) {
+    var buffer = new gd.BinaryBuffer();
+    gd.Serializer.toBinaryBuffer(element, buffer);
+    var pointer = buffer.getDataPointer();
+    var data = HEAPU8.slice(pointer, pointer + buffer.size());
+    buffer.delete();
+
+    return data;
+  };
+
+  // Like gd.Serializer.fromJSON, the returned element is owned by libGD.js
+  // and is replaced at the next call: it must not be deleted.
+  gd.Serializer.fromBinaryOrJSON = function (data) {
+    var pointer = _malloc(data.length);
+    HEAPU8.set(data, pointer);
+    var element = gd.Serializer.fromBinaryOrJSONBuffer(pointer, data.length);
+    _free(pointer);
+
+    return element;
+  };
+
   //Preserve backward compatibility with some alias for methods:
   gd.VectorString.prototype.get = gd.VectorString.prototype.at;
   gd.VectorPlatformExtension.prototype.get =
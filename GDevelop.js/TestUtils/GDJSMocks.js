@@ -140,6 +140,15 @@ class Variable {
     return this._children[childName];
   }
 
+  /**
+   * @param {number} index
+   * @param {string} childName
+   * @returns {Variable}
+   */
+  getChildFromIndex(index, childName) {
+    return this.getChild(childName);
+  }
+
   getAllChildren() {
     return this._children;
   }
@@ -554,6 +554,38 @@ describe('libGD.js', function () {
       container.removeAllInstancesOnLayer('YetAnotherLayer');
       expect(container.getInstancesCount()).toBe(1);
     });
+    it('finding instances in a region', function () {
+      container.setSpatialIndexEnabled(true);
+      expect(container.isSpatialIndexEnabled()).toBe(true);
+
+      let instance = container.insertNewInitialInstance();
+      instance.setObjectName('MyObject5');
+      instance.setX(100);
+      instance.setY(100);
+      container.setObjectDefaultSize('MyObject5', 50, 50);
+
+      let names = [];
+      let functor = new gd.InitialInstanceJSFunctor();
+      functor.invoke = function (instance) {
+        instance = gd.wrapPointer(instance, gd.InitialInstance);
+        names.push(instance.getObjectName());
+      };
+      container.iterateOverInstancesAtPoint(functor, '', 120, 130);
+      expect(names).toEqual(['MyObject5']);
+
+      names = [];
+      container.iterateOverInstancesInRegion(functor, '', -10, -10, 10, 10);
+      expect(names).toEqual(['MyObject2']);
+
+      names = [];
+      instance.setX(-100);
+      container.iterateOverInstancesAtPoint(functor, '', 120, 130);
+      expect(names).toEqual([]);
+
+      container.removeInstance(instance);
+      container.setSpatialIndexEnabled(false);
+      expect(container.isSpatialIndexEnabled()).toBe(false);
+    });
     it('can be serialized', function () {
       expect(container.serializeTo).not.toBe(undefined);
       expect(container.unserializeFrom).not.toBe(undefined);
@@ -4384,4 +4416,82 @@ describe('libGD.js', function () {
       ).toBe(true);
     });
   });
+
+  describe('gd.NewNameGenerator', () => {
+    it('generates unique names for pasted objects and layers', () => {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+      project.insertNewObject(project, 'Sprite', 'GlobalObject', 0);
+      layout.insertNewObject(project, 'Sprite', 'MyObject', 0);
+      layout.insertNewObject(project, 'Sprite', 'MyObject2', 1);
+      layout.insertNewLayer('MyLayer', 0);
+
+      const objectNames = new gd.VectorString();
+      ['MyObject', 'MyObject', 'MyObject2', 'GlobalObject', 'Other'].forEach(
+        name => objectNames.push_back(name)
+      );
+      expect(
+        gd.NewNameGenerator.generateAllObjectNames(
+          objectNames,
+          '',
+          project,
+          layout
+        ).toJSArray()
+      ).toEqual(['MyObject3', 'MyObject4', 'MyObject5', 'GlobalObject2', 'Other']);
+      objectNames.delete();
+
+      const layerNames = new gd.VectorString();
+      layerNames.push_back('MyLayer');
+      layerNames.push_back('MyLayer');
+      expect(
+        gd.NewNameGenerator.generateAllLayerNames(
+          layerNames,
+          '',
+          layout
+        ).toJSArray()
+      ).toEqual(['MyLayer2', 'MyLayer3']);
+      layerNames.delete();
+
+      project.delete();
+    });
+  });
+
+  describe('gd.EventsReferencesIndex', () => {
+    it('finds the usages of an object', () => {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+      layout.insertNewObject(project, 'Sprite', 'MyCharacter', 0);
+      layout.insertNewObject(project, 'Sprite', 'OtherCharacter', 1);
+
+      const events = layout.getEvents();
+      const event = new gd.StandardEvent();
+      const action = new gd.Instruction();
+      action.setType('Delete');
+      action.setParametersCount(1);
+      action.setParameter(0, 'OtherCharacter');
+      event.getActions().push_back(action);
+      events.insertEvent(event, 0);
+      action.setParameter(0, 'MyCharacter');
+      event.getActions().push_back(action);
+      events.insertEvent(event, 1);
+      action.delete();
+      event.delete();
+
+      project.setEventsReferencesIndexEnabled(true);
+      const usages = project
+        .getEventsReferencesIndex()
+        .findUsages(
+          events,
+          project,
+          layout,
+          gd.EventsReferencesIndex.Object,
+          'MyCharacter'
+        );
+      expect(usages.size()).toBe(1);
+      expect(usages.at(0).getPositionInList()).toBe(1);
+      expect(gd.compare(usages.at(0).getEventsList(), events)).toBe(true);
+
+      project.delete();
+    });
+  });
 });
@@ -198,6 +198,190 @@ describe('libGD.js - GDJS related tests', function () {
 }`
       );
     });
+
+    describe('Events code cache', () => {
+      const cacheDir = '/fake-cache-dir';
+
+      // Fake file system remembering the files written in the cache directory.
+      const makeFakeFileSystemWithCache = () => {
+        const cachedFiles = {};
+        const fs = makeFakeAbstractFileSystem(gd, {
+          '/fake-gdjs-root/Runtime/index.html': fakeIndexHtmlContent,
+        });
+        const isInCache = (filePath) => filePath.startsWith(cacheDir + '/');
+        const writeToFile = fs.writeToFile.getMockImplementation();
+        fs.writeToFile.mockImplementation((filePath, content) => {
+          if (isInCache(filePath)) cachedFiles[filePath] = content;
+          return writeToFile(filePath, content);
+        });
+        const readFile = fs.readFile;
+        fs.readFile = (filePath) =>
+          isInCache(filePath) ? cachedFiles[filePath] : readFile(filePath);
+        fs.fileExists = (filePath) =>
+          isInCache(filePath) ? cachedFiles.hasOwnProperty(filePath) : true;
+        fs.readDir = (directoryPath, extension) => {
+          const files = new gd.VectorString();
+          Object.keys(cachedFiles)
+            .filter(
+              (filePath) =>
+                path.posix.dirname(filePath) === directoryPath &&
+                filePath.endsWith(extension)
+            )
+            .forEach((filePath) => files.push_back(filePath));
+          return files;
+        };
+        fs.clearDir = jest.fn((directoryPath) => {
+          Object.keys(cachedFiles)
+            .filter((filePath) => path.posix.dirname(filePath) === directoryPath)
+            .forEach((filePath) => delete cachedFiles[filePath]);
+          return true;
+        });
+
+        return { fs, cachedFiles };
+      };
+
+      const makeProjectWithTwoLayouts = () => {
+        const project = gd.ProjectHelper.createNewGDJSProject();
+        for (const layoutName of ['Scene1', 'Scene2']) {
+          const layout = project.insertNewLayout(
+            layoutName,
+            project.getLayoutsCount()
+          );
+          layout
+            .getEvents()
+            .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+        }
+        project
+          .insertNewEventsFunctionsExtension('MyExtension', 0)
+          .insertNewEventsFunction('MyFunction', 0);
+
+        return project;
+      };
+
+      const exportProject = (project, fs) => {
+        fs.writeToFile.mockClear();
+        fs.copyFile.mockClear();
+        fs.clearDir.mockClear();
+
+        const exporter = new gd.Exporter(fs, '/fake-gdjs-root');
+        exporter.setEventsCodeCacheDirectory(cacheDir);
+        const exportOptions = new gd.ExportOptions(project, '/fake-export-dir');
+        expect(exporter.exportWholePixiProject(exportOptions)).toBe(true);
+        exportOptions.delete();
+        exporter.delete();
+      };
+
+      // Give, for each layout code file, if it was generated or copied from
+      // the cache.
+      const getLayoutsCodeOrigins = (fs) => {
+        const origins = {};
+        fs.writeToFile.mock.calls
+          .map(([filePath]) => path.posix.basename(filePath))
+          .filter((fileName) => /^code[0-9]+\.js$/.test(fileName))
+          .forEach((fileName) => (origins[fileName] = 'generated'));
+        fs.copyFile.mock.calls
+          .filter(([srcPath]) => srcPath.startsWith(cacheDir + '/'))
+          .map(([, destPath]) => path.posix.basename(destPath))
+          .forEach((fileName) => (origins[fileName] = 'cached'));
+        return origins;
+      };
+
+      it('copies the code of unchanged layouts from the cache', () => {
+        const project = makeProjectWithTwoLayouts();
+        const { fs } = makeFakeFileSystemWithCache();
+
+        exportProject(project, fs);
+        expect(getLayoutsCodeOrigins(fs)).toEqual({
+          'code0.js': 'generated',
+          'code1.js': 'generated',
+        });
+
+        exportProject(project, fs);
+        expect(getLayoutsCodeOrigins(fs)).toEqual({
+          'code0.js': 'cached',
+          'code1.js': 'cached',
+        });
+
+        project.delete();
+      });
+
+      it('only generates again the code of the changed layout', () => {
+        const project = makeProjectWithTwoLayouts();
+        const { fs } = makeFakeFileSystemWithCache();
+        exportProject(project, fs);
+
+        project
+          .getLayout('Scene2')
+          .getEvents()
+          .insertNewEvent(project, 'BuiltinCommonInstructions::Comment', 0);
+        exportProject(project, fs);
+        expect(getLayoutsCodeOrigins(fs)).toEqual({
+          'code0.js': 'cached',
+          'code1.js': 'generated',
+        });
+
+        project.delete();
+      });
+
+      it('generates again the code of every layout when a global variable changes', () => {
+        const project = makeProjectWithTwoLayouts();
+        const { fs } = makeFakeFileSystemWithCache();
+        exportProject(project, fs);
+
+        project
+          .getVariables()
+          .insertNew('MyGlobalVariable', 0)
+          .setValue(123);
+        exportProject(project, fs);
+        expect(getLayoutsCodeOrigins(fs)).toEqual({
+          'code0.js': 'generated',
+          'code1.js': 'generated',
+        });
+
+        project.delete();
+      });
+
+      it('generates again the code of every layout when an extension function declaration changes', () => {
+        const project = makeProjectWithTwoLayouts();
+        const { fs } = makeFakeFileSystemWithCache();
+        exportProject(project, fs);
+
+        project
+          .getEventsFunctionsExtension('MyExtension')
+          .getEventsFunction('MyFunction')
+          .setFunctionType(gd.EventsFunction.Condition);
+        exportProject(project, fs);
+        expect(getLayoutsCodeOrigins(fs)).toEqual({
+          'code0.js': 'generated',
+          'code1.js': 'generated',
+        });
+
+        project.delete();
+      });
+
+      it('clears the cache directory when it has too many files', () => {
+        const project = makeProjectWithTwoLayouts();
+        const { fs, cachedFiles } = makeFakeFileSystemWithCache();
+        exportProject(project, fs);
+        expect(fs.clearDir).not.toHaveBeenCalledWith(cacheDir);
+
+        // Simulate the code of many old versions of the layouts.
+        for (let i = 0; i < 256; i++) {
+          cachedFiles[`${cacheDir}/old-version-${i}.js`] = '';
+        }
+        exportProject(project, fs);
+        expect(fs.clearDir).toHaveBeenCalledWith(cacheDir);
+        expect(Object.keys(cachedFiles)).not.toContain(
+          `${cacheDir}/old-version-0.js`
+        );
+        expect(getLayoutsCodeOrigins(fs)).toEqual({
+          'code0.js': 'generated',
+          'code1.js': 'generated',
+        });
+
+        project.delete();
+      });
+    });
   });
 
   describe('LayoutCodeGenerator', () => {
@@ -386,6 +570,36 @@ describe('libGD.js - GDJS related tests', function () {
 
       action.delete();
     });
+    it('declares each map of objects lists only once', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+      layout.insertNewObject(project, 'Sprite', 'MyObject', 0);
+      layout.insertNewObject(project, 'Sprite', 'MyOtherObject', 0);
+
+      // Create several events testing the collision between the same objects.
+      const condition = new gd.Instruction();
+      condition.setType('CollisionNP');
+      condition.setParametersCount(2);
+      condition.setParameter(0, 'MyObject');
+      condition.setParameter(1, 'MyOtherObject');
+      for (let i = 0; i < 3; i++) {
+        const evt = layout
+          .getEvents()
+          .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+        gd.asStandardEvent(evt).getConditions().insert(condition, 0);
+      }
+
+      const layoutCodeGenerator = new gd.LayoutCodeGenerator(project);
+      const code = layoutCodeGenerator.generateLayoutCompleteCode(
+        layout,
+        new gd.SetString(),
+        true
+      );
+
+      expect(code.split('Hashtable.newFrom').length - 1).toBe(2);
+
+      condition.delete();
+    });
   });
 
   describe('EventsFunctionsExtensionCodeGenerator', () => {
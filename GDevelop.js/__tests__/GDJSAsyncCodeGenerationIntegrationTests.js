@@ -3579,6 +3579,93 @@ describe('libGD.js - GDJS Async Code Generation integration tests', function ()
         4 + 4
       );
     });
+
+    test('a ForEach event followed by an event using the objects of the parent after a wait', function () {
+      const runCompiledEvents = generateCompiledEventsFromSerializedEvents(
+        gd,
+        gd.Serializer.fromJSObject([
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions: [
+              {
+                type: { value: 'VarObjet' },
+                parameters: ['MyParamObject', 'Health', '>', '0'],
+              },
+            ],
+            actions: [],
+            events: [
+              // Not the last event: it could use the objects lists of the
+              // parent directly if the next event was not using them.
+              {
+                infiniteLoopWarning: true,
+                type: 'BuiltinCommonInstructions::ForEach',
+                object: 'MyParamObject',
+                conditions: [
+                  {
+                    type: { value: 'VarObjet' },
+                    parameters: ['MyParamObject', 'PleasePickMe', '=', '1'],
+                  },
+                ],
+                actions: [
+                  {
+                    type: { value: 'ModVarObjet' },
+                    parameters: ['MyParamObject', 'ForEachCounter', '+', '1'],
+                  },
+                ],
+              },
+              // Only uses the objects picked by the parent in the callback of
+              // the wait action.
+              {
+                type: 'BuiltinCommonInstructions::Standard',
+                conditions: [],
+                actions: [
+                  {
+                    type: { value: 'Wait' },
+                    parameters: ['1.5'],
+                  },
+                  {
+                    type: { value: 'ModVarObjet' },
+                    parameters: ['MyParamObject', 'AfterWait', '=', '1'],
+                  },
+                ],
+              },
+            ],
+          },
+        ]),
+        { parameterTypes: { MyParamObject: 'object' } }
+      );
+
+      const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+      const objects = [
+        // Health, PleasePickMe
+        [1, 1],
+        [1, 0],
+        [0, 1],
+      ].map(([health, pleasePickMe]) => {
+        const object = runtimeScene.createObject('MyObjectA');
+        object.getVariables().get('Health').setNumber(health);
+        object.getVariables().get('PleasePickMe').setNumber(pleasePickMe);
+        return object;
+      });
+      const getVariableValues = (variableName) =>
+        objects.map((object) =>
+          object.getVariables().get(variableName).getAsNumber()
+        );
+
+      runCompiledEvents(gdjs, runtimeScene, [
+        gdjs.Hashtable.newFrom({ MyObjectA: objects }),
+      ]);
+      expect(getVariableValues('ForEachCounter')).toEqual([1, 0, 0]);
+      expect(getVariableValues('AfterWait')).toEqual([0, 0, 0]);
+
+      // Process the tasks (after faking it's finished).
+      runtimeScene.getAsyncTasksManager().markAllFakeAsyncTasksAsFinished();
+      runtimeScene.getAsyncTasksManager().processTasks(runtimeScene);
+
+      // All the objects picked by the parent are used after the wait, not only
+      // the ones picked by the ForEach event.
+      expect(getVariableValues('AfterWait')).toEqual([1, 1, 0]);
+    });
   });
 
   describe('Events based asynchronous functions', () => {
@@ -193,6 +193,40 @@ describe('libGD.js - GDJS Code Generation integration tests', function () {
     expect(runtimeScene.getVariables().get('Counter').getAsNumber()).toBe(4);
   });
 
+  it('computes constant expressions when generating code', function () {
+    const serializerElement = gd.Serializer.fromJSObject([
+      {
+        type: 'BuiltinCommonInstructions::Standard',
+        conditions: [],
+        actions: [
+          {
+            type: { value: 'ModVarScene' },
+            parameters: ['Number', '=', 'cos(0) + round(Pi()) * 2 - 10 - 1'],
+          },
+          {
+            type: { value: 'ModVarScene' },
+            parameters: ['Levels["Level " + ToString(abs(-3) + 1)]', '=', '1'],
+          },
+        ],
+        events: [],
+      },
+    ]);
+
+    const runCompiledEvents = generateCompiledEventsFromSerializedEvents(
+      gd,
+      serializerElement
+    );
+
+    // The mock has no implementation of Pi and ToString: they must have been
+    // computed when generating the code.
+    const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+    runCompiledEvents(gdjs, runtimeScene, []);
+
+    expect(runtimeScene.getVariables().get('Number').getAsNumber()).toBe(-4);
+    const levels = runtimeScene.getVariables().get('Levels');
+    expect(levels.getChild('Level 4').getAsNumber()).toBe(1);
+  });
+
   it('can generate a nested Repeat event', function () {
     const serializerElement = gd.Serializer.fromJSObject([
       {
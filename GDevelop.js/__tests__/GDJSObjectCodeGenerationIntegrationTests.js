@@ -673,4 +673,308 @@ describe('libGD.js - GDJS Object Code Generation integration tests', function ()
       project.delete();
     });
   });
+
+  describe('Adjacent conditions on the same object', () => {
+    const conditions = [
+      {
+        type: { value: 'VarObjet' },
+        parameters: ['MyParamObject', 'Health', '>', '0'],
+      },
+      {
+        type: { value: 'VarObjet', inverted: true },
+        parameters: ['MyParamObject', 'Shield', '=', '1'],
+      },
+      {
+        type: { value: 'VarObjet' },
+        parameters: ['MyParamObject', 'Level', '>=', '2'],
+      },
+    ];
+    const pickAction = {
+      type: { value: 'ModVarObjet' },
+      parameters: ['MyParamObject', 'Picked', '=', '1'],
+    };
+
+    const runOnObjects = (runCompiledEvents) => {
+      const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+      const values = [
+        // Health, Shield, Level
+        [1, 0, 2],
+        [0, 0, 2],
+        [1, 1, 2],
+        [1, 0, 1],
+        [5, 2, 3],
+      ];
+      const objects = values.map(([health, shield, level]) => {
+        const object = runtimeScene.createObject('MyObjectA');
+        object.getVariables().get('Health').setNumber(health);
+        object.getVariables().get('Shield').setNumber(shield);
+        object.getVariables().get('Level').setNumber(level);
+        return object;
+      });
+      const objectsLists = gdjs.Hashtable.newFrom({ MyObjectA: objects });
+
+      runCompiledEvents(gdjs, runtimeScene, [objectsLists]);
+
+      return objects.map((object) =>
+        object.getVariables().get('Picked').getAsNumber()
+      );
+    };
+
+    test('Conditions in a single event pick the same instances as nested events', function () {
+      const runFusedEvents = generateCompiledEventsFromSerializedEvents(
+        gd,
+        gd.Serializer.fromJSObject([
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions,
+            actions: [pickAction],
+          },
+        ]),
+        { parameterTypes: { MyParamObject: 'object' } }
+      );
+      const runNestedEvents = generateCompiledEventsFromSerializedEvents(
+        gd,
+        gd.Serializer.fromJSObject([
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions: [conditions[0]],
+            actions: [],
+            events: [
+              {
+                type: 'BuiltinCommonInstructions::Standard',
+                conditions: [conditions[1]],
+                actions: [],
+                events: [
+                  {
+                    type: 'BuiltinCommonInstructions::Standard',
+                    conditions: [conditions[2]],
+                    actions: [pickAction],
+                  },
+                ],
+              },
+            ],
+          },
+        ]),
+        { parameterTypes: { MyParamObject: 'object' } }
+      );
+
+      expect(runOnObjects(runFusedEvents)).toEqual([1, 0, 0, 0, 1]);
+      expect(runOnObjects(runNestedEvents)).toEqual([1, 0, 0, 0, 1]);
+    });
+
+    test('Conditions are filtered in a single loop', function () {
+      const project = new gd.ProjectHelper.createNewGDJSProject();
+      const eventsFunction = new gd.EventsFunction();
+      eventsFunction
+        .getEvents()
+        .unserializeFrom(
+          project,
+          gd.Serializer.fromJSObject([
+            {
+              type: 'BuiltinCommonInstructions::Standard',
+              conditions,
+              actions: [pickAction],
+            },
+          ])
+        );
+      const objectParameter = new gd.ParameterMetadata();
+      objectParameter.setType('object');
+      objectParameter.setName('MyParamObject');
+      eventsFunction.getParameters().push_back(objectParameter);
+      objectParameter.delete();
+
+      const codeGenerator = new gd.EventsFunctionsExtensionCodeGenerator(
+        project
+      );
+      const extension = new gd.EventsFunctionsExtension();
+      const includeFiles = new gd.SetString();
+      const code = codeGenerator.generateFreeEventsFunctionCompleteCode(
+        extension,
+        eventsFunction,
+        'functionNamespace',
+        includeFiles,
+        true
+      );
+      codeGenerator.delete();
+      extension.delete();
+      includeFiles.delete();
+
+      // Each filtering loop ends by resizing the list of picked objects.
+      expect(code.match(/\.length = k;/g)).toHaveLength(1);
+
+      eventsFunction.delete();
+      project.delete();
+    });
+
+    test('Conditions reading a variable of the filtered object are not fused', function () {
+      // The second condition reads the variable of the first picked instance:
+      // the list must not be compacted while it's being evaluated.
+      const conditionsReadingObject = [
+        conditions[0],
+        {
+          type: { value: 'VarObjet' },
+          parameters: ['MyParamObject', 'Level', '>=', 'MyParamObject.SomeVar'],
+        },
+      ];
+      const generateEvents = (events) =>
+        generateCompiledEventsFromSerializedEvents(
+          gd,
+          gd.Serializer.fromJSObject(events),
+          { parameterTypes: { MyParamObject: 'object' } }
+        );
+      const runFusedEvents = generateEvents([
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          conditions: conditionsReadingObject,
+          actions: [pickAction],
+        },
+      ]);
+      const runNestedEvents = generateEvents([
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          conditions: [conditionsReadingObject[0]],
+          actions: [],
+          events: [
+            {
+              type: 'BuiltinCommonInstructions::Standard',
+              conditions: [conditionsReadingObject[1]],
+              actions: [pickAction],
+            },
+          ],
+        },
+      ]);
+
+      const runWithSomeVar = (runCompiledEvents) => {
+        const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+        const values = [
+          // Health, Level, SomeVar
+          [0, 0, 5],
+          [1, 2, 2],
+          [1, 1, 0],
+          [1, 3, 0],
+        ];
+        const objects = values.map(([health, level, someVar]) => {
+          const object = runtimeScene.createObject('MyObjectA');
+          object.getVariables().get('Health').setNumber(health);
+          object.getVariables().get('Level').setNumber(level);
+          object.getVariables().get('SomeVar').setNumber(someVar);
+          return object;
+        });
+        const objectsLists = gdjs.Hashtable.newFrom({ MyObjectA: objects });
+
+        runCompiledEvents(gdjs, runtimeScene, [objectsLists]);
+
+        return objects.map((object) =>
+          object.getVariables().get('Picked').getAsNumber()
+        );
+      };
+
+      expect(runWithSomeVar(runFusedEvents)).toEqual(
+        runWithSomeVar(runNestedEvents)
+      );
+    });
+  });
+
+  describe('Objects lists of the parent used by sibling events', () => {
+    const makeSubEvent = (objectName, variableName, subEvents = []) => ({
+      type: 'BuiltinCommonInstructions::Standard',
+      conditions: [
+        {
+          type: { value: 'VarObjet' },
+          parameters: [objectName, variableName, '=', '1'],
+        },
+      ],
+      actions: [
+        {
+          type: { value: 'ModVarObjet' },
+          parameters: [objectName, variableName + 'Picked', '=', '1'],
+        },
+      ],
+      events: subEvents,
+    });
+
+    test('Events pick from the objects lists of the parent, even if previous events picked objects', function () {
+      const runCompiledEvents = generateCompiledEventsFromSerializedEvents(
+        gd,
+        gd.Serializer.fromJSObject([
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions: [
+              {
+                type: { value: 'VarObjet' },
+                parameters: ['MyParamObjectA', 'Health', '>', '0'],
+              },
+              {
+                type: { value: 'VarObjet' },
+                parameters: ['MyParamObjectB', 'Health', '>', '0'],
+              },
+            ],
+            actions: [],
+            events: [
+              makeSubEvent('MyParamObjectA', 'First'),
+              makeSubEvent('MyParamObjectB', 'Second', [
+                makeSubEvent('MyParamObjectA', 'Nested'),
+              ]),
+              makeSubEvent('MyParamObjectB', 'Third'),
+              makeSubEvent('MyParamObjectA', 'Last'),
+            ],
+          },
+        ]),
+        {
+          parameterTypes: {
+            MyParamObjectA: 'object',
+            MyParamObjectB: 'object',
+          },
+        }
+      );
+
+      const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+      const variableNames = [
+        'Health',
+        'First',
+        'Second',
+        'Nested',
+        'Third',
+        'Last',
+      ];
+      const createObjects = (objectName, values) =>
+        values.map((objectValues) => {
+          const object = runtimeScene.createObject(objectName);
+          variableNames.forEach((variableName, index) =>
+            object
+              .getVariables()
+              .get(variableName)
+              .setNumber(objectValues[index])
+          );
+          return object;
+        });
+      const objectsA = createObjects('MyObjectA', [
+        [1, 1, 0, 1, 0, 0],
+        [1, 0, 0, 1, 0, 1],
+        [0, 1, 0, 1, 0, 1],
+      ]);
+      const objectsB = createObjects('MyObjectB', [
+        [1, 0, 1, 0, 1, 0],
+        [1, 0, 0, 0, 1, 0],
+        [0, 0, 1, 0, 1, 0],
+      ]);
+
+      runCompiledEvents(gdjs, runtimeScene, [
+        gdjs.Hashtable.newFrom({ MyObjectA: objectsA }),
+        gdjs.Hashtable.newFrom({ MyObjectB: objectsB }),
+      ]);
+
+      const getPicked = (objects, variableName) =>
+        objects.map((object) =>
+          object.getVariables().get(variableName + 'Picked').getAsNumber()
+        );
+      expect(getPicked(objectsA, 'First')).toEqual([1, 0, 0]);
+      expect(getPicked(objectsB, 'Second')).toEqual([1, 0, 0]);
+      // The nested event uses all the objects picked by the parent,
+      // not only the ones picked by the first event.
+      expect(getPicked(objectsA, 'Nested')).toEqual([1, 1, 0]);
+      expect(getPicked(objectsB, 'Third')).toEqual([1, 1, 0]);
+      expect(getPicked(objectsA, 'Last')).toEqual([0, 1, 0]);
+    });
+  });
 });
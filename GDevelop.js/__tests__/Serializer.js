@@ -105,6 +105,27 @@ describe('libGD.js object serialization', function() {
     });
   });
 
+  describe('gd.Serializer.toBinary and gd.Serializer.fromBinaryOrJSON', function() {
+    it('should unserialize and reserialize the binary format', function() {
+      const json =
+        '{"a":{"b":"String with 官话 characters","c":[1,2.5,true,""]},"d":{}}';
+      const element = gd.Serializer.fromJSON(json);
+      const data = gd.Serializer.toBinary(element);
+      expect(data).toBeInstanceOf(Uint8Array);
+      expect(String.fromCharCode(data[0], data[1], data[2], data[3])).toBe(
+        'GDSB'
+      );
+
+      const outputElement = gd.Serializer.fromBinaryOrJSON(data);
+      expect(gd.Serializer.toJSON(outputElement)).toBe(json);
+    });
+    it('should unserialize JSON', function() {
+      const json = '{"a":[1,2,{"b":"String with 官话 characters"}]}';
+      const element = gd.Serializer.fromBinaryOrJSON(Buffer.from(json));
+      expect(gd.Serializer.toJSON(element)).toBe(json);
+    });
+  });
+
   // TODO: test failures
 
   describe('gd.Serializer.fromJSObject and gd.Serializer.toJSObject', function() {
@@ -88,4 +88,46 @@ describe.skip('gd.Serializer benchmarks', function () {
 
     console.log(benchmarkSuite.run());
   });
+
+  it('Benchmark loading a large project-like JSON string', function () {
+    const makeInstance = (i, j) => ({
+      angle: 0,
+      customSize: false,
+      height: 0,
+      layer: '',
+      name: 'MySpriteObject',
+      persistentUuid: '9b1a8e2c-5d4f-4e67-8c39-0e2f1b7a6d58',
+      width: 0,
+      x: j * 32,
+      y: i + 0.5,
+      zOrder: 1,
+      numberProperties: [],
+      stringProperties: [],
+      initialVariables: [],
+    });
+    const largeJson = JSON.stringify({
+      layouts: new Array(200).fill(null).map((_, i) => ({
+        name: 'Layout' + i,
+        instances: new Array(100).fill(null).map((_, j) => makeInstance(i, j)),
+      })),
+    });
+    console.log(`JSON size: ${Math.round(largeJson.length / 1024)} KB`);
+
+    const benchmarkSuite = makeBenchmarkSuite({
+      benchmarksCount: 3,
+      iterationsCount: 2,
+    }).add('fromJSON (large project-like JSON)', () => {
+      gd.Serializer.fromJSON(largeJson).delete();
+    });
+
+    console.log(benchmarkSuite.run());
+
+    const residentMemoryBefore = gd.SystemStats.getResidentMemory();
+    const element = gd.Serializer.fromJSON(largeJson);
+    console.log(
+      `Memory used by the loaded element: ${gd.SystemStats.getResidentMemory() -
+        residentMemoryBefore} KB`
+    );
+    element.delete();
+  });
 });
@@ -133,6 +133,23 @@ type ExpressionCompletionDescription_CompletionKind = 0 | 1 | 2 | 3 | 4`
       ].join('\n'),
       'types/gdexpressioncompletiondescription.js'
     );
+    fs.writeFileSync(
+      'types/eventsreferencesindex_referencetype.js',
+      `// Automatically generated by GDevelop.js/scripts/generate-types.js
+type EventsReferencesIndex_ReferenceType = 0 | 1 | 2 | 3`
+    );
+    shell.sed(
+      '-i',
+      'declare class gdEventsReferencesIndex {',
+      [
+        'declare class gdEventsReferencesIndex {',
+        '  static Object: 0;',
+        '  static Behavior: 1;',
+        '  static Variable: 2;',
+        '  static Function: 3;',
+      ].join('\n'),
+      'types/gdeventsreferencesindex.js'
+    );
     fs.writeFileSync(
       'types/particleemitterobject_renderertype.js',
       `// Automatically generated by GDevelop.js/scripts/generate-types.js
@@ -213,6 +230,8 @@ type ParticleEmitterObject_RendererType = 0 | 1 | 2`
       `declare class gdSerializer {
   static fromJSObject(object: Object): gdSerializerElement;
   static toJSObject(element: gdSerializerElement): any;
+  static toBinary(element: gdSerializerElement): Uint8Array;
+  static fromBinaryOrJSON(data: Uint8Array): gdSerializerElement;
 `,
       'types/gdserializer.js'
     );
@@ -0,0 +1,10 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdEventsReferencesIndex {
+  static Object: 0;
+  static Behavior: 1;
+  static Variable: 2;
+  static Function: 3;
+  findUsages(events: gdEventsList, globalObjectsContainer: gdObjectsContainer, objectsContainer: gdObjectsContainer, type: EventsReferencesIndex_ReferenceType, name: string): gdVectorEventsSearchResult;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -2,6 +2,7 @@
 declare class gdjsExporter {
   constructor(fs: gdAbstractFileSystem, gdjsRoot: string): void;
   setCodeOutputDirectory(path: string): void;
+  setEventsCodeCacheDirectory(path: string): void;
   exportProjectForPixiPreview(options: gdPreviewExportOptions): boolean;
   exportWholePixiProject(options: gdExportOptions): boolean;
   getLastError(): string;
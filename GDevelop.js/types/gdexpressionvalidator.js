@@ -3,6 +3,7 @@ declare class gdExpressionValidator extends gdExpressionParser2NodeWorker {
   constructor(platform: gdPlatform, globalObjectsContainer: gdObjectsContainer, objectsContainer: gdObjectsContainer, rootType: string): void;
   getAllErrors(): gdVectorExpressionParserDiagnostic;
   getFatalErrors(): gdVectorExpressionParserDiagnostic;
+  static hasNoErrors(platform: gdPlatform, globalObjectsContainer: gdObjectsContainer, objectsContainer: gdObjectsContainer, rootType: string, expression: gdExpression, cache: gdParsedExpressionsCache): boolean;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
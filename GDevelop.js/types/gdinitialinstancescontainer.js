@@ -14,6 +14,11 @@ declare class gdInitialInstancesContainer {
   removeInstance(inst: gdInitialInstance): void;
   insertNewInitialInstance(): gdInitialInstance;
   insertInitialInstance(inst: gdInitialInstance): gdInitialInstance;
+  setSpatialIndexEnabled(enable: boolean): void;
+  isSpatialIndexEnabled(): boolean;
+  setObjectDefaultSize(objectName: string, width: number, height: number): void;
+  iterateOverInstancesInRegion(func: gdInitialInstanceFunctor, layer: string, left: number, top: number, right: number, bottom: number): void;
+  iterateOverInstancesAtPoint(func: gdInitialInstanceFunctor, layer: string, x: number, y: number): void;
   serializeTo(element: gdSerializerElement): void;
   unserializeFrom(element: gdSerializerElement): void;
   delete(): void;
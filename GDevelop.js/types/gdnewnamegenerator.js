@@ -0,0 +1,9 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdNewNameGenerator {
+  static generateAllObjectNames(names: gdVectorString, prefix: string, globalObjectsContainer: gdObjectsContainer, objectsContainer: gdObjectsContainer): gdVectorString;
+  static generateAllLayerNames(names: gdVectorString, prefix: string, layout: gdLayout): gdVectorString;
+  static generateAllVariableNames(names: gdVectorString, prefix: string, variablesContainer: gdVariablesContainer): gdVectorString;
+  static generateAllResourceNames(names: gdVectorString, prefix: string, resourcesManager: gdResourcesManager): gdVectorString;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
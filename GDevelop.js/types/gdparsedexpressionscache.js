@@ -0,0 +1,13 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdParsedExpressionsCache {
+  constructor(maximumSize: number): void;
+  setMaximumSize(maximumSize: number): void;
+  getMaximumSize(): number;
+  getSize(): number;
+  clear(): void;
+  getHitsCount(): number;
+  getMissesCount(): number;
+  resetCounters(): void;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
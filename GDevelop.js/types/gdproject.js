@@ -52,6 +52,9 @@ declare class gdProject extends gdObjectsContainer {
   isFolderProject(): boolean;
   setUseDeprecatedZeroAsDefaultZOrder(enable: boolean): void;
   getUseDeprecatedZeroAsDefaultZOrder(): boolean;
+  setEventsReferencesIndexEnabled(enable: boolean): void;
+  isEventsReferencesIndexEnabled(): boolean;
+  getEventsReferencesIndex(): gdEventsReferencesIndex;
   setLastCompilationDirectory(path: string): void;
   getLastCompilationDirectory(): string;
   getExtensionProperties(): gdExtensionProperties;
@@ -101,6 +104,7 @@ declare class gdProject extends gdObjectsContainer {
   getEventsBasedObject(type: string): gdEventsBasedObject;
   getVariables(): gdVariablesContainer;
   getResourcesManager(): gdResourcesManager;
+  getParsedExpressionsCache(): gdParsedExpressionsCache;
   exposeResources(worker: gdArbitraryResourceWorker): void;
   static validateName(name: string): boolean;
   serializeTo(element: gdSerializerElement): void;
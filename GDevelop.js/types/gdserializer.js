@@ -2,9 +2,13 @@
 declare class gdSerializer {
   static fromJSObject(object: Object): gdSerializerElement;
   static toJSObject(element: gdSerializerElement): any;
+  static toBinary(element: gdSerializerElement): Uint8Array;
+  static fromBinaryOrJSON(data: Uint8Array): gdSerializerElement;
 
   static toJSON(element: gdSerializerElement): string;
   static fromJSON(json: string): gdSerializerElement;
+  static toBinaryBuffer(element: gdSerializerElement, output: gdBinaryBuffer): void;
+  static fromBinaryOrJSONBuffer(data: number, size: number): gdSerializerElement;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -0,0 +1,7 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdSystemStats {
+  static getResidentMemory(): number;
+  static getPeakResidentMemory(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -114,6 +114,8 @@ declare class libGDevelop {
   SerializerElement: Class<gdSerializerElement>;
   SharedPtrSerializerElement: Class<gdSharedPtrSerializerElement>;
   Serializer: Class<gdSerializer>;
+  BinaryBuffer: Class<gdBinaryBuffer>;
+  SystemStats: Class<gdSystemStats>;
   InstructionsList: Class<gdInstructionsList>;
   Instruction: Class<gdInstruction>;
   Expression: Class<gdExpression>;
@@ -150,10 +152,13 @@ declare class libGDevelop {
   EventsListUnfolder: Class<gdEventsListUnfolder>;
   EventsSearchResult: Class<gdEventsSearchResult>;
   VectorEventsSearchResult: Class<gdVectorEventsSearchResult>;
+  EventsReferencesIndex_ReferenceType: Class<EventsReferencesIndex_ReferenceType>;
+  EventsReferencesIndex: Class<gdEventsReferencesIndex>;
   EventsRefactorer: Class<gdEventsRefactorer>;
   UnfilledRequiredBehaviorPropertyProblem: Class<gdUnfilledRequiredBehaviorPropertyProblem>;
   VectorUnfilledRequiredBehaviorPropertyProblem: Class<gdVectorUnfilledRequiredBehaviorPropertyProblem>;
   ProjectBrowserHelper: Class<gdProjectBrowserHelper>;
+  NewNameGenerator: Class<gdNewNameGenerator>;
   WholeProjectRefactorer: Class<gdWholeProjectRefactorer>;
   PropertyFunctionGenerator: Class<gdPropertyFunctionGenerator>;
   UsedExtensionsResult: Class<gdUsedExtensionsResult>;
@@ -169,6 +174,7 @@ declare class libGDevelop {
   VectorExpressionParserDiagnostic: Class<gdVectorExpressionParserDiagnostic>;
   ExpressionParser2NodeWorker: Class<gdExpressionParser2NodeWorker>;
   ExpressionValidator: Class<gdExpressionValidator>;
+  ParsedExpressionsCache: Class<gdParsedExpressionsCache>;
   ExpressionCompletionDescription_CompletionKind: Class<ExpressionCompletionDescription_CompletionKind>;
   ExpressionCompletionDescription: Class<gdExpressionCompletionDescription>;
   VectorExpressionCompletionDescription: Class<gdVectorExpressionCompletionDescription>;
@@ -55,6 +55,15 @@ const styles = {
 
 export const reactDndInstructionType = 'GD_DRAGGED_INSTRUCTION';
 
+// Identical expressions are frequent in the events: they are parsed only once
+// to be validated, and then shared by all the instructions using them.
+let parsedExpressionsCache: ?gdParsedExpressionsCache = null;
+const getParsedExpressionsCache = (): gdParsedExpressionsCache => {
+  if (!parsedExpressionsCache)
+    parsedExpressionsCache = new gd.ParsedExpressionsCache(5000);
+  return parsedExpressionsCache;
+};
+
 const capitalize = (str: string) => {
   if (!str) return '';
 
@@ -278,19 +287,14 @@ const Instruction = (props: Props) => {
               gd.ParameterMetadata.isExpression('string', parameterType) ||
               gd.ParameterMetadata.isExpression('variable', parameterType)
             ) {
-              const expressionNode = instruction
-                .getParameter(parameterIndex)
-                .getRootNode();
-              const expressionValidator = new gd.ExpressionValidator(
+              expressionIsValid = gd.ExpressionValidator.hasNoErrors(
                 gd.JsPlatform.get(),
                 globalObjectsContainer,
                 objectsContainer,
-                parameterType
+                parameterType,
+                instruction.getParameter(parameterIndex),
+                getParsedExpressionsCache()
               );
-              expressionNode.visit(expressionValidator);
-              expressionIsValid =
-                expressionValidator.getAllErrors().size() === 0;
-              expressionValidator.delete();
             } else if (gd.ParameterMetadata.isObject(parameterType)) {
               const objectOrGroupName = instruction
                 .getParameter(parameterIndex)
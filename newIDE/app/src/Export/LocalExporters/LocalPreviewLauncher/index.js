@@ -166,6 +166,11 @@ export default class LocalPreviewLauncher extends React.Component<
       );
       const outputDir = path.join(fileSystem.getTempDir(), 'preview');
       const exporter = new gd.Exporter(fileSystem, gdjsRoot);
+      // Keep the generated events code between previews, so that only the
+      // code of the modified layouts is generated again.
+      exporter.setEventsCodeCacheDirectory(
+        path.join(fileSystem.getTempDir(), 'preview-events-code-cache')
+      );
 
       return {
         outputDir,
@@ -1,7 +1,6 @@
 // @flow
 import { t, Trans } from '@lingui/macro';
 import * as React from 'react';
-import newNameGenerator from '../Utils/NewNameGenerator';
 import { mapReverseFor } from '../Utils/MapFor';
 import LayerRow, { styles } from './LayerRow';
 import BackgroundColorRow from './BackgroundColorRow';
@@ -202,6 +201,18 @@ export type LayersListInterface = {
   forceUpdate: () => void,
 };
 
+const generateNewLayerName = (layout: gdLayout, name: string): string => {
+  const layerNames = new gd.VectorString();
+  layerNames.push_back(name);
+  const newName = gd.NewNameGenerator.generateAllLayerNames(
+    layerNames,
+    '',
+    layout
+  ).at(0);
+  layerNames.delete();
+  return newName;
+};
+
 const hasLightingLayer = (layout: gdLayout) => {
   const layersCount = layout.getLayersCount();
   return (
@@ -221,9 +232,7 @@ const LayersList = React.forwardRef<Props, LayersListInterface>(
 
     const addLayer = () => {
       const { layersContainer } = props;
-      const name = newNameGenerator('Layer', name =>
-        layersContainer.hasLayerNamed(name)
-      );
+      const name = generateNewLayerName(layersContainer, 'Layer');
       layersContainer.insertNewLayer(name, layersContainer.getLayersCount());
       onLayerModified();
       props.onCreateLayer();
@@ -231,9 +240,7 @@ const LayersList = React.forwardRef<Props, LayersListInterface>(
 
     const addLightingLayer = () => {
       const { layersContainer } = props;
-      const name = newNameGenerator('Lighting', name =>
-        layersContainer.hasLayerNamed(name)
-      );
+      const name = generateNewLayerName(layersContainer, 'Lighting');
       layersContainer.insertNewLayer(name, layersContainer.getLayersCount());
       const layer = layersContainer.getLayer(name);
       layer.setLightingLayer(true);
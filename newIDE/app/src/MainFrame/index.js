@@ -775,6 +775,10 @@ const MainFrame = (props: Props) => {
       ResourcesLoader.burstAllUrlsCache();
       // TODO: Pixi cache should also be burst
 
+      // Index the references in the events, so that renaming or removing an
+      // object only visits the instructions using it.
+      project.setEventsReferencesIndexEnabled(true);
+
       const state = await setState(state => ({
         ...state,
         currentProject: project,
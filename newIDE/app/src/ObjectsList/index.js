@@ -345,51 +345,54 @@ const ObjectsList = React.forwardRef<Props, ObjectsListInterface>(
       [copyObject, deleteObject]
     );
 
-    const addSerializedObjectToObjectsContainer = React.useCallback(
+    const addSerializedObjectsToObjectsContainer = React.useCallback(
       ({
-        objectName,
+        objects,
         positionObjectName,
-        objectType,
         global,
-        serializedObject,
       }: {|
-        objectName: string,
+        objects: Array<{|
+          objectName: string,
+          objectType: string,
+          serializedObject: Object,
+        |}>,
         positionObjectName: string,
-        objectType: string,
         global: boolean,
-        serializedObject: Object,
-      |}): ObjectWithContext => {
-        const newName = newNameGenerator(
-          objectName,
-          name =>
-            objectsContainer.hasObjectNamed(name) ||
-            project.hasObjectNamed(name),
-          ''
-        );
-
-        const newObject = global
-          ? project.insertNewObject(
-              project,
-              objectType,
-              newName,
-              project.getObjectPosition(positionObjectName) + 1
-            )
-          : objectsContainer.insertNewObject(
-              project,
-              objectType,
-              newName,
-              objectsContainer.getObjectPosition(positionObjectName) + 1
-            );
+      |}): Array<ObjectWithContext> => {
+        // All the objects are named in a single call to the names generator.
+        const objectNames = new gd.VectorString();
+        objects.forEach(({ objectName }) => objectNames.push_back(objectName));
+        const newNames = gd.NewNameGenerator.generateAllObjectNames(
+          objectNames,
+          '',
+          project,
+          objectsContainer
+        ).toJSArray();
+        objectNames.delete();
+
+        const container: gdObjectsContainer = global
+          ? project
+          : objectsContainer;
+        const position = container.getObjectPosition(positionObjectName) + 1;
+        return objects.map(({ objectType, serializedObject }, i) => {
+          const newName = newNames[i];
+          const newObject = container.insertNewObject(
+            project,
+            objectType,
+            newName,
+            position + i
+          );
 
-        unserializeFromJSObject(
-          newObject,
-          serializedObject,
-          'unserializeFrom',
-          project
-        );
-        newObject.setName(newName); // Unserialization has overwritten the name.
+          unserializeFromJSObject(
+            newObject,
+            serializedObject,
+            'unserializeFrom',
+            project
+          );
+          newObject.setName(newName); // Unserialization has overwritten the name.
 
-        return { object: newObject, global };
+          return { object: newObject, global };
+        });
       },
       [objectsContainer, project]
     );
@@ -414,11 +417,15 @@ const ObjectsList = React.forwardRef<Props, ObjectsListInterface>(
         );
         if (!name || !type || !copiedObject) return;
 
-        const newObjectWithContext = addSerializedObjectToObjectsContainer({
-          objectName: name,
+        const [newObjectWithContext] = addSerializedObjectsToObjectsContainer({
+          objects: [
+            {
+              objectName: name,
+              objectType: type,
+              serializedObject: copiedObject,
+            },
+          ],
           positionObjectName: pasteObject.getName(),
-          objectType: type,
-          serializedObject: copiedObject,
           global,
         });
 
@@ -427,7 +434,7 @@ const ObjectsList = React.forwardRef<Props, ObjectsListInterface>(
 
         return newObjectWithContext;
       },
-      [addSerializedObjectToObjectsContainer, onObjectModified, onObjectPasted]
+      [addSerializedObjectsToObjectsContainer, onObjectModified, onObjectPasted]
     );
 
     const editName = React.useCallback(
@@ -447,17 +454,15 @@ const ObjectsList = React.forwardRef<Props, ObjectsListInterface>(
         const name = object.getName();
         const serializedObject = serializeToJSObject(object);
 
-        const newObjectWithContext = addSerializedObjectToObjectsContainer({
-          objectName: name,
+        const [newObjectWithContext] = addSerializedObjectsToObjectsContainer({
+          objects: [{ objectName: name, objectType: type, serializedObject }],
           positionObjectName: name,
-          objectType: type,
-          serializedObject,
           global,
         });
 
         editName(newObjectWithContext);
       },
-      [addSerializedObjectToObjectsContainer, editName]
+      [addSerializedObjectsToObjectsContainer, editName]
     );
 
     const rename = React.useCallback(
@@ -6,6 +6,7 @@ const fs = optionalRequire('fs');
 const path = optionalRequire('path');
 const remote = optionalRequire('@electron/remote');
 const dialog = remote ? remote.dialog : null;
+const gd: libGDevelop = global.gd;
 
 const readJSONFile = (filepath: string): Promise<Object> => {
   if (!fs) return Promise.reject('Filesystem is not supported.');
@@ -24,6 +25,33 @@ const readJSONFile = (filepath: string): Promise<Object> => {
   });
 };
 
+const readAutoSaveFile = (filepath: string): Promise<Object> => {
+  if (!fs) return Promise.reject('Filesystem is not supported.');
+
+  return new Promise((resolve, reject) => {
+    fs.readFile(filepath, (err, data) => {
+      if (err) return reject(err);
+
+      try {
+        // Autosaves are written in the binary format of gd.Serializer (see
+        // onAutoSaveProject), older ones being in JSON.
+        if (data.toString('latin1', 0, 4) !== 'GDSB') {
+          return resolve(JSON.parse(data.toString('utf8')));
+        }
+
+        // The element is owned by libGD.js and must not be deleted.
+        const element = gd.Serializer.fromBinaryOrJSON(data);
+        if (element.getAllChildren().size() === 0) {
+          throw new Error('Invalid binary data.');
+        }
+        return resolve(JSON.parse(gd.Serializer.toJSON(element)));
+      } catch (ex) {
+        return reject(filepath + ' is a corrupted/malformed file.');
+      }
+    });
+  });
+};
+
 export const onOpenWithPicker = (): Promise<?FileMetadata> => {
   if (!dialog) return Promise.reject('Not supported');
   const browserWindow = remote.getCurrentWindow();
@@ -49,7 +77,10 @@ export const onOpen = (
 |}> => {
   const filePath = fileMetadata.fileIdentifier;
   const projectPath = path.dirname(filePath);
-  return readJSONFile(filePath).then(object => {
+  const readProjectFile = filePath.endsWith('.autosave')
+    ? readAutoSaveFile
+    : readJSONFile;
+  return readProjectFile(filePath).then(object => {
     return unsplit(object, {
       getReferencePartialObject: referencePath => {
         return readJSONFile(path.join(projectPath, referencePath) + '.json');
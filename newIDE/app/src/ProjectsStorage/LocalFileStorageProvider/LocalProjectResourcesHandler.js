@@ -6,7 +6,6 @@ import {
   getResourceFilePathStatus,
 } from '../../ResourcesList/ResourceUtils';
 import { mapVector } from '../../Utils/MapFor';
-import newNameGenerator from '../../Utils/NewNameGenerator';
 import optionalLazyRequire from '../../Utils/OptionalLazyRequire';
 import optionalRequire from '../../Utils/OptionalRequire';
 
@@ -99,10 +98,14 @@ export const scanForNewResources = async ({
       .findFilesNotInResources(filesToCheck);
     filesToCheck.delete();
 
-    mapVector(filePathsNotInResources, (relativeFilePath: string) => {
-      const resourceName = newNameGenerator(relativeFilePath, name =>
-        resourcesManager.hasResource(name)
-      );
+    const resourceNames = gd.NewNameGenerator.generateAllResourceNames(
+      filePathsNotInResources,
+      '',
+      resourcesManager
+    ).toJSArray();
+
+    mapVector(filePathsNotInResources, (relativeFilePath: string, index) => {
+      const resourceName = resourceNames[index];
 
       const resource = createResource();
       resource.setFile(relativeFilePath);
@@ -1,7 +1,10 @@
 // @flow
 import { t } from '@lingui/macro';
 import * as React from 'react';
-import { serializeToJSObject, serializeToJSON } from '../../Utils/Serializer';
+import {
+  serializeToJSObject,
+  serializeToBinary,
+} from '../../Utils/Serializer';
 import { type FileMetadata, type SaveAsLocation } from '../index';
 import optionalRequire from '../../Utils/OptionalRequire';
 import {
@@ -17,16 +20,26 @@ const path = optionalRequire('path');
 const remote = optionalRequire('@electron/remote');
 const dialog = remote ? remote.dialog : null;
 
-const checkFileContent = (filePath: string, expectedContent: string) => {
+const checkFileContent = (
+  filePath: string,
+  expectedContent: string | Uint8Array
+) => {
   const time = performance.now();
+  // Binary content is compared to the bytes of the file.
+  const isBinary = typeof expectedContent !== 'string';
+  const readOptions = isBinary ? {} : { encoding: 'utf8' };
   return new Promise((resolve, reject) => {
-    fs.readFile(filePath, { encoding: 'utf8' }, (err, content) => {
+    fs.readFile(filePath, readOptions, (err, content) => {
       if (err) return reject(err);
 
-      if (content === '') {
+      if (content.length === 0) {
         reject(new Error(`Written file is empty, did the write fail?`));
       }
-      if (content !== expectedContent) {
+      if (
+        isBinary
+          ? !content.equals(expectedContent)
+          : content !== expectedContent
+      ) {
         reject(
           new Error(
             `Written file is not containing the expected content, did the write fail?`
@@ -43,11 +56,11 @@ const checkFileContent = (filePath: string, expectedContent: string) => {
 };
 
 export const writeAndCheckFile = async (
-  content: string,
+  content: string | Uint8Array,
   filePath: string
 ): Promise<void> => {
   if (!fs) throw new Error('Filesystem is not supported.');
-  if (content === '')
+  if (content.length === 0)
     throw new Error('The content to save on disk is empty. Aborting.');
 
   await fs.ensureDir(path.dirname(filePath));
@@ -222,7 +235,9 @@ export const onAutoSaveProject = (
   fileMetadata: FileMetadata
 ): Promise<void> => {
   const autoSavePath = fileMetadata.fileIdentifier + '.autosave';
-  return writeAndCheckFile(serializeToJSON(project), autoSavePath).catch(
+  // Autosaves are only read by GDevelop, so the binary format (faster to
+  // write than JSON) is used.
+  return writeAndCheckFile(serializeToBinary(project), autoSavePath).catch(
     err => {
       console.error(`Unable to write ${autoSavePath}:`, err);
       throw err;
@@ -68,6 +68,41 @@ export const insertInVariablesContainer = (
   return { name: newName, variable };
 };
 
+/**
+ * Insert the variables in the container, all named in a single call to the
+ * names generator. They are inserted one after the other at `index` (or at
+ * the end of the container).
+ */
+export const insertAllInVariablesContainer = (
+  variablesContainer: gdVariablesContainer,
+  variables: Array<{| name: string, serializedVariable: any |}>,
+  index: ?number
+): Array<string> => {
+  const names = new gd.VectorString();
+  variables.forEach(({ name }) => names.push_back(name));
+  const newNames = gd.NewNameGenerator.generateAllVariableNames(
+    names,
+    'CopyOf',
+    variablesContainer
+  ).toJSArray();
+  names.delete();
+
+  variables.forEach(({ serializedVariable }, i) => {
+    const newVariable = new gd.Variable();
+    unserializeFromJSObject(newVariable, serializedVariable);
+    variablesContainer.insert(
+      newNames[i],
+      newVariable,
+      index !== null && index !== undefined
+        ? index + i
+        : variablesContainer.count()
+    );
+    newVariable.delete();
+  });
+
+  return newNames;
+};
+
 export const insertInVariableChildrenArray = (
   targetParentVariable: gdVariable,
   serializedVariable: any,
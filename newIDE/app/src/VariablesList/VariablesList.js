@@ -52,6 +52,7 @@ import {
   insertInVariableChildren,
   insertInVariableChildrenArray,
   insertInVariablesContainer,
+  insertAllInVariablesContainer,
   isCollectionVariable,
 } from '../Utils/VariablesUtils';
 import {
@@ -352,8 +353,7 @@ const VariablesList = ({ onComputeAllVariableNames, ...props }: Props) => {
     const variablesContent = SafeExtractor.extractArray(clipboardContent);
     if (!variablesContent) return;
 
-    let pastedElementOffsetIndex = 0;
-
+    const pastedVariables = [];
     variablesContent.forEach(variableContent => {
       const nameOrIndex = SafeExtractor.extractStringProperty(
         variableContent,
@@ -369,45 +369,53 @@ const VariablesList = ({ onComputeAllVariableNames, ...props }: Props) => {
       );
       if (!nameOrIndex || !serializedVariable || hasName === null) return;
 
-      const pasteAtTopLevel =
-        selectedNodes.length === 0 ||
-        selectedNodes.some(nodeId => nodeId.startsWith(inheritedPrefix));
-
-      const name = hasName ? nameOrIndex : null;
+      pastedVariables.push({
+        name: hasName ? nameOrIndex : null,
+        serializedVariable,
+      });
+    });
 
-      if (pasteAtTopLevel) {
-        if (!name) return;
-        const { name: newName } = insertInVariablesContainer(
+    // Variables pasted in the container are all named in a single call.
+    const pasteInVariablesContainer = (index: ?number) => {
+      const namedVariables = [];
+      pastedVariables.forEach(({ name, serializedVariable }) => {
+        if (name) namedVariables.push({ name, serializedVariable });
+      });
+      newSelectedNodes.push(
+        ...insertAllInVariablesContainer(
           props.variablesContainer,
-          name,
-          serializedVariable
-        );
-        newSelectedNodes.push(newName);
-      } else {
-        const targetNode = selectedNodes[0];
-        if (targetNode.startsWith(inheritedPrefix)) return;
+          namedVariables,
+          index
+        )
+      );
+    };
 
-        const {
-          name: targetVariableName,
-          lineage: targetVariableLineage,
-        } = getVariableContextFromNodeId(targetNode, props.variablesContainer);
-        if (!targetVariableName) return;
+    const pasteAtTopLevel =
+      selectedNodes.length === 0 ||
+      selectedNodes.some(nodeId => nodeId.startsWith(inheritedPrefix));
 
-        const targetParentVariable = getDirectParentVariable(
-          targetVariableLineage
+    if (pasteAtTopLevel) {
+      pasteInVariablesContainer(null);
+    } else {
+      const targetNode = selectedNodes[0];
+      const {
+        name: targetVariableName,
+        lineage: targetVariableLineage,
+      } = getVariableContextFromNodeId(targetNode, props.variablesContainer);
+      if (!targetVariableName) return;
+
+      const targetParentVariable = getDirectParentVariable(
+        targetVariableLineage
+      );
+      if (!targetParentVariable) {
+        pasteInVariablesContainer(
+          props.variablesContainer.getPosition(targetVariableName) + 1
         );
-        if (!targetParentVariable) {
-          if (!name) return;
-          const { name: newName } = insertInVariablesContainer(
-            props.variablesContainer,
-            name,
-            serializedVariable,
-            props.variablesContainer.getPosition(targetVariableName) + 1
-          );
-          newSelectedNodes.push(newName);
-        } else {
-          const targetParentType = targetParentVariable.getType();
+      } else {
+        const targetParentType = targetParentVariable.getType();
+        let pastedElementOffsetIndex = 0;
 
+        pastedVariables.forEach(({ name, serializedVariable }) => {
           if (
             (targetParentType === gd.Variable.Structure && !name) ||
             (targetParentType === gd.Variable.Array && !!name)
@@ -442,9 +450,9 @@ const VariablesList = ({ onComputeAllVariableNames, ...props }: Props) => {
             bits.splice(bits.length - 1, 1, newName);
             newSelectedNodes.push(bits.join(separator));
           }
-        }
+        });
       }
-    });
+    }
     _onChange();
     setSelectedNodes(newSelectedNodes);
   };